@@ -27,8 +27,228 @@ extern "C" {
 
 
 
+typedef enum {
+  WRITE = 0,
+  READ  = 1,
+  NOOP  = 2  
+} TrasmissionDirection_t;
+
+typedef enum {
+  FRONT = 0,
+  BACK  = 1,
+  NONE  = 2  
+} ImageLayer_t;
+
+
+/**
+ * @brief   Display rectangle type definition struct.
+ */
+typedef struct {
+  uint16_t              X;
+  uint16_t              Y;
+  uint16_t              W;
+  uint16_t              H;
+} DisplayRect_TypeDef;
+
+
+/**
+ * @brief   Canvas type definition struct.
+ *          An in-RAM piece of the screen at (X, Y), stored in the panel
+ *          stream order: W columns of H pixels.
+ */
+typedef struct {
+  uint16_t*             Buf;
+  uint16_t              X;
+  uint16_t              Y;
+  uint16_t              W;
+  uint16_t              H;
+} Canvas_TypeDef;
+
+
+/**
+ * @brief   Bitmap type definition struct.
+ *          W columns of H native RGB565 pixels in the panel stream order, in
+ *          flash or RAM. The DMA streams read it in place, so it must not
+ *          sit in the CCM RAM.
+ */
+typedef struct {
+  uint16_t              W;
+  uint16_t              H;
+  const uint16_t*       Pixels;
+} Bitmap_TypeDef;
+
+
+/**
+ * @brief   Compressed image type definition struct.
+ *          W columns of H pixels in the panel stream order, packed into Size
+ *          bytes of Data. See Periph/Src/image.c and Tools/image.py.
+ */
+typedef struct {
+  uint16_t              W;
+  uint16_t              H;
+  uint32_t              Size;
+  const uint8_t*        Data;
+} Image_TypeDef;
+
+
+/**
+ * @brief   Image decoder type definition struct.
+ *          The read position, the last pixel, what is left of a run and the
+ *          64 colors seen last, indexed by their hash.
+ */
+typedef struct {
+  const uint8_t*        Src;
+  const uint8_t*        End;
+  uint16_t              Prev;
+  uint8_t               Run;
+  uint16_t              Index[64];
+} ImageDecoder_TypeDef;
+
+
+/**
+ * @brief   JPEG Huffman table type definition struct.
+ *          Canonical codes: codes of length l run from MinCode[l] to
+ *          MaxCode[l] (-1 when there are none) and stand for the values from
+ *          Vals[ValOff[l]] on.
+ */
+typedef struct {
+  int32_t               MaxCode[17];
+  uint16_t              MinCode[17];
+  uint8_t               ValOff[17];
+  uint8_t               Vals[162];
+} JpegHuff_TypeDef;
+
+
+/**
+ * @brief   JPEG component type definition struct.
+ *          H x V blocks of the component make one MCU, Blk is where the
+ *          first of them sits in the MCU sample buffer.
+ */
+typedef struct {
+  uint8_t               Id;
+  uint8_t               H;
+  uint8_t               V;
+  uint8_t               Tq;
+  uint8_t               Td;
+  uint8_t               Ta;
+  uint8_t               Blk;
+  int16_t               Pred;
+} JpegComp_TypeDef;
+
+
+/**
+ * @brief   JPEG decoder type definition struct.
+ *          All the decoder memory, a few KB whatever the picture size. Read()
+ *          refills In from the source, Bits holds the entropy coded bits
+ *          left-aligned. McuW x McuH pixel MCUs cover the picture in McusX
+ *          columns and McusY rows. See Periph/Src/jpeg.c.
+ */
+typedef struct {
+  uint32_t              (*Read)(void*, uint8_t*, uint32_t);
+  void*                 Ctx;
+  uint8_t               In[64];
+  uint8_t               InPos;
+  uint8_t               InLen;
+  uint32_t              Bits;
+  uint8_t               BitCnt;
+  uint8_t               Marker;
+  uint16_t              W;
+  uint16_t              H;
+  uint8_t               CompNum;
+  JpegComp_TypeDef      Comp[3];
+  uint8_t               McuW;
+  uint8_t               McuH;
+  uint16_t              McusX;
+  uint16_t              McusY;
+  uint16_t              Restart;
+  uint16_t              Left;
+  uint8_t               Rst;
+  uint16_t              Qt[4][64];
+  JpegHuff_TypeDef      Dc[2];
+  JpegHuff_TypeDef      Ac[2];
+  int32_t               Coef[64];
+  uint8_t               Samples[6][64];
+} Jpeg_TypeDef;
+
+
+/**
+ * @brief   Glyph cache block type definition struct.
+ *          The first block of a cached glyph holds its key, the blocks after
+ *          it only point back at it through Owner (0xff when free).
+ */
+typedef struct {
+  const uint8_t*        Font;
+  uint16_t              Color;
+  uint16_t              Bgcolor;
+  uint16_t              Code;
+  uint8_t               Height;
+  uint8_t               Blocks;
+  uint8_t               Owner;
+  uint8_t               Next;
+  uint32_t              Stamp;
+} GlyphCacheEntry_TypeDef;
+
+
+/**
+ * @brief   Filled shape type definition struct.
+ *          A box at (X, Y) with elliptic corners of radii Rx and Ry, which
+ *          covers circles, ellipses and rounded rectangles. Hy is the half
+ *          height of the last corner column, kept between Shape_Span() calls.
+ */
+typedef struct {
+  int16_t               X;
+  int16_t               Y;
+  uint16_t              W;
+  uint16_t              H;
+  uint16_t              Rx;
+  uint16_t              Ry;
+  uint16_t              Hy;
+} Shape_TypeDef;
+
+
+/**
+ * @brief   Ring outline type definition struct.
+ *          The pixels of Outer that are not in Inner (Inner.W is 0 when
+ *          there is no hole), cut to the arc from S clockwise to E when
+ *          Sweep is under 360 degrees. S and E are unit vectors in Q12.
+ */
+typedef struct {
+  Shape_TypeDef         Outer;
+  Shape_TypeDef         Inner;
+  int16_t               X0;
+  int16_t               Y0;
+  int32_t               Sx;
+  int32_t               Sy;
+  int32_t               Ex;
+  int32_t               Ey;
+  uint16_t              Sweep;
+} Ring_TypeDef;
+
+
+/**
+ * @brief   Display transfer job type definition struct.
+ *          A job is a window (skipped when Dir is NOOP) followed by a pixel
+ *          payload, started from the SPI TX complete callback. A job without
+ *          Data repeats Color Size times.
+ */
+typedef struct {
+  uint16_t              X0;
+  uint16_t              Y0;
+  uint16_t              X1;
+  uint16_t              Y1;
+  TrasmissionDirection_t Dir;
+  uint16_t              Color;
+  uint16_t*             Data;
+  uint32_t              Size;
+  __IO uint32_t*        Lock;
+} DisplayJob_TypeDef;
+
+
 /**
  * @brief   Display device type definition struct.
+ *          ScrollSize lines from ScrollTop along the scroll axis wrap around,
+ *          the panel shows draw line ScrollTop + ((v + ScrollOffset) mod
+ *          ScrollSize) at screen line ScrollTop + v.
  */
 typedef struct {
   FunctionalState       Lock;
@@ -36,17 +256,90 @@ typedef struct {
   uint16_t              Width;
   uint16_t              Height;
   uint8_t               Orientation;
+  uint16_t              Bgcolor;
+  DisplayRect_TypeDef   Clip;
   uint32_t*             Bus;
   uint16_t*             PixBuf;
   uint32_t              PixBufSize;
   uint32_t              PixBufActiveSize;
+  uint16_t*             PixBufPool;
+  uint32_t              PixBufNum;
+  uint32_t              PixBufIndex;
+  __IO uint32_t*        PixBufLock;
   uint16_t*             PixBufBg;
   uint32_t              PixBufBgSize;
   uint32_t              PixBufBgActiveSize;
+  __IO uint32_t         PixBufBgLock;
+  DisplayJob_TypeDef    Window;
+  uint32_t              Caset;
+  uint32_t              Raset;
+  DisplayJob_TypeDef*   Queue;
+  uint32_t              QueueSize;
+  __IO uint32_t         QueueHead;
+  __IO uint32_t         QueueTail;
+  uint16_t              ScrollTop;
+  uint16_t              ScrollSize;
+  uint16_t              ScrollOffset;
   HAL_StatusTypeDef     (*Callback)(uint32_t*);
 } Display_TypeDef;
 
 
+/**
+ * @brief   Glyph atlas type definition struct.
+ *          Glyphs of a font pre-expanded in flash for one color pair, in the
+ *          panel stream order. Index maps a glyph to its place in Pixels,
+ *          0xff when the atlas does not have it. See Tools/atlas.py.
+ */
+typedef struct {
+  const uint8_t*        Font;
+  uint16_t              Color;
+  uint16_t              Bgcolor;
+  const uint8_t*        Index;
+  const uint16_t*       Pixels;
+} FontAtlas_TypeDef;
+
+
+/**
+ * @brief   Font character range type definition struct.
+ *          Code points First..First+Count-1 are glyphs Glyph.. in a row.
+ */
+typedef struct {
+  uint16_t              First;
+  uint16_t              Count;
+  uint16_t              Glyph;
+} FontRange_TypeDef;
+
+
+/**
+ * @brief   Font character map type definition struct.
+ *          Dense ranges first, the scattered code points in a perfect hash
+ *          of HashSize slots (a power of 2), a code point can only be in
+ *          slot ((code * Seed) >> 16) & (HashSize - 1). Missing is shown
+ *          for code points the font does not have. See Tools/extfont.py.
+ */
+typedef struct {
+  const FontRange_TypeDef* Ranges;
+  uint8_t               RangeNum;
+  uint8_t               HashSize;
+  uint16_t              Seed;
+  const uint16_t*       HashCode;
+  const uint16_t*       HashGlyph;
+  uint16_t              Missing;
+} FontMap_TypeDef;
+
+
+/**
+ * @brief   Font type definition struct.
+ *          Font holds 1-bpp glyphs of BytesPerGlif bytes. When Rle is set
+ *          Font holds run-length encoded glyphs instead, glyph i takes the
+ *          run bytes from Rle[i] to Rle[i + 1] - 1. See Tools/rlefont.py.
+ *          Bpp 2 or 4 makes an anti-aliased font, a pixel is a coverage
+ *          level between Bgcolor and Color. See Tools/aafont.py.
+ *          Scale 2..4 blows up a 1-bpp dot font, Width and Height are then
+ *          the scaled cell, e.g. font_dot_5x7 at Scale 4 is 24x32.
+ *          Map turns code points into glyph numbers for fonts beyond the
+ *          96 glyphs of ASCII and the degree sign.
+ */
 typedef struct {
   uint8_t               Width;
   uint8_t               Height;
@@ -54,9 +347,66 @@ typedef struct {
   uint16_t              Bgcolor;
   uint16_t              BytesPerGlif;
   uint8_t*              Font;
+  const FontAtlas_TypeDef* Atlas;
+  const uint16_t*       Rle;
+  uint8_t               Bpp;
+  uint8_t               Scale;
+  const FontMap_TypeDef* Map;
 } Font_TypeDef;
 
 
+/**
+ * @brief   Proportional glyph type definition struct.
+ *          The inked box of a glyph, Width columns of Height bits packed
+ *          like a dot font glyph from Offset in the font Bitmap. The box is
+ *          XOffset, YOffset away from the pen at the line top, the pen then
+ *          moves by Advance.
+ */
+typedef struct {
+  uint16_t              Offset;
+  uint8_t               Width;
+  uint8_t               Height;
+  int8_t                XOffset;
+  int8_t                YOffset;
+  uint8_t               Advance;
+} FontGlyph_TypeDef;
+
+
+/**
+ * @brief   Proportional font type definition struct.
+ *          Height is the line height, Glyphs holds 96 glyphs indexed like
+ *          the dot fonts. See Tools/propfont.py.
+ */
+typedef struct {
+  uint8_t               Height;
+  uint16_t              Color;
+  uint16_t              Bgcolor;
+  const FontGlyph_TypeDef* Glyphs;
+  const uint8_t*        Bitmap;
+} PropFont_TypeDef;
+
+
+/**
+ * @brief   Text sink type definition struct.
+ *          Pen state of Display_Printf(), rows R0..R1-1 of the current line
+ *          are inside the clip region, RunX..RunEnd-1 are buffered, Utf
+ *          holds an unfinished UTF-8 sequence.
+ */
+typedef struct {
+  Display_TypeDef*      Dev;
+  Font_TypeDef*         Font;
+  int32_t               Left;
+  int32_t               X;
+  int32_t               Y;
+  int32_t               RunX;
+  int32_t               RunEnd;
+  uint16_t              R0;
+  uint16_t              R1;
+  char                  Utf[3];
+  uint8_t               UtfLen;
+} TextSink_TypeDef;
+
+
 typedef struct {
   uint8_t               Event;   // 0=down, 1=up, 2=contact
   uint16_t              RawX;
@@ -106,19 +456,6 @@ typedef struct {
 } TouchScreen_TypeDef;
 
 
-typedef enum {
-  WRITE = 0,
-  READ  = 1,
-  NOOP  = 2  
-} TrasmissionDirection_t;
-
-typedef enum {
-  FRONT = 0,
-  BACK  = 1,
-  NONE  = 2  
-} ImageLayer_t;
-
-
 #ifdef __cplusplus
 }
 #endif
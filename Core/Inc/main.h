@@ -40,9 +40,24 @@ extern "C" {
 /* USER CODE BEGIN Includes */
 #include "fonts.h"
 #include "common.h"
+#include "atlas.h"
+#include "propfont.h"
+#include "rlefont.h"
+#include "aafont.h"
+#include "extfont.h"
 #include "st7796.h"
+#include "glyph.h"
+#include "glyph_cache.h"
+#include "format.h"
+#include "shape.h"
+#include "canvas.h"
+#include "image.h"
+#include "jpeg.h"
 #include "ft6336u.h"
 #include "display.h"
+#include "dirty.h"
+#include "textfield.h"
+#include "console.h"
 /* USER CODE END Includes */
 
 /* Exported types ------------------------------------------------------------*/
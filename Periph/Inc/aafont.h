@@ -0,0 +1,42 @@
+/**
+  ******************************************************************************
+  * @file           : aafont.h
+  * @brief          : This file contains the anti-aliased fonts built by
+  *                   Tools/aafont.py.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2017-2026 Askug Ltd.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __AAFONT_H
+#define __AAFONT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "main.h"
+
+
+
+extern const uint8_t aa_10x14_4[96][96];    // Width 12, Height 16, Bpp 4, BytesPerGlif 96
+extern const uint8_t aa_20x28_2[96][192];   // Width 24, Height 32, Bpp 2, BytesPerGlif 192
+
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __AAFONT_H */
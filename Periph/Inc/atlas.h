@@ -0,0 +1,41 @@
+/**
+  ******************************************************************************
+  * @file           : atlas.h
+  * @brief          : This file contains the pre-expanded glyph atlases built
+  *                   by Tools/atlas.py.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2017-2026 Askug Ltd.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __ATLAS_H
+#define __ATLAS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "main.h"
+
+
+
+extern const FontAtlas_TypeDef atlas_readout;   // font_dot_10x14, lime on blue, " 0123456789:xy-"
+
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __ATLAS_H */
@@ -0,0 +1,54 @@
+/**
+  ******************************************************************************
+  * @file           : canvas.h
+  * @brief          : Header for canvas.c file.
+  *                   This file contains the common defines of the in-RAM
+  *                   drawing primitives code.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2017-2026 Askug Ltd.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __CANVAS_H
+#define __CANVAS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "main.h"
+
+
+
+void Canvas_Fill(Canvas_TypeDef*, uint16_t);
+void Canvas_FillRectangle(Canvas_TypeDef*, int16_t, int16_t, uint16_t, uint16_t, uint16_t);
+void Canvas_DrawRectangle(Canvas_TypeDef*, int16_t, int16_t, uint16_t, uint16_t, uint16_t, uint16_t);
+void Canvas_DrawPixel(Canvas_TypeDef*, int16_t, int16_t, uint16_t);
+void Canvas_DrawVLine(Canvas_TypeDef*, int16_t, int16_t, uint16_t, uint16_t, uint16_t);
+void Canvas_DrawHLine(Canvas_TypeDef*, int16_t, int16_t, uint16_t, uint16_t, uint16_t);
+void Canvas_DrawCircle(Canvas_TypeDef*, int16_t, int16_t, uint16_t, uint16_t, uint16_t);
+void Canvas_DrawArc(Canvas_TypeDef*, int16_t, int16_t, uint16_t, uint16_t, int16_t, int16_t, uint16_t);
+void Canvas_FillCircle(Canvas_TypeDef*, int16_t, int16_t, uint16_t, uint16_t);
+void Canvas_FillEllipse(Canvas_TypeDef*, int16_t, int16_t, uint16_t, uint16_t, uint16_t);
+void Canvas_FillRoundRect(Canvas_TypeDef*, int16_t, int16_t, uint16_t, uint16_t, uint16_t, uint16_t);
+
+void Canvas_PrintString(Canvas_TypeDef*, int16_t, int16_t, Font_TypeDef*, const char*);
+
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __CANVAS_H */
@@ -0,0 +1,42 @@
+/**
+  ******************************************************************************
+  * @file           : extfont.h
+  * @brief          : This file contains the fonts with a character map built by
+  *                   Tools/extfont.py.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2017-2026 Askug Ltd.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __EXTFONT_H
+#define __EXTFONT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "main.h"
+
+
+
+extern const uint8_t font_ext_5x7[170][6];
+extern const FontMap_TypeDef font_ext_5x7_map;
+
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __EXTFONT_H */
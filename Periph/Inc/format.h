@@ -0,0 +1,44 @@
+/**
+  ******************************************************************************
+  * @file           : format.h
+  * @brief          : Header for format.c file.
+  *                   This file contains the common defines of the small
+  *                   printf-style formatter code.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2017-2026 Askug Ltd.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __FORMAT_H
+#define __FORMAT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "main.h"
+#include <stdarg.h>
+
+
+
+uint32_t Format_Stream(void (*)(void*, char), void*, const char*, va_list);
+uint32_t Format_String(char*, uint32_t, const char*, ...);
+
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __FORMAT_H */
@@ -0,0 +1,50 @@
+/**
+  ******************************************************************************
+  * @file           : glyph.h
+  * @brief          : Header for glyph.c file.
+  *                   This file contains the common defines of the glyph
+  *                   lookup and expansion code.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2017-2026 Askug Ltd.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __GLYPH_H
+#define __GLYPH_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "main.h"
+
+
+
+uint16_t Glyph_Index(const FontMap_TypeDef*, uint16_t);
+uint32_t Glyph_Decode(const char*, uint32_t, uint16_t*);
+const uint8_t* Glyph_Bits(const Font_TypeDef*, uint16_t);
+const uint16_t* Glyph_Atlas(const Font_TypeDef*, uint16_t);
+void Glyph_Expand(const Font_TypeDef*, uint16_t, uint16_t*, uint32_t, uint16_t, uint16_t, uint16_t, uint16_t);
+void Glyph_Render(const Font_TypeDef*, uint16_t, uint16_t*);
+const FontGlyph_TypeDef* Glyph_Prop(const PropFont_TypeDef*, uint16_t);
+void Glyph_ExpandProp(const PropFont_TypeDef*, uint16_t, uint16_t*, uint32_t, uint16_t, uint16_t, uint16_t, uint16_t);
+uint32_t Glyph_PropWidth(const PropFont_TypeDef*, const char*, uint32_t);
+
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __GLYPH_H */
@@ -0,0 +1,49 @@
+/**
+  ******************************************************************************
+  * @file           : glyph_cache.h
+  * @brief          : Header for glyph_cache.c file.
+  *                   This file contains the common defines of the expanded
+  *                   glyph cache code.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2017-2026 Askug Ltd.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __GLYPH_CACHE_H
+#define __GLYPH_CACHE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "main.h"
+
+
+#define GLYPH_CACHE_SZ      4096U   // pixels (8 KB), 0 turns the cache off
+#define GLYPH_CACHE_BLOCK   64U     // pixels per block, a glyph takes whole blocks
+#define GLYPH_CACHE_BUCKETS 32U     // hash chains, power of two
+
+
+
+const uint16_t* GlyphCache_Get(const Font_TypeDef*, uint16_t);
+void GlyphCache_Expand(const Font_TypeDef*, uint16_t, uint16_t*, uint32_t, uint16_t, uint16_t, uint16_t, uint16_t);
+void GlyphCache_Reset(void);
+
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __GLYPH_CACHE_H */
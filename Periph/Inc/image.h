@@ -0,0 +1,43 @@
+/**
+  ******************************************************************************
+  * @file           : image.h
+  * @brief          : Header for image.c file.
+  *                   This file contains the common defines of the compressed
+  *                   image decoder.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2017-2026 Askug Ltd.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __IMAGE_H
+#define __IMAGE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "main.h"
+
+
+
+void Image_Begin(ImageDecoder_TypeDef*, const Image_TypeDef*);
+uint32_t Image_Decode(ImageDecoder_TypeDef*, uint16_t*, uint32_t);
+
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __IMAGE_H */
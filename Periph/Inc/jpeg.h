@@ -0,0 +1,43 @@
+/**
+  ******************************************************************************
+  * @file           : jpeg.h
+  * @brief          : Header for jpeg.c file.
+  *                   This file contains the common defines of the baseline
+  *                   JPEG decoder.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2017-2026 Askug Ltd.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __JPEG_H
+#define __JPEG_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "main.h"
+
+
+
+HAL_StatusTypeDef Jpeg_Begin(Jpeg_TypeDef*, uint32_t (*)(void*, uint8_t*, uint32_t), void*);
+HAL_StatusTypeDef Jpeg_Mcu(Jpeg_TypeDef*, uint16_t*);
+
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __JPEG_H */
@@ -0,0 +1,49 @@
+/**
+  ******************************************************************************
+  * @file           : propfont.h
+  * @brief          : This file contains the proportional fonts built by
+  *                   Tools/propfont.py.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2017-2026 Askug Ltd.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __PROPFONT_H
+#define __PROPFONT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "main.h"
+
+
+
+extern const uint8_t prop_5x7_bitmap[];
+extern const uint8_t prop_10x14_bitmap[];
+extern const uint8_t prop_15x21_bitmap[];
+extern const uint8_t prop_20x28_bitmap[];
+
+extern const FontGlyph_TypeDef prop_5x7_glyphs[96];
+extern const FontGlyph_TypeDef prop_10x14_glyphs[96];
+extern const FontGlyph_TypeDef prop_15x21_glyphs[96];
+extern const FontGlyph_TypeDef prop_20x28_glyphs[96];
+
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __PROPFONT_H */
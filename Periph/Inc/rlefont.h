@@ -0,0 +1,45 @@
+/**
+  ******************************************************************************
+  * @file           : rlefont.h
+  * @brief          : This file contains the run-length encoded fonts built by
+  *                   Tools/rlefont.py.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2017-2026 Askug Ltd.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __RLEFONT_H
+#define __RLEFONT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "main.h"
+
+
+
+extern const uint8_t rle_20x28_runs[];
+extern const uint8_t rle_30x42_runs[];
+
+extern const uint16_t rle_20x28_offset[97];
+extern const uint16_t rle_30x42_offset[97];
+
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __RLEFONT_H */
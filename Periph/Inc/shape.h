@@ -0,0 +1,50 @@
+/**
+  ******************************************************************************
+  * @file           : shape.h
+  * @brief          : Header for shape.c file.
+  *                   This file contains the common defines of the shape
+  *                   rasterizer code.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2017-2026 Askug Ltd.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __SHAPE_H
+#define __SHAPE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "main.h"
+
+
+
+void Shape_Circle(Shape_TypeDef*, int16_t, int16_t, uint16_t);
+void Shape_Ellipse(Shape_TypeDef*, int16_t, int16_t, uint16_t, uint16_t);
+void Shape_RoundRect(Shape_TypeDef*, int16_t, int16_t, uint16_t, uint16_t, uint16_t);
+void Shape_Span(Shape_TypeDef*, int16_t, int16_t*, int16_t*);
+
+void Shape_Ring(Ring_TypeDef*, int16_t, int16_t, uint16_t, uint16_t);
+void Shape_Arc(Ring_TypeDef*, int16_t, int16_t, uint16_t, uint16_t, int16_t, int16_t);
+void Shape_RingSpan(Ring_TypeDef*, int16_t, int16_t*, int16_t*, int16_t*, int16_t*);
+bool Shape_ArcInside(Ring_TypeDef*, int16_t, int16_t);
+
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __SHAPE_H */
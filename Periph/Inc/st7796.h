@@ -32,8 +32,8 @@ extern "C" {
 // 0x20 or 0xe0 - vertical
 // 0x40 or 0x80 - horizontal
 // 0x00 - RGB
-// 0x08 - BRG
-#define ORIENTATION       (0x80 | 0x00)
+// 0x08 - BRG (the panel is BGR, the bit gives RGB565 order back)
+#define ORIENTATION       (0x80 | 0x08)
 
 #if ((ORIENTATION >> 6) < 3 && (ORIENTATION >> 6) != 0)
   #define DISPLAY_POSITION 0 // horizontal
@@ -45,20 +45,26 @@ extern "C" {
   #define DISPLAY_HEIGHT  480
 #endif
 
+// hardware scrolling runs along the panel rows: logical x when horizontal,
+// logical y when vertical
+#define DISPLAY_SCROLL_LINES 480U
 
 
-/* Define colors*/
+
+/* Define colors (native RGB565) */
 #define COLOR_WHITE       (uint16_t)0xffff
 #define COLOR_BLACK       (uint16_t)0x0000
 #define COLOR_RED         (uint16_t)0xf800
-#define COLOR_GREEN       (uint16_t)0x001f
-#define COLOR_BLUE        (uint16_t)0x07e0
+#define COLOR_GREEN       (uint16_t)0x07e0
+#define COLOR_BLUE        (uint16_t)0x001f
 #define COLOR_PURPLE      (uint16_t)(COLOR_RED | COLOR_BLUE)
 #define COLOR_SKY         (uint16_t)(COLOR_GREEN | COLOR_BLUE)
 #define COLOR_LIME        (uint16_t)(COLOR_GREEN | COLOR_RED)
 
 
 #define PIX_BUF_SZ        4096U  // words (4096 pixels)
+#define PIX_BUF_NUM       2U     // write buffer parts, filled while the others are sent
+#define DISPLAY_QUEUE_SZ  16U    // transfer jobs in flight
 
 #define TFT_CS_GPIO_Port  GPIOA
 #define TFT_CS_Pin        GPIO_PIN_4
@@ -82,6 +88,14 @@ Display_TypeDef* ST7796_Init(void);
 
 
 
+HAL_StatusTypeDef __attribute__((weak)) Display_Sync(Display_TypeDef*);
+HAL_StatusTypeDef __attribute__((weak)) Display_SetClip(Display_TypeDef*, uint16_t, uint16_t, uint16_t, uint16_t);
+HAL_StatusTypeDef __attribute__((weak)) Display_ResetClip(Display_TypeDef*);
+HAL_StatusTypeDef __attribute__((weak)) Display_ScrollDefine(Display_TypeDef*, uint16_t, uint16_t);
+HAL_StatusTypeDef __attribute__((weak)) Display_ScrollTo(Display_TypeDef*, uint16_t);
+HAL_StatusTypeDef __attribute__((weak)) Display_Scroll(Display_TypeDef*, int16_t);
+uint16_t __attribute__((weak)) Display_ScrollMap(Display_TypeDef*, uint16_t);
+HAL_StatusTypeDef __attribute__((weak)) Display_RenderBands(Display_TypeDef*, uint16_t, uint16_t, uint16_t, uint16_t, HAL_StatusTypeDef (*)(Canvas_TypeDef*));
 HAL_StatusTypeDef __attribute__((weak)) Display_Fill(Display_TypeDef*, uint16_t, ImageLayer_t);
 HAL_StatusTypeDef __attribute__((weak)) Display_DrawRectangle(Display_TypeDef*, uint16_t, uint16_t, uint16_t, uint16_t, uint16_t, uint16_t, ImageLayer_t);
 HAL_StatusTypeDef __attribute__((weak)) Display_FillRectangle(Display_TypeDef*, uint16_t, uint16_t, uint16_t, uint16_t, uint16_t, ImageLayer_t);
@@ -89,13 +103,23 @@ HAL_StatusTypeDef __attribute__((weak)) Display_DrawPixel(Display_TypeDef*, uint
 HAL_StatusTypeDef __attribute__((weak)) Display_DrawVLine(Display_TypeDef*, uint16_t, uint16_t, uint16_t, uint16_t, uint16_t, ImageLayer_t);
 HAL_StatusTypeDef __attribute__((weak)) Display_DrawHLine(Display_TypeDef*, uint16_t, uint16_t, uint16_t, uint16_t, uint16_t, ImageLayer_t);
 HAL_StatusTypeDef __attribute__((weak)) Display_DrawCircle(Display_TypeDef*, uint16_t, uint16_t, uint16_t, uint16_t, uint16_t, ImageLayer_t);
+HAL_StatusTypeDef __attribute__((weak)) Display_DrawArc(Display_TypeDef*, uint16_t, uint16_t, uint16_t, uint16_t, int16_t, int16_t, uint16_t);
 HAL_StatusTypeDef __attribute__((weak)) Display_FillCircle(Display_TypeDef*, uint16_t, uint16_t, uint16_t, uint16_t, ImageLayer_t);
+HAL_StatusTypeDef __attribute__((weak)) Display_FillEllipse(Display_TypeDef*, uint16_t, uint16_t, uint16_t, uint16_t, uint16_t, ImageLayer_t);
+HAL_StatusTypeDef __attribute__((weak)) Display_FillRoundRect(Display_TypeDef*, uint16_t, uint16_t, uint16_t, uint16_t, uint16_t, uint16_t, ImageLayer_t);
 
 HAL_StatusTypeDef __attribute__((weak)) Display_FillBackground(Display_TypeDef*, uint16_t, uint16_t, uint16_t, uint16_t);
 HAL_StatusTypeDef __attribute__((weak)) Display_ReadRectangle(Display_TypeDef*, uint16_t, uint16_t, uint16_t, uint16_t);
+HAL_StatusTypeDef __attribute__((weak)) Display_Blit(Display_TypeDef*, uint16_t, uint16_t, const Bitmap_TypeDef*);
+HAL_StatusTypeDef __attribute__((weak)) Display_BlitPart(Display_TypeDef*, uint16_t, uint16_t, const Bitmap_TypeDef*, uint16_t, uint16_t, uint16_t, uint16_t);
+HAL_StatusTypeDef __attribute__((weak)) Display_DrawImage(Display_TypeDef*, uint16_t, uint16_t, const Image_TypeDef*);
+HAL_StatusTypeDef __attribute__((weak)) Display_DrawJpeg(Display_TypeDef*, uint16_t, uint16_t, Jpeg_TypeDef*);
 
 HAL_StatusTypeDef __attribute__((weak)) Display_PrintSymbol(Display_TypeDef*, uint16_t, uint16_t, Font_TypeDef*, char);
 HAL_StatusTypeDef __attribute__((weak)) Display_PrintString(Display_TypeDef*, uint16_t, uint16_t, Font_TypeDef*, const char*);
+HAL_StatusTypeDef __attribute__((weak)) Display_PrintText(Display_TypeDef*, uint16_t, uint16_t, Font_TypeDef*, const char*, uint32_t);
+HAL_StatusTypeDef __attribute__((weak)) Display_Printf(Display_TypeDef*, uint16_t, uint16_t, Font_TypeDef*, const char*, ...);
+HAL_StatusTypeDef __attribute__((weak)) Display_PrintProp(Display_TypeDef*, uint16_t, uint16_t, PropFont_TypeDef*, const char*);
 
 #ifdef __cplusplus
 }
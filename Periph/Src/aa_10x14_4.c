@@ -0,0 +1,779 @@
+/*
+ * Filename: aa_10x14_4.c
+ * Description: font_dot_10x14 anti-aliased, 4-bpp, 12x16 cells, 96 bytes per glyph.
+ *              Generated by Tools/aafont.py, do not edit.
+ */
+
+#include "aafont.h"
+
+
+const uint8_t aa_10x14_4[96][96] = {
+  { // ' ' (32)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '!' (33)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x66, 0x66, 0x66, 0x04,
+    0x00, 0x00, 0x00, 0xf6, 0xff, 0xff, 0xff, 0x6f, 0x00, 0x00, 0x00, 0xf6, 0xff, 0xff, 0xff, 0x6f,
+    0x00, 0x00, 0x00, 0x40, 0x66, 0x66, 0x66, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '"' (34)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x66, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xf6, 0xff, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf6, 0xff, 0x6f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x99, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x99, 0x07,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xf6, 0xff, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf6, 0xff, 0x6f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x66, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '#' (35)
+    0x00, 0x00, 0x30, 0x88, 0x03, 0x30, 0x88, 0x03, 0x00, 0x64, 0xd8, 0xff, 0x8d, 0xd8, 0xff, 0x3c,
+    0x60, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0x60, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f,
+    0x00, 0x97, 0xfc, 0xff, 0xcf, 0xfc, 0xff, 0x6f, 0x00, 0x97, 0xfc, 0xff, 0xcf, 0xfc, 0xff, 0x6f,
+    0x60, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0x60, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f,
+    0x00, 0x64, 0xd8, 0xff, 0x8d, 0xd8, 0xff, 0x3c, 0x00, 0x00, 0x30, 0x88, 0x03, 0x30, 0x88, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '$' (36)
+    0x00, 0x00, 0x66, 0x00, 0x10, 0x00, 0x01, 0x00, 0x00, 0x40, 0xff, 0x04, 0xb1, 0xbb, 0x1b, 0x00,
+    0x00, 0x80, 0xff, 0x6a, 0xd8, 0xff, 0x8d, 0x03, 0x00, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c,
+    0x60, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0x60, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f,
+    0x00, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3d, 0x00, 0x30, 0xd8, 0xff, 0x8d, 0xa6, 0xff, 0x08,
+    0x00, 0x00, 0xb1, 0xbb, 0x1b, 0x40, 0xff, 0x04, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00, 0x66, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '%' (37)
+    0x00, 0xf6, 0x6f, 0x01, 0x00, 0xf8, 0xff, 0x8f, 0x00, 0xf6, 0xdf, 0x1b, 0x40, 0xff, 0xff, 0xff,
+    0x00, 0x70, 0xfc, 0x0b, 0xa4, 0xff, 0xff, 0xff, 0x00, 0x70, 0xfc, 0xbe, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f,
+    0x60, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0x07, 0x60, 0xff, 0xff, 0xff, 0x6a, 0xd8, 0xcf, 0x07,
+    0x40, 0xff, 0xff, 0xff, 0x04, 0xb1, 0xfd, 0x6f, 0x00, 0xf8, 0xff, 0x8f, 0x00, 0x10, 0xf6, 0x6f,
+    0x00, 0x40, 0x66, 0x04, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '&' (38)
+    0x00, 0x10, 0xf6, 0x6f, 0x44, 0xf6, 0x6f, 0x01, 0x00, 0xb1, 0xfd, 0xdf, 0xff, 0xfd, 0xdf, 0x1b,
+    0x00, 0xd6, 0x7b, 0xb7, 0xff, 0x7b, 0xb7, 0x6d, 0x40, 0xff, 0x07, 0x70, 0xff, 0x07, 0x70, 0xff,
+    0x40, 0xff, 0x07, 0x80, 0xff, 0x08, 0x70, 0xff, 0x00, 0xd6, 0x7b, 0xe8, 0xff, 0x8e, 0xb7, 0x6d,
+    0x00, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x1b, 0x00, 0xf4, 0xff, 0xff, 0xff, 0xff, 0x6f, 0x01,
+    0x00, 0x80, 0x7b, 0xd8, 0xff, 0x8d, 0x04, 0x00, 0x00, 0x00, 0x01, 0x30, 0x88, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // "'" (39)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf6, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf6, 0x6f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '(' (40)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x66, 0x66, 0x66, 0x66, 0x04, 0x00,
+    0x10, 0xf6, 0xff, 0xff, 0xff, 0xff, 0x6f, 0x01, 0xb1, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x1b,
+    0x80, 0x7b, 0x66, 0x66, 0x66, 0x66, 0xb7, 0x08, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // ')' (41)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x80, 0x7b, 0x66, 0x66, 0x66, 0x66, 0xb7, 0x08,
+    0xb1, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x1b, 0x10, 0xf6, 0xff, 0xff, 0xff, 0xff, 0x6f, 0x01,
+    0x00, 0x40, 0x66, 0x66, 0x66, 0x66, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '*' (42)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x88, 0x03, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0x3c,
+    0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xff, 0x8f, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xff, 0x8f,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x88, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '+' (43)
+    0x00, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0xff, 0x08, 0x00, 0x00, 0x00, 0x00, 0x40, 0xe8, 0xff, 0x8e, 0x04, 0x00,
+    0x00, 0x00, 0xf6, 0xff, 0xff, 0xff, 0x6f, 0x00, 0x00, 0x00, 0xf6, 0xff, 0xff, 0xff, 0x6f, 0x00,
+    0x00, 0x00, 0x40, 0xe8, 0xff, 0x8e, 0x04, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // ',' (44)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x64, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0xb1, 0xfd, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x10, 0xf6, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '-' (45)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x60, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '.' (46)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '/' (47)
+    0x00, 0xf6, 0x6f, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf6, 0xdf, 0x1b, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x40, 0xb7, 0x08, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x80, 0x1b, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xb1, 0x08, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x80, 0x1b, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xb1, 0x08, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x80, 0x7b, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xb1, 0xfd, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xf6, 0x6f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '0' (48)
+    0x00, 0x10, 0xf6, 0xff, 0xff, 0xff, 0x6f, 0x01, 0x00, 0xb1, 0xfd, 0xff, 0xff, 0xff, 0xdf, 0x1b,
+    0x00, 0xd6, 0xff, 0xff, 0xaf, 0x66, 0xb7, 0x6d, 0x40, 0xff, 0x6a, 0xd8, 0x4f, 0x00, 0x70, 0xff,
+    0x60, 0xff, 0x06, 0xb1, 0x08, 0x01, 0x60, 0xff, 0x60, 0xff, 0x06, 0x10, 0x80, 0x1b, 0x60, 0xff,
+    0x40, 0xff, 0x07, 0x00, 0xf4, 0x8d, 0xa6, 0xff, 0x00, 0xd6, 0x7b, 0x66, 0xfa, 0xff, 0xff, 0x6d,
+    0x00, 0xb1, 0xfd, 0xff, 0xff, 0xff, 0xdf, 0x1b, 0x00, 0x10, 0xf6, 0xff, 0xff, 0xff, 0x6f, 0x01,
+    0x00, 0x00, 0x40, 0x66, 0x66, 0x66, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '1' (49)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x86, 0x03, 0x00, 0x00, 0x00, 0x30, 0x68, 0x40, 0xff, 0x8d, 0x66, 0x66, 0x66, 0xd8, 0xff,
+    0x60, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f,
+    0x40, 0xff, 0x8d, 0x66, 0x66, 0x66, 0x66, 0x04, 0x00, 0x86, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '2' (50)
+    0x00, 0xf8, 0xff, 0x6f, 0x01, 0x00, 0x00, 0x01, 0x40, 0xff, 0xff, 0xdf, 0x1b, 0x00, 0x80, 0x1b,
+    0x60, 0xff, 0x8e, 0xb7, 0x6d, 0x00, 0xb1, 0x6d, 0x60, 0xff, 0x08, 0x70, 0xff, 0x04, 0x70, 0xff,
+    0x60, 0xff, 0x06, 0x60, 0xff, 0x06, 0x60, 0xff, 0x60, 0xff, 0x06, 0x60, 0xff, 0x06, 0x60, 0xff,
+    0x60, 0xff, 0x06, 0x40, 0xff, 0x07, 0x70, 0xff, 0x60, 0xff, 0x06, 0x00, 0xd6, 0x7b, 0xb7, 0x6d,
+    0x40, 0xff, 0x04, 0x00, 0xb1, 0xfd, 0xdf, 0x1b, 0x00, 0x66, 0x00, 0x00, 0x10, 0xf6, 0x6f, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '3' (51)
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xb1, 0x08, 0x00, 0x00, 0x00, 0x80, 0x1b,
+    0x00, 0xd6, 0x1b, 0x00, 0x00, 0x00, 0xb1, 0x6d, 0x40, 0xff, 0x07, 0x00, 0x00, 0x00, 0x70, 0xff,
+    0x60, 0xff, 0x06, 0x00, 0x66, 0x00, 0x60, 0xff, 0x60, 0xff, 0x06, 0x40, 0xff, 0x04, 0x60, 0xff,
+    0x40, 0xff, 0x07, 0x70, 0xff, 0x07, 0x70, 0xff, 0x00, 0xd6, 0x7b, 0xb7, 0xff, 0x7b, 0xb7, 0x6d,
+    0x00, 0xb1, 0xfd, 0xdf, 0xff, 0xfd, 0xdf, 0x1b, 0x00, 0x10, 0xf6, 0x6f, 0x44, 0xf6, 0x6f, 0x01,
+    0x00, 0x00, 0x40, 0x04, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '4' (52)
+    0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xff, 0x6f, 0x00, 0x00, 0x00, 0x40, 0xff, 0xff, 0xff, 0x6f,
+    0x00, 0x00, 0x00, 0x60, 0xff, 0x8e, 0x66, 0x04, 0x00, 0x00, 0x00, 0x60, 0xff, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0xff, 0x08, 0x00, 0x00, 0x00, 0x40, 0x66, 0xe8, 0xff, 0x8e, 0x66, 0x04,
+    0x00, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6f, 0x00, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6f,
+    0x00, 0x40, 0x66, 0xd8, 0xff, 0x8d, 0x66, 0x04, 0x00, 0x00, 0x00, 0x30, 0x88, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '5' (53)
+    0x00, 0x66, 0x00, 0x00, 0xf8, 0xff, 0xff, 0x8f, 0x40, 0xff, 0x04, 0x40, 0xff, 0xff, 0xff, 0xff,
+    0x60, 0xff, 0x06, 0x60, 0xff, 0x8e, 0xe8, 0xff, 0x60, 0xff, 0x06, 0x60, 0xff, 0x08, 0x80, 0xff,
+    0x60, 0xff, 0x06, 0x60, 0xff, 0x06, 0x60, 0xff, 0x60, 0xff, 0x06, 0x60, 0xff, 0x06, 0x60, 0xff,
+    0x40, 0xff, 0x07, 0x70, 0xff, 0x04, 0x60, 0xff, 0x00, 0xd6, 0x7b, 0xb7, 0x6d, 0x00, 0x60, 0xff,
+    0x00, 0xb1, 0xfd, 0xdf, 0x1b, 0x00, 0x40, 0xff, 0x00, 0x10, 0xf6, 0x6f, 0x01, 0x00, 0x00, 0x66,
+    0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '6' (54)
+    0x00, 0x10, 0xf6, 0xff, 0xff, 0xff, 0x6f, 0x01, 0x00, 0xb1, 0xfd, 0xff, 0xff, 0xff, 0xdf, 0x1b,
+    0x00, 0xd6, 0x7b, 0xe8, 0xff, 0x8e, 0xb7, 0x6d, 0x40, 0xff, 0x07, 0x80, 0xff, 0x08, 0x70, 0xff,
+    0x60, 0xff, 0x06, 0x60, 0xff, 0x06, 0x60, 0xff, 0x60, 0xff, 0x06, 0x60, 0xff, 0x06, 0x60, 0xff,
+    0x40, 0xff, 0x07, 0x70, 0xff, 0x04, 0x60, 0xff, 0x00, 0xd6, 0x7b, 0xb7, 0x6d, 0x00, 0x60, 0xff,
+    0x00, 0xb1, 0xfd, 0xdf, 0x1b, 0x00, 0x40, 0xff, 0x00, 0x10, 0xf6, 0x6f, 0x01, 0x00, 0x00, 0x66,
+    0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '7' (55)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x00, 0x40, 0x66, 0x04, 0x00, 0x00, 0x40, 0xff,
+    0x00, 0xf6, 0xff, 0x6f, 0x01, 0x00, 0x60, 0xff, 0x00, 0xf6, 0xff, 0xdf, 0x1b, 0x00, 0x60, 0xff,
+    0x00, 0x40, 0x66, 0xb7, 0x6d, 0x00, 0x60, 0xff, 0x00, 0x00, 0x00, 0x70, 0xff, 0x04, 0x60, 0xff,
+    0x00, 0x00, 0x00, 0x40, 0xff, 0x07, 0x80, 0xff, 0x00, 0x00, 0x00, 0x00, 0xd6, 0x7b, 0xe8, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0xb1, 0xfd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x10, 0xf6, 0xff, 0x8f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x66, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '8' (56)
+    0x00, 0x10, 0xf6, 0x6f, 0x44, 0xf6, 0x6f, 0x01, 0x00, 0xb1, 0xfd, 0xdf, 0xff, 0xfd, 0xdf, 0x1b,
+    0x00, 0xd6, 0x7b, 0xb7, 0xff, 0x7b, 0xb7, 0x6d, 0x40, 0xff, 0x07, 0x70, 0xff, 0x07, 0x70, 0xff,
+    0x60, 0xff, 0x06, 0x60, 0xff, 0x06, 0x60, 0xff, 0x60, 0xff, 0x06, 0x60, 0xff, 0x06, 0x60, 0xff,
+    0x40, 0xff, 0x07, 0x70, 0xff, 0x07, 0x70, 0xff, 0x00, 0xd6, 0x7b, 0xb7, 0xff, 0x7b, 0xb7, 0x6d,
+    0x00, 0xb1, 0xfd, 0xdf, 0xff, 0xfd, 0xdf, 0x1b, 0x00, 0x10, 0xf6, 0x6f, 0x44, 0xf6, 0x6f, 0x01,
+    0x00, 0x00, 0x40, 0x04, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '9' (57)
+    0x00, 0x10, 0x00, 0x00, 0x10, 0xf6, 0x6f, 0x01, 0x00, 0xb1, 0x08, 0x00, 0xb1, 0xfd, 0xdf, 0x1b,
+    0x00, 0xd6, 0x1b, 0x00, 0xd6, 0x7b, 0xb7, 0x6d, 0x40, 0xff, 0x07, 0x40, 0xff, 0x07, 0x70, 0xff,
+    0x60, 0xff, 0x06, 0x60, 0xff, 0x06, 0x60, 0xff, 0x60, 0xff, 0x06, 0x60, 0xff, 0x06, 0x60, 0xff,
+    0x40, 0xff, 0x07, 0x80, 0xff, 0x08, 0x70, 0xff, 0x00, 0xd6, 0x7b, 0xe8, 0xff, 0x8e, 0xb7, 0x6d,
+    0x00, 0xb1, 0xfd, 0xff, 0xff, 0xff, 0xdf, 0x1b, 0x00, 0x10, 0xf6, 0xff, 0xff, 0xff, 0x6f, 0x01,
+    0x00, 0x00, 0x40, 0x66, 0x66, 0x66, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // ':' (58)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // ';' (59)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x86, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0xff, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '<' (60)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb1, 0xbb, 0x1b, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0x80, 0xff, 0x08, 0x01, 0x00, 0x00, 0x00, 0xb1, 0x08, 0x44, 0x80, 0x1b, 0x00,
+    0x00, 0x00, 0x80, 0x1b, 0x00, 0xb1, 0x08, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '=' (61)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x66, 0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x77, 0xff, 0x04, 0x00,
+    0x00, 0x00, 0x60, 0xff, 0x99, 0xff, 0x06, 0x00, 0x00, 0x00, 0x60, 0xff, 0x99, 0xff, 0x06, 0x00,
+    0x00, 0x00, 0x60, 0xff, 0x99, 0xff, 0x06, 0x00, 0x00, 0x00, 0x60, 0xff, 0x99, 0xff, 0x06, 0x00,
+    0x00, 0x00, 0x40, 0xff, 0x77, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x66, 0x00, 0x66, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '>' (62)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1b, 0x00, 0xb1, 0x08, 0x00,
+    0x00, 0x00, 0xb1, 0x08, 0x44, 0x80, 0x1b, 0x00, 0x00, 0x00, 0x10, 0x80, 0xff, 0x08, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0xb1, 0xbb, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '?' (63)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1b,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb1, 0x6d, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00, 0x70, 0xff,
+    0x00, 0x00, 0x00, 0xf6, 0x8f, 0x00, 0x60, 0xff, 0x00, 0x00, 0x00, 0xf8, 0xff, 0x04, 0x60, 0xff,
+    0x00, 0x00, 0x00, 0xc3, 0xff, 0x07, 0x70, 0xff, 0x00, 0x00, 0x00, 0x30, 0xd8, 0x7b, 0xb7, 0x6d,
+    0x00, 0x00, 0x00, 0x00, 0xb1, 0xfd, 0xdf, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x10, 0xf6, 0x6f, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '@' (64)
+    0x00, 0xf8, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0xff, 0x8f, 0x00, 0x00, 0x00, 0x80, 0x1b,
+    0x60, 0xff, 0x3d, 0x10, 0x00, 0x01, 0xb1, 0x6d, 0x60, 0xff, 0x18, 0xb1, 0xbb, 0x1b, 0x81, 0xff,
+    0x60, 0xff, 0x07, 0xd6, 0xff, 0x6d, 0x70, 0xff, 0x60, 0xff, 0x79, 0xff, 0xcc, 0xff, 0x97, 0xff,
+    0x40, 0xff, 0xcc, 0xff, 0xcc, 0xff, 0xcc, 0xff, 0x00, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6d,
+    0x00, 0xb1, 0xfd, 0xff, 0xff, 0xff, 0xdf, 0x1b, 0x00, 0x10, 0xf6, 0xff, 0xff, 0xff, 0x6f, 0x01,
+    0x00, 0x00, 0x40, 0x66, 0x66, 0x66, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'A' (65)
+    0x00, 0xf6, 0xff, 0xff, 0xff, 0xff, 0x6f, 0x01, 0x00, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x1b,
+    0x00, 0x40, 0xe8, 0xff, 0x8e, 0x66, 0xb7, 0x6d, 0x00, 0x00, 0x80, 0xff, 0x08, 0x00, 0x70, 0xff,
+    0x00, 0x00, 0x60, 0xff, 0x06, 0x00, 0x60, 0xff, 0x00, 0x00, 0x60, 0xff, 0x06, 0x00, 0x60, 0xff,
+    0x00, 0x00, 0x80, 0xff, 0x08, 0x00, 0x70, 0xff, 0x00, 0x40, 0xe8, 0xff, 0x8e, 0x66, 0xb7, 0x6d,
+    0x00, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x1b, 0x00, 0xf6, 0xff, 0xff, 0xff, 0xff, 0x6f, 0x01,
+    0x00, 0x40, 0x66, 0x66, 0x66, 0x66, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'B' (66)
+    0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0x40, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x60, 0xff, 0x8e, 0xe8, 0xff, 0x8e, 0xe8, 0xff, 0x60, 0xff, 0x08, 0x80, 0xff, 0x08, 0x80, 0xff,
+    0x60, 0xff, 0x06, 0x60, 0xff, 0x06, 0x60, 0xff, 0x60, 0xff, 0x06, 0x60, 0xff, 0x06, 0x60, 0xff,
+    0x40, 0xff, 0x07, 0x70, 0xff, 0x07, 0x70, 0xff, 0x00, 0xd6, 0x7b, 0xb7, 0xff, 0x7b, 0xb7, 0x6d,
+    0x00, 0xb1, 0xfd, 0xdf, 0xff, 0xfd, 0xdf, 0x1b, 0x00, 0x10, 0xf6, 0x6f, 0x44, 0xf6, 0x6f, 0x01,
+    0x00, 0x00, 0x40, 0x04, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'C' (67)
+    0x00, 0x10, 0xf6, 0xff, 0xff, 0xff, 0x6f, 0x01, 0x00, 0xb1, 0xfd, 0xff, 0xff, 0xff, 0xdf, 0x1b,
+    0x00, 0xd6, 0x7b, 0x66, 0x66, 0x66, 0xb7, 0x6d, 0x40, 0xff, 0x07, 0x00, 0x00, 0x00, 0x70, 0xff,
+    0x60, 0xff, 0x06, 0x00, 0x00, 0x00, 0x60, 0xff, 0x60, 0xff, 0x06, 0x00, 0x00, 0x00, 0x60, 0xff,
+    0x40, 0xff, 0x07, 0x00, 0x00, 0x00, 0x70, 0xff, 0x00, 0xd6, 0x1b, 0x00, 0x00, 0x00, 0xb1, 0x6d,
+    0x00, 0xb1, 0x08, 0x00, 0x00, 0x00, 0x80, 0x1b, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'D' (68)
+    0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0x40, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x60, 0xff, 0x8e, 0x66, 0x66, 0x66, 0xe8, 0xff, 0x60, 0xff, 0x08, 0x00, 0x00, 0x00, 0x80, 0xff,
+    0x60, 0xff, 0x06, 0x00, 0x00, 0x00, 0x60, 0xff, 0x60, 0xff, 0x06, 0x00, 0x00, 0x00, 0x60, 0xff,
+    0x40, 0xff, 0x07, 0x00, 0x00, 0x00, 0x70, 0xff, 0x00, 0xd6, 0x7b, 0x66, 0x66, 0x66, 0xb7, 0x6d,
+    0x00, 0xb1, 0xfd, 0xff, 0xff, 0xff, 0xdf, 0x1b, 0x00, 0x10, 0xf6, 0xff, 0xff, 0xff, 0x6f, 0x01,
+    0x00, 0x00, 0x40, 0x66, 0x66, 0x66, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'E' (69)
+    0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0x40, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x60, 0xff, 0x8e, 0xe8, 0xff, 0x8e, 0xe8, 0xff, 0x60, 0xff, 0x08, 0x80, 0xff, 0x08, 0x80, 0xff,
+    0x60, 0xff, 0x06, 0x40, 0xff, 0x04, 0x60, 0xff, 0x60, 0xff, 0x06, 0x00, 0x66, 0x00, 0x60, 0xff,
+    0x60, 0xff, 0x06, 0x00, 0x00, 0x00, 0x60, 0xff, 0x60, 0xff, 0x06, 0x00, 0x00, 0x00, 0x60, 0xff,
+    0x40, 0xff, 0x04, 0x00, 0x00, 0x00, 0x40, 0xff, 0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'F' (70)
+    0x00, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0x00, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0x40, 0x66, 0xe8, 0xff, 0x8e, 0xe8, 0xff, 0x00, 0x00, 0x00, 0x80, 0xff, 0x08, 0x80, 0xff,
+    0x00, 0x00, 0x00, 0x40, 0xff, 0x04, 0x60, 0xff, 0x00, 0x00, 0x00, 0x00, 0x66, 0x00, 0x60, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'G' (71)
+    0x00, 0x10, 0xf6, 0xff, 0xff, 0xff, 0x6f, 0x01, 0x00, 0xb1, 0xfd, 0xff, 0xff, 0xff, 0xdf, 0x1b,
+    0x00, 0xd6, 0x7b, 0x66, 0x77, 0x66, 0xb7, 0x6d, 0x40, 0xff, 0x07, 0x00, 0x00, 0x00, 0x70, 0xff,
+    0x60, 0xff, 0x06, 0x00, 0x66, 0x00, 0x60, 0xff, 0x60, 0xff, 0x06, 0x40, 0xff, 0x04, 0x60, 0xff,
+    0x40, 0xff, 0x07, 0x80, 0xff, 0x06, 0x70, 0xff, 0x00, 0xd6, 0x7b, 0xe8, 0xff, 0x06, 0xb1, 0x6d,
+    0x00, 0xb1, 0xfd, 0xff, 0xff, 0x04, 0x80, 0x1b, 0x00, 0x10, 0xf6, 0xff, 0x8f, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x40, 0x66, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'H' (72)
+    0x00, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6f, 0x00, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6f,
+    0x00, 0x40, 0x66, 0xe8, 0xff, 0x8e, 0x66, 0x04, 0x00, 0x00, 0x00, 0x80, 0xff, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x60, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0xff, 0x08, 0x00, 0x00, 0x00, 0x40, 0x66, 0xe8, 0xff, 0x8e, 0x66, 0x04,
+    0x00, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6f, 0x00, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6f,
+    0x00, 0x40, 0x66, 0x66, 0x66, 0x66, 0x66, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'I' (73)
+    0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x40, 0xff, 0x04, 0x00, 0x00, 0x00, 0x40, 0xff,
+    0x60, 0xff, 0x08, 0x00, 0x00, 0x00, 0x80, 0xff, 0x60, 0xff, 0x8e, 0x66, 0x66, 0x66, 0xe8, 0xff,
+    0x60, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x60, 0xff, 0x8e, 0x66, 0x66, 0x66, 0xe8, 0xff, 0x60, 0xff, 0x08, 0x00, 0x00, 0x00, 0x80, 0xff,
+    0x40, 0xff, 0x04, 0x00, 0x00, 0x00, 0x40, 0xff, 0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'J' (74)
+    0x00, 0x10, 0xf6, 0x6f, 0x00, 0x00, 0x00, 0x66, 0x00, 0xb1, 0xfd, 0x6f, 0x00, 0x00, 0x40, 0xff,
+    0x00, 0xd6, 0x7b, 0x04, 0x00, 0x00, 0x60, 0xff, 0x40, 0xff, 0x07, 0x00, 0x00, 0x00, 0x60, 0xff,
+    0x40, 0xff, 0x07, 0x00, 0x00, 0x00, 0x80, 0xff, 0x00, 0xd6, 0x7b, 0x66, 0x66, 0x66, 0xe8, 0xff,
+    0x00, 0xb1, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x10, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0x00, 0x40, 0x66, 0x66, 0x66, 0xd8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x68,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'K' (75)
+    0x00, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6f, 0x00, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6f,
+    0x00, 0x40, 0x66, 0xe8, 0xff, 0x8e, 0x66, 0x04, 0x00, 0x00, 0x00, 0x80, 0xff, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x70, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb1, 0xff, 0x1b, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0x80, 0xff, 0x08, 0x01, 0x00, 0x00, 0x40, 0xb7, 0x08, 0x44, 0x80, 0x7b, 0x04,
+    0x00, 0xf6, 0xdf, 0x1b, 0x00, 0xb1, 0xfd, 0x6f, 0x00, 0xf6, 0x6f, 0x01, 0x00, 0x10, 0xf6, 0x6f,
+    0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'L' (76)
+    0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6f, 0x40, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6f,
+    0x60, 0xff, 0x8e, 0x66, 0x66, 0x66, 0x66, 0x04, 0x60, 0xff, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x60, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x60, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'M' (77)
+    0x00, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6f, 0x00, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f,
+    0x00, 0x40, 0x66, 0x66, 0x97, 0xfc, 0xff, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x70, 0xfc, 0x8d, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0xf6, 0xff, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf6, 0xff, 0x4f, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x70, 0xfc, 0x8d, 0x03, 0x00, 0x40, 0x66, 0x66, 0x97, 0xfc, 0xff, 0x3c,
+    0x00, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0x00, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6f,
+    0x00, 0x40, 0x66, 0x66, 0x66, 0x66, 0x66, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'N' (78)
+    0x00, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6f, 0x00, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f,
+    0x00, 0x40, 0x66, 0x66, 0x66, 0xfa, 0xff, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x8d, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x80, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb1, 0x08, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0xd8, 0x4f, 0x00, 0x00, 0x00, 0x40, 0x66, 0xd8, 0xff, 0xaf, 0x66, 0x04,
+    0x00, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6f, 0x00, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6f,
+    0x00, 0x40, 0x66, 0x66, 0x66, 0x66, 0x66, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'O' (79)
+    0x00, 0x10, 0xf6, 0xff, 0xff, 0xff, 0x6f, 0x01, 0x00, 0xb1, 0xfd, 0xff, 0xff, 0xff, 0xdf, 0x1b,
+    0x00, 0xd6, 0x7b, 0x66, 0x66, 0x66, 0xb7, 0x6d, 0x40, 0xff, 0x07, 0x00, 0x00, 0x00, 0x70, 0xff,
+    0x60, 0xff, 0x06, 0x00, 0x00, 0x00, 0x60, 0xff, 0x60, 0xff, 0x06, 0x00, 0x00, 0x00, 0x60, 0xff,
+    0x40, 0xff, 0x07, 0x00, 0x00, 0x00, 0x70, 0xff, 0x00, 0xd6, 0x7b, 0x66, 0x66, 0x66, 0xb7, 0x6d,
+    0x00, 0xb1, 0xfd, 0xff, 0xff, 0xff, 0xdf, 0x1b, 0x00, 0x10, 0xf6, 0xff, 0xff, 0xff, 0x6f, 0x01,
+    0x00, 0x00, 0x40, 0x66, 0x66, 0x66, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'P' (80)
+    0x00, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0x00, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0x40, 0x66, 0xe8, 0xff, 0x8e, 0xe8, 0xff, 0x00, 0x00, 0x00, 0x80, 0xff, 0x08, 0x80, 0xff,
+    0x00, 0x00, 0x00, 0x60, 0xff, 0x06, 0x60, 0xff, 0x00, 0x00, 0x00, 0x60, 0xff, 0x06, 0x60, 0xff,
+    0x00, 0x00, 0x00, 0x40, 0xff, 0x07, 0x70, 0xff, 0x00, 0x00, 0x00, 0x00, 0xd6, 0x7b, 0xb7, 0x6d,
+    0x00, 0x00, 0x00, 0x00, 0xb1, 0xfd, 0xdf, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x10, 0xf6, 0x6f, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'Q' (81)
+    0x00, 0x10, 0xf6, 0xff, 0xff, 0xff, 0x6f, 0x01, 0x00, 0xb1, 0xfd, 0xff, 0xff, 0xff, 0xdf, 0x1b,
+    0x00, 0xd6, 0xaf, 0x66, 0x66, 0x66, 0xb7, 0x6d, 0x40, 0xff, 0x6f, 0x00, 0x00, 0x00, 0x70, 0xff,
+    0x60, 0xff, 0x8f, 0x00, 0x00, 0x00, 0x60, 0xff, 0x60, 0xff, 0x8f, 0x00, 0x00, 0x00, 0x60, 0xff,
+    0x40, 0xff, 0x6f, 0x00, 0x00, 0x00, 0x70, 0xff, 0x00, 0xd6, 0xaf, 0x66, 0x66, 0x66, 0xb7, 0x6d,
+    0x00, 0xb1, 0xfd, 0xff, 0xff, 0xff, 0xdf, 0x1b, 0x00, 0x10, 0xf6, 0xff, 0xff, 0xff, 0x6f, 0x01,
+    0x00, 0x00, 0x40, 0x66, 0x66, 0x66, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'R' (82)
+    0x00, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0x00, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0x40, 0xe8, 0xff, 0x8e, 0x66, 0xe8, 0xff, 0x00, 0x00, 0x80, 0xff, 0x08, 0x00, 0x80, 0xff,
+    0x00, 0x00, 0x60, 0xff, 0x06, 0x00, 0x60, 0xff, 0x00, 0x00, 0x60, 0xff, 0x06, 0x00, 0x60, 0xff,
+    0x00, 0x00, 0x70, 0xff, 0x07, 0x00, 0x70, 0xff, 0x00, 0x40, 0xb7, 0xff, 0x7b, 0x66, 0xb7, 0x6d,
+    0x00, 0xf6, 0xdf, 0xff, 0xfd, 0xff, 0xdf, 0x1b, 0x00, 0xf6, 0x6f, 0x44, 0xf6, 0xff, 0x6f, 0x01,
+    0x00, 0x40, 0x04, 0x00, 0x40, 0x66, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'S' (83)
+    0x00, 0x66, 0x00, 0x00, 0x10, 0xf6, 0x6f, 0x01, 0x40, 0xff, 0x04, 0x00, 0xb1, 0xfd, 0xdf, 0x1b,
+    0x60, 0xff, 0x06, 0x00, 0xd6, 0x7b, 0xb7, 0x6d, 0x60, 0xff, 0x06, 0x40, 0xff, 0x07, 0x70, 0xff,
+    0x60, 0xff, 0x06, 0x60, 0xff, 0x06, 0x60, 0xff, 0x60, 0xff, 0x06, 0x60, 0xff, 0x06, 0x60, 0xff,
+    0x40, 0xff, 0x07, 0x70, 0xff, 0x04, 0x60, 0xff, 0x00, 0xd6, 0x7b, 0xb7, 0x6d, 0x00, 0x60, 0xff,
+    0x00, 0xb1, 0xfd, 0xdf, 0x1b, 0x00, 0x40, 0xff, 0x00, 0x10, 0xf6, 0x6f, 0x01, 0x00, 0x00, 0x66,
+    0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'T' (84)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x00, 0x40, 0x66, 0x66, 0x66, 0x66, 0xe8, 0xff,
+    0x00, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0x40, 0x66, 0x66, 0x66, 0x66, 0xe8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'U' (85)
+    0x00, 0x10, 0xf6, 0xff, 0xff, 0xff, 0xff, 0x6f, 0x00, 0xb1, 0xfd, 0xff, 0xff, 0xff, 0xff, 0x6f,
+    0x00, 0xd6, 0x7b, 0x66, 0x66, 0x66, 0x66, 0x04, 0x40, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x60, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0x7b, 0x66, 0x66, 0x66, 0x66, 0x04,
+    0x00, 0xb1, 0xfd, 0xff, 0xff, 0xff, 0xff, 0x6f, 0x00, 0x10, 0xf6, 0xff, 0xff, 0xff, 0xff, 0x6f,
+    0x00, 0x00, 0x40, 0x66, 0x66, 0x66, 0x66, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'V' (86)
+    0x00, 0x00, 0x10, 0xf6, 0xff, 0xff, 0xff, 0x6f, 0x00, 0x00, 0xb1, 0xfd, 0xff, 0xff, 0xff, 0x6f,
+    0x00, 0x10, 0x80, 0x7b, 0x66, 0x66, 0x66, 0x04, 0x00, 0xb1, 0x08, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xb0, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xb1, 0x08, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x80, 0x7b, 0x66, 0x66, 0x66, 0x04,
+    0x00, 0x00, 0xb1, 0xfd, 0xff, 0xff, 0xff, 0x6f, 0x00, 0x00, 0x10, 0xf6, 0xff, 0xff, 0xff, 0x6f,
+    0x00, 0x00, 0x00, 0x40, 0x66, 0x66, 0x66, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'W' (87)
+    0x00, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6f, 0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6f,
+    0x00, 0xc3, 0xff, 0xcf, 0x79, 0x66, 0x66, 0x04, 0x00, 0x30, 0xd8, 0xcf, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xf4, 0xff, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0x6f, 0x00, 0x00, 0x00,
+    0x00, 0x30, 0xd8, 0xcf, 0x07, 0x00, 0x00, 0x00, 0x00, 0xc3, 0xff, 0xcf, 0x79, 0x66, 0x66, 0x04,
+    0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6f, 0x00, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6f,
+    0x00, 0x40, 0x66, 0x66, 0x66, 0x66, 0x66, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'X' (88)
+    0x00, 0xf6, 0x6f, 0x01, 0x00, 0x10, 0xf6, 0x6f, 0x00, 0xf6, 0xdf, 0x1b, 0x00, 0xb1, 0xfd, 0x6f,
+    0x00, 0x40, 0xb7, 0x08, 0x44, 0x80, 0x7b, 0x04, 0x00, 0x00, 0x10, 0x80, 0xff, 0x08, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0xf4, 0xee, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xee, 0x4f, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0x80, 0xff, 0x08, 0x01, 0x00, 0x00, 0x40, 0xb7, 0x08, 0x44, 0x80, 0x7b, 0x04,
+    0x00, 0xf6, 0xdf, 0x1b, 0x00, 0xb1, 0xfd, 0x6f, 0x00, 0xf6, 0x6f, 0x01, 0x00, 0x10, 0xf6, 0x6f,
+    0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'Y' (89)
+    0x00, 0x00, 0x00, 0x00, 0x10, 0xf6, 0xff, 0x6f, 0x00, 0x00, 0x00, 0x00, 0xb1, 0xfd, 0xff, 0x6f,
+    0x00, 0x00, 0x00, 0x10, 0x80, 0x7b, 0x66, 0x04, 0x00, 0x40, 0x66, 0xb7, 0x08, 0x01, 0x00, 0x00,
+    0x00, 0xf6, 0xff, 0xff, 0x4f, 0x00, 0x00, 0x00, 0x00, 0xf6, 0xff, 0xff, 0x4f, 0x00, 0x00, 0x00,
+    0x00, 0x40, 0x66, 0xb7, 0x08, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x80, 0x7b, 0x66, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0xb1, 0xfd, 0xff, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x10, 0xf6, 0xff, 0x6f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x66, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'Z' (90)
+    0x00, 0xf8, 0x6f, 0x01, 0x00, 0x00, 0x00, 0x66, 0x40, 0xff, 0xdf, 0x1b, 0x00, 0x00, 0x40, 0xff,
+    0x60, 0xff, 0xff, 0x08, 0x01, 0x00, 0x60, 0xff, 0x60, 0xff, 0x4a, 0x80, 0x1b, 0x00, 0x60, 0xff,
+    0x60, 0xff, 0x06, 0xb1, 0x08, 0x01, 0x60, 0xff, 0x60, 0xff, 0x06, 0x10, 0x80, 0x1b, 0x60, 0xff,
+    0x60, 0xff, 0x06, 0x00, 0xb1, 0x08, 0xa4, 0xff, 0x60, 0xff, 0x06, 0x00, 0x10, 0x80, 0xff, 0xff,
+    0x40, 0xff, 0x04, 0x00, 0x00, 0xb1, 0xfd, 0xff, 0x00, 0x66, 0x00, 0x00, 0x00, 0x10, 0xf6, 0x8f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '[' (91)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x66, 0x66, 0x66, 0x66, 0x66, 0x04,
+    0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0x40, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x60, 0xff, 0x8e, 0x66, 0x66, 0x66, 0xe8, 0xff, 0x60, 0xff, 0x08, 0x00, 0x00, 0x00, 0x80, 0xff,
+    0x40, 0xff, 0x04, 0x00, 0x00, 0x00, 0x40, 0xff, 0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '\\' (92)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xf6, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb1, 0xfd, 0x6f,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x80, 0x7b, 0x04, 0x00, 0x00, 0x00, 0x00, 0xb1, 0x08, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0x80, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb1, 0x08, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0x80, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x40, 0xb7, 0x08, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0xf6, 0xdf, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf6, 0x6f, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // ']' (93)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x40, 0xff, 0x04, 0x00, 0x00, 0x00, 0x40, 0xff,
+    0x60, 0xff, 0x08, 0x00, 0x00, 0x00, 0x80, 0xff, 0x60, 0xff, 0x8e, 0x66, 0x66, 0x66, 0xe8, 0xff,
+    0x40, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f,
+    0x00, 0x40, 0x66, 0x66, 0x66, 0x66, 0x66, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '^' (94)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1b, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xb1, 0x08, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x80, 0x1b,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x0b,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x80, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb1, 0x08, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '_' (95)
+    0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x60, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x60, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x60, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '`' (96)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'a' (97)
+    0x00, 0x10, 0x00, 0x01, 0x00, 0x66, 0x00, 0x00, 0x00, 0xb1, 0xbb, 0x1b, 0x40, 0xff, 0x04, 0x00,
+    0x00, 0xd6, 0xff, 0x6d, 0x70, 0xff, 0x06, 0x00, 0x40, 0xff, 0xcc, 0xff, 0x97, 0xff, 0x06, 0x00,
+    0x60, 0xff, 0x99, 0xff, 0x99, 0xff, 0x06, 0x00, 0x60, 0xff, 0x99, 0xff, 0x99, 0xff, 0x06, 0x00,
+    0x60, 0xff, 0xcc, 0xff, 0xcc, 0xff, 0x04, 0x00, 0x60, 0xff, 0xff, 0xff, 0xff, 0x6d, 0x00, 0x00,
+    0x40, 0xff, 0xff, 0xff, 0xdf, 0x1b, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xff, 0x6f, 0x01, 0x00, 0x00,
+    0x00, 0x40, 0x66, 0x66, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'b' (98)
+    0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6f, 0x40, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6f,
+    0x60, 0xff, 0x8e, 0x66, 0xe8, 0xff, 0x8e, 0x04, 0x60, 0xff, 0x08, 0x00, 0x80, 0xff, 0x08, 0x00,
+    0x60, 0xff, 0x06, 0x00, 0x60, 0xff, 0x06, 0x00, 0x60, 0xff, 0x06, 0x00, 0x60, 0xff, 0x06, 0x00,
+    0x40, 0xff, 0x07, 0x00, 0x70, 0xff, 0x04, 0x00, 0x00, 0xd6, 0x7b, 0x66, 0xb7, 0x6d, 0x00, 0x00,
+    0x00, 0xb1, 0xfd, 0xff, 0xdf, 0x1b, 0x00, 0x00, 0x00, 0x10, 0xf6, 0xff, 0x6f, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x40, 0x66, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'c' (99)
+    0x00, 0x10, 0xf6, 0xff, 0x6f, 0x01, 0x00, 0x00, 0x00, 0xb1, 0xfd, 0xff, 0xdf, 0x1b, 0x00, 0x00,
+    0x00, 0xd6, 0x7b, 0x66, 0xb7, 0x6d, 0x00, 0x00, 0x40, 0xff, 0x07, 0x00, 0x70, 0xff, 0x04, 0x00,
+    0x60, 0xff, 0x06, 0x00, 0x60, 0xff, 0x06, 0x00, 0x60, 0xff, 0x06, 0x00, 0x60, 0xff, 0x06, 0x00,
+    0x60, 0xff, 0x06, 0x00, 0x70, 0xff, 0x04, 0x00, 0x60, 0xff, 0x06, 0x00, 0xb1, 0x6d, 0x00, 0x00,
+    0x40, 0xff, 0x04, 0x00, 0x80, 0x1b, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'd' (100)
+    0x00, 0x10, 0xf6, 0xff, 0x6f, 0x01, 0x00, 0x00, 0x00, 0xb1, 0xfd, 0xff, 0xdf, 0x1b, 0x00, 0x00,
+    0x00, 0xd6, 0x7b, 0x66, 0xb7, 0x6d, 0x00, 0x00, 0x40, 0xff, 0x07, 0x00, 0x70, 0xff, 0x04, 0x00,
+    0x60, 0xff, 0x06, 0x00, 0x60, 0xff, 0x06, 0x00, 0x60, 0xff, 0x06, 0x00, 0x60, 0xff, 0x06, 0x00,
+    0x60, 0xff, 0x08, 0x00, 0x80, 0xff, 0x08, 0x00, 0x60, 0xff, 0x8e, 0x66, 0xe8, 0xff, 0x8e, 0x04,
+    0x40, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6f, 0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6f,
+    0x00, 0x40, 0x66, 0x66, 0x66, 0x66, 0x66, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'e' (101)
+    0x00, 0x10, 0xf6, 0xff, 0x6f, 0x01, 0x00, 0x00, 0x00, 0xb1, 0xfd, 0xff, 0xdf, 0x1b, 0x00, 0x00,
+    0x00, 0xd6, 0xff, 0xff, 0xff, 0x6d, 0x00, 0x00, 0x40, 0xff, 0xcc, 0xff, 0xcc, 0xff, 0x04, 0x00,
+    0x60, 0xff, 0x99, 0xff, 0x99, 0xff, 0x06, 0x00, 0x60, 0xff, 0x99, 0xff, 0x99, 0xff, 0x06, 0x00,
+    0x60, 0xff, 0x99, 0xff, 0xcc, 0xff, 0x04, 0x00, 0x60, 0xff, 0x99, 0xff, 0xff, 0x6d, 0x00, 0x00,
+    0x40, 0xff, 0x77, 0xff, 0xdf, 0x1b, 0x00, 0x00, 0x00, 0x66, 0x00, 0xf8, 0x6f, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'f' (102)
+    0x00, 0x00, 0x00, 0x30, 0x88, 0x03, 0x00, 0x00, 0x00, 0x40, 0x66, 0xd8, 0xff, 0x8d, 0x04, 0x00,
+    0x00, 0xf6, 0xff, 0xff, 0xff, 0xff, 0x6f, 0x01, 0x00, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x1b,
+    0x00, 0x40, 0x66, 0xe8, 0xff, 0x8e, 0xb7, 0x6d, 0x00, 0x00, 0x00, 0x80, 0xff, 0x08, 0x70, 0xff,
+    0x00, 0x00, 0x00, 0x40, 0xff, 0x04, 0x60, 0xff, 0x00, 0x00, 0x00, 0x00, 0x66, 0x00, 0x60, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'g' (103)
+    0x00, 0x10, 0xf6, 0x6f, 0x64, 0xf9, 0x6f, 0x01, 0x00, 0xb1, 0xfd, 0xdf, 0xff, 0xff, 0xdf, 0x1b,
+    0x00, 0xd6, 0x8b, 0xfa, 0xff, 0xff, 0xff, 0x6d, 0x40, 0xff, 0x28, 0xf4, 0xff, 0xff, 0xcc, 0xff,
+    0x60, 0xff, 0x07, 0xd6, 0xff, 0xff, 0xcc, 0xff, 0x60, 0xff, 0x79, 0xff, 0xcc, 0xff, 0xff, 0xff,
+    0x40, 0xff, 0xcc, 0xff, 0x79, 0xff, 0xff, 0xff, 0x00, 0xd6, 0xff, 0xff, 0x07, 0xf8, 0xff, 0xff,
+    0x00, 0xb1, 0xfd, 0xff, 0x04, 0x40, 0xd8, 0xff, 0x00, 0x10, 0xf6, 0x8f, 0x00, 0x00, 0x30, 0x68,
+    0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'h' (104)
+    0x00, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6f, 0x00, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6f,
+    0x00, 0x40, 0x66, 0xd8, 0xff, 0xaf, 0x66, 0x04, 0x00, 0x00, 0x00, 0x30, 0xd8, 0x4f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xb1, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xff, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x70, 0xff, 0x04, 0x00, 0x00, 0x40, 0x66, 0x66, 0xb7, 0x6d, 0x00, 0x00,
+    0x00, 0xf6, 0xff, 0xff, 0xdf, 0x1b, 0x00, 0x00, 0x00, 0xf6, 0xff, 0xff, 0x6f, 0x01, 0x00, 0x00,
+    0x00, 0x40, 0x66, 0x66, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'i' (105)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x86, 0x03, 0x00, 0x30, 0x68, 0x00, 0x00, 0x40, 0xff, 0x8d, 0x66, 0xd8, 0xff, 0x04, 0x00,
+    0x60, 0xff, 0xff, 0xff, 0xff, 0xff, 0x04, 0x00, 0x60, 0xff, 0xff, 0xff, 0xff, 0x8f, 0x00, 0x00,
+    0x40, 0xff, 0x8d, 0x66, 0x66, 0x04, 0x00, 0x00, 0x00, 0x86, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'j' (106)
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb1, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xd6, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0x7b, 0x66, 0x66, 0x04, 0x00, 0x00,
+    0x00, 0xb1, 0xfd, 0xff, 0xff, 0x6f, 0x00, 0x00, 0x00, 0x10, 0xf6, 0xff, 0xff, 0x6f, 0x00, 0x00,
+    0x00, 0x00, 0x40, 0x66, 0x66, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'k' (107)
+    0x00, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6f, 0x00, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6f,
+    0x00, 0x40, 0x66, 0xe8, 0xff, 0x8e, 0x66, 0x04, 0x00, 0x00, 0x00, 0x80, 0xff, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x70, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb1, 0xff, 0x1b, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0x80, 0xff, 0x08, 0x01, 0x00, 0x00, 0x40, 0xb7, 0x08, 0x44, 0x80, 0x1b, 0x00,
+    0x00, 0xf6, 0xdf, 0x1b, 0x00, 0xb1, 0x08, 0x00, 0x00, 0xf6, 0x6f, 0x01, 0x00, 0x10, 0x00, 0x00,
+    0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'l' (108)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x86, 0x03, 0x00, 0x00, 0x00, 0x30, 0x68, 0x40, 0xff, 0x8d, 0x66, 0x66, 0x66, 0xd8, 0xff,
+    0x60, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f,
+    0x60, 0xff, 0x8e, 0x66, 0x66, 0x66, 0x66, 0x04, 0x60, 0xff, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'm' (109)
+    0x00, 0xf6, 0xff, 0xff, 0xff, 0x8f, 0x00, 0x00, 0x00, 0xf6, 0xff, 0xff, 0xff, 0xff, 0x04, 0x00,
+    0x00, 0x70, 0x99, 0x99, 0xfc, 0xff, 0x04, 0x00, 0x00, 0x70, 0x99, 0x99, 0xfc, 0x6d, 0x00, 0x00,
+    0x00, 0xf6, 0xff, 0xff, 0xff, 0x4f, 0x00, 0x00, 0x00, 0xf6, 0xff, 0xff, 0xff, 0x4f, 0x00, 0x00,
+    0x00, 0x70, 0x99, 0x99, 0xfc, 0x6d, 0x00, 0x00, 0x00, 0x70, 0x99, 0x99, 0xfc, 0xff, 0x04, 0x00,
+    0x00, 0xf6, 0xff, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0xf6, 0xff, 0xff, 0xff, 0x8f, 0x00, 0x00,
+    0x00, 0x40, 0x66, 0x66, 0x66, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'n' (110)
+    0x00, 0xf6, 0xff, 0xff, 0xff, 0x6f, 0x00, 0x00, 0x00, 0xf6, 0xff, 0xff, 0xff, 0x8f, 0x00, 0x00,
+    0x00, 0x40, 0x66, 0xd8, 0xff, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xd8, 0x4f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xb1, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xff, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x70, 0xff, 0x04, 0x00, 0x00, 0x40, 0x66, 0x66, 0xb7, 0x6d, 0x00, 0x00,
+    0x00, 0xf6, 0xff, 0xff, 0xdf, 0x1b, 0x00, 0x00, 0x00, 0xf6, 0xff, 0xff, 0x6f, 0x01, 0x00, 0x00,
+    0x00, 0x40, 0x66, 0x66, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'o' (111)
+    0x00, 0x10, 0xf6, 0xff, 0x6f, 0x01, 0x00, 0x00, 0x00, 0xb1, 0xfd, 0xff, 0xdf, 0x1b, 0x00, 0x00,
+    0x00, 0xd6, 0x7b, 0x66, 0xb7, 0x6d, 0x00, 0x00, 0x40, 0xff, 0x07, 0x00, 0x70, 0xff, 0x04, 0x00,
+    0x60, 0xff, 0x06, 0x00, 0x60, 0xff, 0x06, 0x00, 0x60, 0xff, 0x06, 0x00, 0x60, 0xff, 0x06, 0x00,
+    0x40, 0xff, 0x07, 0x00, 0x70, 0xff, 0x04, 0x00, 0x00, 0xd6, 0x7b, 0x66, 0xb7, 0x6d, 0x00, 0x00,
+    0x00, 0xb1, 0xfd, 0xff, 0xdf, 0x1b, 0x00, 0x00, 0x00, 0x10, 0xf6, 0xff, 0x6f, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x40, 0x66, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'p' (112)
+    0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x8f, 0x00, 0x40, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x04,
+    0x40, 0xff, 0xff, 0xff, 0x8e, 0xe8, 0xff, 0x06, 0x00, 0x86, 0xa6, 0xff, 0x08, 0x80, 0xff, 0x06,
+    0x00, 0x00, 0x60, 0xff, 0x06, 0x60, 0xff, 0x06, 0x00, 0x00, 0x60, 0xff, 0x06, 0x60, 0xff, 0x06,
+    0x00, 0x00, 0x40, 0xff, 0x07, 0x70, 0xff, 0x04, 0x00, 0x00, 0x00, 0xd6, 0x7b, 0xb7, 0x6d, 0x00,
+    0x00, 0x00, 0x00, 0xb1, 0xfd, 0xdf, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x10, 0xf6, 0x6f, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'q' (113)
+    0x00, 0x00, 0x00, 0x10, 0xf6, 0x6f, 0x01, 0x00, 0x00, 0x00, 0x00, 0xb1, 0xfd, 0xdf, 0x1b, 0x00,
+    0x00, 0x00, 0x00, 0xd6, 0x7b, 0xb7, 0x6d, 0x00, 0x00, 0x00, 0x40, 0xff, 0x07, 0x70, 0xff, 0x04,
+    0x00, 0x00, 0x60, 0xff, 0x06, 0x60, 0xff, 0x06, 0x00, 0x00, 0x60, 0xff, 0x06, 0x60, 0xff, 0x06,
+    0x00, 0x86, 0xa6, 0xff, 0x08, 0x80, 0xff, 0x06, 0x40, 0xff, 0xff, 0xff, 0x8e, 0xe8, 0xff, 0x06,
+    0x40, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x04, 0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x8f, 0x00,
+    0x00, 0x40, 0x66, 0x66, 0x66, 0x66, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'r' (114)
+    0x00, 0x86, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x8d, 0x66, 0x66, 0x04, 0x00, 0x00,
+    0x60, 0xff, 0xff, 0xff, 0xff, 0x6f, 0x00, 0x00, 0x60, 0xff, 0xff, 0xff, 0xff, 0x8f, 0x00, 0x00,
+    0x40, 0xff, 0x8d, 0xd8, 0xff, 0x6f, 0x00, 0x00, 0x00, 0x86, 0x03, 0x30, 0xd8, 0x4f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xf4, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x0b, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 's' (115)
+    0x00, 0x66, 0x00, 0x10, 0x00, 0x01, 0x00, 0x00, 0x40, 0xff, 0x04, 0xb1, 0xbb, 0x1b, 0x00, 0x00,
+    0x60, 0xff, 0x07, 0xd6, 0xff, 0x6d, 0x00, 0x00, 0x60, 0xff, 0x79, 0xff, 0xcc, 0xff, 0x04, 0x00,
+    0x60, 0xff, 0x99, 0xff, 0x99, 0xff, 0x06, 0x00, 0x60, 0xff, 0x99, 0xff, 0x99, 0xff, 0x06, 0x00,
+    0x40, 0xff, 0xcc, 0xff, 0x97, 0xff, 0x06, 0x00, 0x00, 0xd6, 0xff, 0x6d, 0x70, 0xff, 0x06, 0x00,
+    0x00, 0xb1, 0xbb, 0x1b, 0x40, 0xff, 0x04, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00, 0x66, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 't' (116)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x66, 0x66, 0x66, 0x66, 0x04,
+    0x00, 0x10, 0xf6, 0xff, 0xff, 0xff, 0xff, 0x6f, 0x00, 0xb1, 0xfd, 0xff, 0xff, 0xff, 0xff, 0x6f,
+    0x00, 0xd6, 0x7b, 0x66, 0xe8, 0xff, 0x8e, 0x04, 0x40, 0xff, 0x07, 0x00, 0x80, 0xff, 0x08, 0x00,
+    0x40, 0xff, 0x07, 0x00, 0x40, 0xff, 0x04, 0x00, 0x00, 0xd6, 0x1b, 0x00, 0x00, 0x66, 0x00, 0x00,
+    0x00, 0xb1, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'u' (117)
+    0x00, 0x10, 0xf6, 0xff, 0xff, 0x6f, 0x00, 0x00, 0x00, 0xb1, 0xfd, 0xff, 0xff, 0x6f, 0x00, 0x00,
+    0x00, 0xd6, 0x7b, 0x66, 0x66, 0x04, 0x00, 0x00, 0x40, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xf4, 0x8d, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf6, 0xff, 0x8d, 0x66, 0x04, 0x00, 0x00,
+    0x00, 0xf8, 0xff, 0xff, 0xff, 0x6f, 0x00, 0x00, 0x00, 0xf6, 0xff, 0xff, 0xff, 0x6f, 0x00, 0x00,
+    0x00, 0x40, 0x66, 0x66, 0x66, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'v' (118)
+    0x00, 0x00, 0x10, 0xf6, 0xff, 0x6f, 0x00, 0x00, 0x00, 0x00, 0xb1, 0xfd, 0xff, 0x6f, 0x00, 0x00,
+    0x00, 0x10, 0x80, 0x7b, 0x66, 0x04, 0x00, 0x00, 0x00, 0xb1, 0x08, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xb0, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xb1, 0x08, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x80, 0x7b, 0x66, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0xb1, 0xfd, 0xff, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x10, 0xf6, 0xff, 0x6f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0x66, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'w' (119)
+    0x00, 0x10, 0xf6, 0xff, 0xff, 0x6f, 0x00, 0x00, 0x00, 0xb1, 0xfd, 0xff, 0xff, 0x6f, 0x00, 0x00,
+    0x00, 0xb0, 0xcf, 0x79, 0x66, 0x04, 0x00, 0x00, 0x00, 0xb0, 0xcf, 0x07, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xf4, 0xff, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0x6f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xb0, 0xcf, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0xcf, 0x79, 0x66, 0x04, 0x00, 0x00,
+    0x00, 0xb1, 0xfd, 0xff, 0xff, 0x6f, 0x00, 0x00, 0x00, 0x10, 0xf6, 0xff, 0xff, 0x6f, 0x00, 0x00,
+    0x00, 0x00, 0x40, 0x66, 0x66, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'x' (120)
+    0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1b, 0x00, 0xb1, 0x08, 0x00, 0x00,
+    0x00, 0xb1, 0x08, 0x44, 0x80, 0x1b, 0x00, 0x00, 0x00, 0x10, 0x80, 0xff, 0x08, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0xf4, 0xee, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xee, 0x4f, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0x80, 0xff, 0x08, 0x01, 0x00, 0x00, 0x00, 0xb1, 0x08, 0x44, 0x80, 0x1b, 0x00, 0x00,
+    0x00, 0x80, 0x1b, 0x00, 0xb1, 0x08, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'y' (121)
+    0x00, 0x66, 0x00, 0xf8, 0xff, 0xff, 0x6f, 0x00, 0x40, 0xff, 0x77, 0xff, 0xff, 0xff, 0x6f, 0x00,
+    0x60, 0xff, 0x99, 0xff, 0x8e, 0x66, 0x04, 0x00, 0x60, 0xff, 0x99, 0xff, 0x08, 0x00, 0x00, 0x00,
+    0x60, 0xff, 0x99, 0xff, 0x06, 0x00, 0x00, 0x00, 0x60, 0xff, 0x99, 0xff, 0x06, 0x00, 0x00, 0x00,
+    0x40, 0xff, 0xcc, 0xff, 0x08, 0x00, 0x00, 0x00, 0x00, 0xd6, 0xff, 0xff, 0x8e, 0x66, 0x04, 0x00,
+    0x00, 0xb1, 0xfd, 0xff, 0xff, 0xff, 0x6f, 0x00, 0x00, 0x10, 0xf6, 0xff, 0xff, 0xff, 0x6f, 0x00,
+    0x00, 0x00, 0x40, 0x66, 0x66, 0x66, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'z' (122)
+    0x00, 0x86, 0x03, 0x00, 0x00, 0x66, 0x00, 0x00, 0x40, 0xff, 0x3c, 0x00, 0x40, 0xff, 0x04, 0x00,
+    0x60, 0xff, 0x8f, 0x01, 0x60, 0xff, 0x06, 0x00, 0x60, 0xff, 0xdf, 0x1b, 0x60, 0xff, 0x06, 0x00,
+    0x60, 0xff, 0xff, 0x08, 0xa4, 0xff, 0x06, 0x00, 0x60, 0xff, 0x4a, 0x80, 0xff, 0xff, 0x06, 0x00,
+    0x60, 0xff, 0x06, 0xb1, 0xfd, 0xff, 0x06, 0x00, 0x60, 0xff, 0x06, 0x10, 0xf8, 0xff, 0x06, 0x00,
+    0x40, 0xff, 0x04, 0x00, 0xc3, 0xff, 0x04, 0x00, 0x00, 0x66, 0x00, 0x00, 0x30, 0x68, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '{' (123)
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x40, 0xb7, 0xbb, 0x7b, 0x04, 0x00,
+    0x00, 0x10, 0xf6, 0xdf, 0xff, 0xfd, 0x6f, 0x01, 0x00, 0xb1, 0xfd, 0x6f, 0x44, 0xf6, 0xdf, 0x1b,
+    0x00, 0xd6, 0x7b, 0x04, 0x00, 0x40, 0xb7, 0x6d, 0x40, 0xff, 0x07, 0x00, 0x00, 0x00, 0x70, 0xff,
+    0x40, 0xff, 0x07, 0x00, 0x00, 0x00, 0x70, 0xff, 0x00, 0xd6, 0x1b, 0x00, 0x00, 0x00, 0xb1, 0x6d,
+    0x00, 0xb1, 0x08, 0x00, 0x00, 0x00, 0x80, 0x1b, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '|' (124)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x66, 0x66, 0x66, 0x66, 0x66, 0x04,
+    0x00, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6f, 0x00, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6f,
+    0x00, 0x40, 0x66, 0x66, 0x66, 0x66, 0x66, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '}' (125)
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xb1, 0x08, 0x00, 0x00, 0x00, 0x80, 0x1b,
+    0x00, 0xd6, 0x1b, 0x00, 0x00, 0x00, 0xb1, 0x6d, 0x40, 0xff, 0x07, 0x00, 0x00, 0x00, 0x70, 0xff,
+    0x40, 0xff, 0x07, 0x00, 0x00, 0x00, 0x70, 0xff, 0x00, 0xd6, 0x7b, 0x04, 0x00, 0x40, 0xb7, 0x6d,
+    0x00, 0xb1, 0xfd, 0x6f, 0x44, 0xf6, 0xdf, 0x1b, 0x00, 0x10, 0xf6, 0xdf, 0xff, 0xfd, 0x6f, 0x01,
+    0x00, 0x00, 0x40, 0xb7, 0xbb, 0x7b, 0x04, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '~' (126)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1b, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xf4, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x0b, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xb0, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x4f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xb1, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '°' (176)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  }
+};
@@ -0,0 +1,1355 @@
+/*
+ * Filename: aa_20x28_2.c
+ * Description: font_dot_20x28 anti-aliased, 2-bpp, 24x32 cells, 192 bytes per glyph.
+ *              Generated by Tools/aafont.py, do not edit.
+ */
+
+#include "aafont.h"
+
+
+const uint8_t aa_20x28_2[96][192] = {
+  { // ' ' (32)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '!' (33)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xaa, 0xaa, 0xaa, 0x06,
+    0x00, 0x00, 0x00, 0xf4, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xff, 0xff, 0x2f,
+    0x00, 0x00, 0x00, 0xf8, 0xff, 0xff, 0xff, 0x2f, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xff, 0xff, 0x1f,
+    0x00, 0x00, 0x00, 0x90, 0xaa, 0xaa, 0xaa, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '"' (34)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xaa, 0x06,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0x2f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0x1f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x55, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x55, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0xff, 0x07,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0x2f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0x1f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xaa, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '#' (35)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x01, 0x40, 0xff, 0x01,
+    0x00, 0x00, 0xe4, 0xff, 0x1b, 0xe4, 0xff, 0x0b, 0x00, 0x90, 0xfe, 0xff, 0xbf, 0xfe, 0xff, 0x1f,
+    0x00, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f,
+    0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x00, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f,
+    0x00, 0xd0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2f, 0x00, 0x40, 0xfe, 0xff, 0xbf, 0xfe, 0xff, 0x2f,
+    0x00, 0x40, 0xfe, 0xff, 0xbf, 0xfe, 0xff, 0x2f, 0x00, 0xd0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2f,
+    0x00, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f,
+    0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x00, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f,
+    0x00, 0x90, 0xfe, 0xff, 0xbf, 0xfe, 0xff, 0x1f, 0x00, 0x00, 0xe4, 0xff, 0x1b, 0xe4, 0xff, 0x0b,
+    0x00, 0x00, 0x40, 0xff, 0x01, 0x40, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '$' (36)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x40, 0xff, 0x01, 0x90, 0xeb, 0x06, 0x00, 0x00, 0x80, 0xff, 0x02, 0xe0, 0xff, 0x0b, 0x00,
+    0x00, 0x80, 0xff, 0x07, 0xf8, 0xff, 0x2f, 0x00, 0x00, 0xd0, 0xff, 0xbf, 0xff, 0xff, 0xff, 0x01,
+    0x00, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0b, 0x00, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f,
+    0x00, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x00, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f,
+    0x00, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x00, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f,
+    0x00, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x00, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0b,
+    0x00, 0x40, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x07, 0x00, 0x00, 0xf8, 0xff, 0x2f, 0xd0, 0xff, 0x02,
+    0x00, 0x00, 0xe0, 0xff, 0x0b, 0x80, 0xff, 0x02, 0x00, 0x00, 0x90, 0xeb, 0x06, 0x40, 0xff, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '%' (37)
+    0x00, 0xf4, 0x1f, 0x00, 0x00, 0xf8, 0xff, 0x2f, 0x00, 0xf8, 0x7f, 0x00, 0x00, 0xfe, 0xff, 0xbf,
+    0x00, 0xf8, 0xff, 0x06, 0x40, 0xff, 0xff, 0xff, 0x00, 0xf4, 0xff, 0x0b, 0x80, 0xff, 0xff, 0xff,
+    0x00, 0xd0, 0xff, 0x0f, 0xd0, 0xff, 0xff, 0xff, 0x00, 0x40, 0xfe, 0x0b, 0xf9, 0xff, 0xff, 0xff,
+    0x00, 0x40, 0xfe, 0xef, 0xff, 0xff, 0xff, 0xff, 0x00, 0xd0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x40, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2f,
+    0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x07, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x01,
+    0x80, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xbf, 0x01, 0x80, 0xff, 0xff, 0xff, 0x07, 0xf8, 0xff, 0x07,
+    0x80, 0xff, 0xff, 0xff, 0x02, 0xe0, 0xff, 0x1f, 0x40, 0xff, 0xff, 0xff, 0x01, 0x90, 0xff, 0x2f,
+    0x00, 0xfe, 0xff, 0xbf, 0x00, 0x00, 0xfd, 0x2f, 0x00, 0xf8, 0xff, 0x2f, 0x00, 0x00, 0xf4, 0x1f,
+    0x00, 0x90, 0xaa, 0x06, 0x00, 0x00, 0x90, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '&' (38)
+    0x00, 0x00, 0xf4, 0x1f, 0x00, 0xf4, 0x1f, 0x00, 0x00, 0x00, 0xfd, 0x7f, 0x69, 0xfd, 0x7f, 0x00,
+    0x00, 0x90, 0xff, 0xff, 0xff, 0xff, 0xff, 0x06, 0x00, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0b,
+    0x00, 0xf4, 0xbf, 0xfe, 0xff, 0xbf, 0xfe, 0x1f, 0x00, 0xfd, 0x0b, 0xe0, 0xff, 0x0b, 0xe0, 0x7f,
+    0x40, 0xff, 0x03, 0xc0, 0xff, 0x03, 0xc0, 0xff, 0x80, 0xff, 0x02, 0x80, 0xff, 0x02, 0x80, 0xff,
+    0x80, 0xff, 0x02, 0x80, 0xff, 0x02, 0x80, 0xff, 0x40, 0xff, 0x03, 0xd0, 0xff, 0x07, 0xc0, 0xff,
+    0x00, 0xfd, 0x0b, 0xf4, 0xff, 0x1f, 0xe0, 0x7f, 0x00, 0xf4, 0xbf, 0xfe, 0xff, 0xbf, 0xfe, 0x1f,
+    0x00, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0b, 0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x06,
+    0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x00, 0xf4, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x00,
+    0x00, 0xf0, 0xbf, 0xfe, 0xff, 0xbf, 0x06, 0x00, 0x00, 0xc0, 0x06, 0xe4, 0xff, 0x1b, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // "'" (39)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x06,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x2f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x1f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '(' (40)
+    0x00, 0x00, 0xf4, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x00, 0xfd, 0xff, 0xff, 0xff, 0x7f, 0x00,
+    0x00, 0x90, 0xff, 0xff, 0xff, 0xff, 0xff, 0x06, 0x00, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0b,
+    0x00, 0xf0, 0xbf, 0xaa, 0xaa, 0xaa, 0xfe, 0x0f, 0x00, 0xc0, 0x06, 0x00, 0x00, 0x00, 0x90, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // ')' (41)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xc0, 0x06, 0x00, 0x00, 0x00, 0x90, 0x03, 0x00, 0xf0, 0xbf, 0xaa, 0xaa, 0xaa, 0xfe, 0x0f,
+    0x00, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0b, 0x00, 0x90, 0xff, 0xff, 0xff, 0xff, 0xff, 0x06,
+    0x00, 0x00, 0xfd, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xff, 0xff, 0x1f, 0x00,
+    0x00, 0x00, 0x90, 0xaa, 0xaa, 0xaa, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '*' (42)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa9, 0xff, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0xc0, 0xff, 0xff, 0x0b, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xff, 0xff, 0x1f,
+    0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xff, 0x3f, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xff, 0x3f,
+    0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xff, 0x3f, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xff, 0x3f,
+    0x00, 0x00, 0x00, 0x00, 0xf0, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xff, 0xff, 0x0b,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xa9, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '+' (43)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0xff, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xf4, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x90, 0xfe, 0xff, 0xbf, 0x06, 0x00,
+    0x00, 0x00, 0xf4, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xff, 0xff, 0x2f, 0x00,
+    0x00, 0x00, 0xf8, 0xff, 0xff, 0xff, 0x2f, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xff, 0xff, 0x1f, 0x00,
+    0x00, 0x00, 0x90, 0xfe, 0xff, 0xbf, 0x06, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0x1f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xd0, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // ',' (44)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa9, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc0, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0xe0, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x90, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xfd, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x90, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '-' (45)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '.' (46)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '/' (47)
+    0x00, 0xf4, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xf8, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0x0b, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x90, 0xfe, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xc0, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x0b, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xe0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xc0, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x0b, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xe0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xbf, 0x06,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xff, 0x2f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x1f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '0' (48)
+    0x00, 0x00, 0xf4, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x00, 0xfd, 0xff, 0xff, 0xff, 0x7f, 0x00,
+    0x00, 0x90, 0xff, 0xff, 0xff, 0xff, 0xff, 0x06, 0x00, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0b,
+    0x00, 0xf4, 0xff, 0xff, 0xff, 0xaa, 0xfe, 0x1f, 0x00, 0xfd, 0xff, 0xff, 0x7f, 0x00, 0xe0, 0x7f,
+    0x40, 0xff, 0xbf, 0xff, 0x2f, 0x00, 0xc0, 0xff, 0x80, 0xff, 0x07, 0xf8, 0x1f, 0x00, 0x80, 0xff,
+    0x80, 0xff, 0x02, 0xe0, 0x0f, 0x00, 0x80, 0xff, 0x80, 0xff, 0x02, 0x90, 0x03, 0x00, 0x80, 0xff,
+    0x80, 0xff, 0x02, 0x00, 0xc0, 0x06, 0x80, 0xff, 0x80, 0xff, 0x02, 0x00, 0xf0, 0x0b, 0x80, 0xff,
+    0x80, 0xff, 0x02, 0x00, 0xf4, 0x2f, 0xd0, 0xff, 0x40, 0xff, 0x03, 0x00, 0xf8, 0xff, 0xfe, 0xff,
+    0x00, 0xfd, 0x0b, 0x00, 0xfd, 0xff, 0xff, 0x7f, 0x00, 0xf4, 0xbf, 0xaa, 0xff, 0xff, 0xff, 0x1f,
+    0x00, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0b, 0x00, 0x90, 0xff, 0xff, 0xff, 0xff, 0xff, 0x06,
+    0x00, 0x00, 0xfd, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xff, 0xff, 0x1f, 0x00,
+    0x00, 0x00, 0x90, 0xaa, 0xaa, 0xaa, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '1' (49)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x01, 0x00, 0x00, 0x00, 0x40, 0x6f,
+    0x40, 0xff, 0x1b, 0x00, 0x00, 0x00, 0xe4, 0xff, 0x80, 0xff, 0xbf, 0xaa, 0xaa, 0xaa, 0xfe, 0xff,
+    0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2f,
+    0x80, 0xff, 0xbf, 0xaa, 0xaa, 0xaa, 0xaa, 0x06, 0x40, 0xff, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xf9, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '2' (50)
+    0x00, 0xf8, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0xff, 0xff, 0xff, 0x06, 0x00, 0xc0, 0x06, 0x80, 0xff, 0xff, 0xff, 0x0b, 0x00, 0xf0, 0x0b,
+    0x80, 0xff, 0xbf, 0xfe, 0x1f, 0x00, 0xe0, 0x1f, 0x80, 0xff, 0x1f, 0xe0, 0x7f, 0x00, 0xd0, 0x7f,
+    0x80, 0xff, 0x07, 0xc0, 0xff, 0x01, 0xc0, 0xff, 0x80, 0xff, 0x02, 0x80, 0xff, 0x02, 0x80, 0xff,
+    0x80, 0xff, 0x02, 0x80, 0xff, 0x02, 0x80, 0xff, 0x80, 0xff, 0x02, 0x80, 0xff, 0x02, 0x80, 0xff,
+    0x80, 0xff, 0x02, 0x80, 0xff, 0x02, 0x80, 0xff, 0x80, 0xff, 0x02, 0x80, 0xff, 0x02, 0x80, 0xff,
+    0x80, 0xff, 0x02, 0x80, 0xff, 0x02, 0x80, 0xff, 0x80, 0xff, 0x02, 0x40, 0xff, 0x03, 0xc0, 0xff,
+    0x80, 0xff, 0x02, 0x00, 0xfd, 0x0b, 0xe0, 0x7f, 0x80, 0xff, 0x02, 0x00, 0xf4, 0xbf, 0xfe, 0x1f,
+    0x80, 0xff, 0x02, 0x00, 0xe0, 0xff, 0xff, 0x0b, 0x40, 0xff, 0x01, 0x00, 0x90, 0xff, 0xff, 0x06,
+    0x00, 0x69, 0x00, 0x00, 0x00, 0xfd, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x1f, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '3' (51)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x90, 0x03, 0x00, 0x00, 0x00, 0xc0, 0x06, 0x00, 0xe0, 0x0f, 0x00, 0x00, 0x00, 0xf0, 0x0b,
+    0x00, 0xf4, 0x0b, 0x00, 0x00, 0x00, 0xe0, 0x1f, 0x00, 0xfd, 0x07, 0x00, 0x00, 0x00, 0xd0, 0x7f,
+    0x40, 0xff, 0x03, 0x00, 0x00, 0x00, 0xc0, 0xff, 0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x80, 0xff,
+    0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x80, 0xff, 0x80, 0xff, 0x02, 0x00, 0x69, 0x00, 0x80, 0xff,
+    0x80, 0xff, 0x02, 0x40, 0xff, 0x01, 0x80, 0xff, 0x80, 0xff, 0x02, 0x80, 0xff, 0x02, 0x80, 0xff,
+    0x80, 0xff, 0x02, 0x80, 0xff, 0x02, 0x80, 0xff, 0x40, 0xff, 0x03, 0xc0, 0xff, 0x03, 0xc0, 0xff,
+    0x00, 0xfd, 0x0b, 0xe0, 0xff, 0x0b, 0xe0, 0x7f, 0x00, 0xf4, 0xbf, 0xfe, 0xff, 0xbf, 0xfe, 0x1f,
+    0x00, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0b, 0x00, 0x90, 0xff, 0xff, 0xff, 0xff, 0xff, 0x06,
+    0x00, 0x00, 0xfd, 0x7f, 0x69, 0xfd, 0x7f, 0x00, 0x00, 0x00, 0xf4, 0x1f, 0x00, 0xf4, 0x1f, 0x00,
+    0x00, 0x00, 0x90, 0x06, 0x00, 0x90, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '4' (52)
+    0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xff, 0x2f,
+    0x00, 0x00, 0x00, 0x40, 0xff, 0xff, 0xff, 0x2f, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0x1f,
+    0x00, 0x00, 0x00, 0x80, 0xff, 0xbf, 0xaa, 0x06, 0x00, 0x00, 0x00, 0x80, 0xff, 0x1f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0xff, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xf4, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x90, 0xaa, 0xfe, 0xff, 0xbf, 0xaa, 0x06,
+    0x00, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2f,
+    0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2f, 0x00, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f,
+    0x00, 0x90, 0xaa, 0xfe, 0xff, 0xbf, 0xaa, 0x06, 0x00, 0x00, 0x00, 0xe4, 0xff, 0x1b, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '5' (53)
+    0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xff, 0x2f, 0x00, 0x69, 0x00, 0x00, 0xfe, 0xff, 0xff, 0xbf,
+    0x40, 0xff, 0x01, 0x40, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0x02, 0x80, 0xff, 0xff, 0xff, 0xff,
+    0x80, 0xff, 0x02, 0x80, 0xff, 0xbf, 0xfe, 0xff, 0x80, 0xff, 0x02, 0x80, 0xff, 0x1f, 0xf4, 0xff,
+    0x80, 0xff, 0x02, 0x80, 0xff, 0x07, 0xd0, 0xff, 0x80, 0xff, 0x02, 0x80, 0xff, 0x02, 0x80, 0xff,
+    0x80, 0xff, 0x02, 0x80, 0xff, 0x02, 0x80, 0xff, 0x80, 0xff, 0x02, 0x80, 0xff, 0x02, 0x80, 0xff,
+    0x80, 0xff, 0x02, 0x80, 0xff, 0x02, 0x80, 0xff, 0x80, 0xff, 0x02, 0x80, 0xff, 0x02, 0x80, 0xff,
+    0x80, 0xff, 0x02, 0x80, 0xff, 0x02, 0x80, 0xff, 0x40, 0xff, 0x03, 0xc0, 0xff, 0x01, 0x80, 0xff,
+    0x00, 0xfd, 0x0b, 0xe0, 0x7f, 0x00, 0x80, 0xff, 0x00, 0xf4, 0xbf, 0xfe, 0x1f, 0x00, 0x80, 0xff,
+    0x00, 0xe0, 0xff, 0xff, 0x0b, 0x00, 0x80, 0xff, 0x00, 0x90, 0xff, 0xff, 0x06, 0x00, 0x40, 0xff,
+    0x00, 0x00, 0xfd, 0x7f, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0xf4, 0x1f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x90, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '6' (54)
+    0x00, 0x00, 0xf4, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x00, 0xfd, 0xff, 0xff, 0xff, 0x7f, 0x00,
+    0x00, 0x90, 0xff, 0xff, 0xff, 0xff, 0xff, 0x06, 0x00, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0b,
+    0x00, 0xf4, 0xbf, 0xfe, 0xff, 0xbf, 0xfe, 0x1f, 0x00, 0xfd, 0x0b, 0xf4, 0xff, 0x1f, 0xe0, 0x7f,
+    0x40, 0xff, 0x03, 0xd0, 0xff, 0x07, 0xc0, 0xff, 0x80, 0xff, 0x02, 0x80, 0xff, 0x02, 0x80, 0xff,
+    0x80, 0xff, 0x02, 0x80, 0xff, 0x02, 0x80, 0xff, 0x80, 0xff, 0x02, 0x80, 0xff, 0x02, 0x80, 0xff,
+    0x80, 0xff, 0x02, 0x80, 0xff, 0x02, 0x80, 0xff, 0x80, 0xff, 0x02, 0x80, 0xff, 0x02, 0x80, 0xff,
+    0x80, 0xff, 0x02, 0x80, 0xff, 0x02, 0x80, 0xff, 0x40, 0xff, 0x03, 0xc0, 0xff, 0x01, 0x80, 0xff,
+    0x00, 0xfd, 0x0b, 0xe0, 0x7f, 0x00, 0x80, 0xff, 0x00, 0xf4, 0xbf, 0xfe, 0x1f, 0x00, 0x80, 0xff,
+    0x00, 0xe0, 0xff, 0xff, 0x0b, 0x00, 0x80, 0xff, 0x00, 0x90, 0xff, 0xff, 0x06, 0x00, 0x40, 0xff,
+    0x00, 0x00, 0xfd, 0x7f, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0xf4, 0x1f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x90, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '7' (55)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x00, 0x90, 0xaa, 0x06, 0x00, 0x00, 0x80, 0xff,
+    0x00, 0xf4, 0xff, 0x1f, 0x00, 0x00, 0x80, 0xff, 0x00, 0xf8, 0xff, 0x7f, 0x00, 0x00, 0x80, 0xff,
+    0x00, 0xf8, 0xff, 0xff, 0x06, 0x00, 0x80, 0xff, 0x00, 0xf4, 0xff, 0xff, 0x0b, 0x00, 0x80, 0xff,
+    0x00, 0x90, 0xaa, 0xfe, 0x1f, 0x00, 0x80, 0xff, 0x00, 0x00, 0x00, 0xe0, 0x7f, 0x00, 0x80, 0xff,
+    0x00, 0x00, 0x00, 0xc0, 0xff, 0x01, 0x80, 0xff, 0x00, 0x00, 0x00, 0x80, 0xff, 0x02, 0x80, 0xff,
+    0x00, 0x00, 0x00, 0x80, 0xff, 0x02, 0x80, 0xff, 0x00, 0x00, 0x00, 0x40, 0xff, 0x03, 0xd0, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0xfd, 0x0b, 0xf4, 0xff, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xbf, 0xfe, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0xe0, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x90, 0xff, 0xff, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xff, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0x2f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xaa, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '8' (56)
+    0x00, 0x00, 0xf4, 0x1f, 0x00, 0xf4, 0x1f, 0x00, 0x00, 0x00, 0xfd, 0x7f, 0x69, 0xfd, 0x7f, 0x00,
+    0x00, 0x90, 0xff, 0xff, 0xff, 0xff, 0xff, 0x06, 0x00, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0b,
+    0x00, 0xf4, 0xbf, 0xfe, 0xff, 0xbf, 0xfe, 0x1f, 0x00, 0xfd, 0x0b, 0xe0, 0xff, 0x0b, 0xe0, 0x7f,
+    0x40, 0xff, 0x03, 0xc0, 0xff, 0x03, 0xc0, 0xff, 0x80, 0xff, 0x02, 0x80, 0xff, 0x02, 0x80, 0xff,
+    0x80, 0xff, 0x02, 0x80, 0xff, 0x02, 0x80, 0xff, 0x80, 0xff, 0x02, 0x80, 0xff, 0x02, 0x80, 0xff,
+    0x80, 0xff, 0x02, 0x80, 0xff, 0x02, 0x80, 0xff, 0x80, 0xff, 0x02, 0x80, 0xff, 0x02, 0x80, 0xff,
+    0x80, 0xff, 0x02, 0x80, 0xff, 0x02, 0x80, 0xff, 0x40, 0xff, 0x03, 0xc0, 0xff, 0x03, 0xc0, 0xff,
+    0x00, 0xfd, 0x0b, 0xe0, 0xff, 0x0b, 0xe0, 0x7f, 0x00, 0xf4, 0xbf, 0xfe, 0xff, 0xbf, 0xfe, 0x1f,
+    0x00, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0b, 0x00, 0x90, 0xff, 0xff, 0xff, 0xff, 0xff, 0x06,
+    0x00, 0x00, 0xfd, 0x7f, 0x69, 0xfd, 0x7f, 0x00, 0x00, 0x00, 0xf4, 0x1f, 0x00, 0xf4, 0x1f, 0x00,
+    0x00, 0x00, 0x90, 0x06, 0x00, 0x90, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '9' (57)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x7f, 0x00,
+    0x00, 0x90, 0x03, 0x00, 0x90, 0xff, 0xff, 0x06, 0x00, 0xe0, 0x0f, 0x00, 0xe0, 0xff, 0xff, 0x0b,
+    0x00, 0xf4, 0x0b, 0x00, 0xf4, 0xbf, 0xfe, 0x1f, 0x00, 0xfd, 0x07, 0x00, 0xfd, 0x0b, 0xe0, 0x7f,
+    0x40, 0xff, 0x03, 0x40, 0xff, 0x03, 0xc0, 0xff, 0x80, 0xff, 0x02, 0x80, 0xff, 0x02, 0x80, 0xff,
+    0x80, 0xff, 0x02, 0x80, 0xff, 0x02, 0x80, 0xff, 0x80, 0xff, 0x02, 0x80, 0xff, 0x02, 0x80, 0xff,
+    0x80, 0xff, 0x02, 0x80, 0xff, 0x02, 0x80, 0xff, 0x80, 0xff, 0x02, 0x80, 0xff, 0x02, 0x80, 0xff,
+    0x80, 0xff, 0x02, 0x80, 0xff, 0x02, 0x80, 0xff, 0x40, 0xff, 0x03, 0xd0, 0xff, 0x07, 0xc0, 0xff,
+    0x00, 0xfd, 0x0b, 0xf4, 0xff, 0x1f, 0xe0, 0x7f, 0x00, 0xf4, 0xbf, 0xfe, 0xff, 0xbf, 0xfe, 0x1f,
+    0x00, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0b, 0x00, 0x90, 0xff, 0xff, 0xff, 0xff, 0xff, 0x06,
+    0x00, 0x00, 0xfd, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xff, 0xff, 0x1f, 0x00,
+    0x00, 0x00, 0x90, 0xaa, 0xaa, 0xaa, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // ':' (58)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // ';' (59)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0xff, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0xff, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xfe, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x90, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '<' (60)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x90, 0xeb, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xff, 0x0b, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xf0, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xff, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x90, 0x03, 0x69, 0xc0, 0x06, 0x00, 0x00, 0x00, 0xe0, 0x0f, 0x00, 0xf0, 0x0b, 0x00,
+    0x00, 0x00, 0xf0, 0x0b, 0x00, 0xe0, 0x0f, 0x00, 0x00, 0x00, 0xc0, 0x06, 0x00, 0x90, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '=' (61)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x69, 0x00, 0x00,
+    0x00, 0x00, 0x40, 0xff, 0x41, 0xff, 0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xd7, 0xff, 0x02, 0x00,
+    0x00, 0x00, 0x80, 0xff, 0xd7, 0xff, 0x02, 0x00, 0x00, 0x00, 0x80, 0xff, 0xd7, 0xff, 0x02, 0x00,
+    0x00, 0x00, 0x80, 0xff, 0xd7, 0xff, 0x02, 0x00, 0x00, 0x00, 0x80, 0xff, 0xd7, 0xff, 0x02, 0x00,
+    0x00, 0x00, 0x80, 0xff, 0xd7, 0xff, 0x02, 0x00, 0x00, 0x00, 0x80, 0xff, 0xd7, 0xff, 0x02, 0x00,
+    0x00, 0x00, 0x80, 0xff, 0xd7, 0xff, 0x02, 0x00, 0x00, 0x00, 0x80, 0xff, 0xd7, 0xff, 0x02, 0x00,
+    0x00, 0x00, 0x80, 0xff, 0xd7, 0xff, 0x02, 0x00, 0x00, 0x00, 0x40, 0xff, 0x41, 0xff, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x69, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '>' (62)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xc0, 0x06, 0x00, 0x90, 0x03, 0x00, 0x00, 0x00, 0xf0, 0x0b, 0x00, 0xe0, 0x0f, 0x00,
+    0x00, 0x00, 0xe0, 0x0f, 0x00, 0xf0, 0x0b, 0x00, 0x00, 0x00, 0x90, 0x03, 0x69, 0xc0, 0x06, 0x00,
+    0x00, 0x00, 0x00, 0xc0, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xff, 0x0f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xe0, 0xff, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xeb, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '?' (63)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x0b,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x7f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xff, 0x00, 0x00, 0x00, 0x90, 0x06, 0x00, 0x80, 0xff,
+    0x00, 0x00, 0x00, 0xf4, 0x2f, 0x00, 0x80, 0xff, 0x00, 0x00, 0x00, 0xf8, 0xbf, 0x00, 0x80, 0xff,
+    0x00, 0x00, 0x00, 0xfc, 0xff, 0x01, 0x80, 0xff, 0x00, 0x00, 0x00, 0xfc, 0xff, 0x02, 0x80, 0xff,
+    0x00, 0x00, 0x00, 0xf4, 0xff, 0x02, 0x80, 0xff, 0x00, 0x00, 0x00, 0xe0, 0xff, 0x03, 0xc0, 0xff,
+    0x00, 0x00, 0x00, 0x40, 0xff, 0x0b, 0xe0, 0x7f, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xbf, 0xfe, 0x1f,
+    0x00, 0x00, 0x00, 0x00, 0xe0, 0xff, 0xff, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x90, 0xff, 0xff, 0x06,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x1f, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '@' (64)
+    0x00, 0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0xff, 0x3f, 0x00, 0x00, 0x00, 0xc0, 0x06, 0x80, 0xff, 0x3f, 0x00, 0x00, 0x00, 0xf0, 0x0b,
+    0x80, 0xff, 0x1f, 0x00, 0x00, 0x00, 0xe0, 0x1f, 0x80, 0xff, 0x0f, 0x00, 0x00, 0x00, 0xd0, 0x7f,
+    0x80, 0xff, 0x07, 0x90, 0xeb, 0x06, 0xd0, 0xff, 0x80, 0xff, 0x03, 0xe0, 0xff, 0x0b, 0xc0, 0xff,
+    0x80, 0xff, 0x03, 0xf4, 0xff, 0x1f, 0xc0, 0xff, 0x80, 0xff, 0x03, 0xfd, 0xff, 0x7f, 0xc0, 0xff,
+    0x80, 0xff, 0x47, 0xff, 0xff, 0xff, 0xd1, 0xff, 0x80, 0xff, 0xd7, 0xff, 0xeb, 0xff, 0xd7, 0xff,
+    0x80, 0xff, 0xeb, 0xff, 0xeb, 0xff, 0xeb, 0xff, 0x40, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x00, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f,
+    0x00, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0b, 0x00, 0x90, 0xff, 0xff, 0xff, 0xff, 0xff, 0x06,
+    0x00, 0x00, 0xfd, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xff, 0xff, 0x1f, 0x00,
+    0x00, 0x00, 0x90, 0xaa, 0xaa, 0xaa, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'A' (65)
+    0x00, 0xf4, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x00,
+    0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x06, 0x00, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0b,
+    0x00, 0x90, 0xfe, 0xff, 0xbf, 0xaa, 0xfe, 0x1f, 0x00, 0x00, 0xf4, 0xff, 0x1f, 0x00, 0xe0, 0x7f,
+    0x00, 0x00, 0xd0, 0xff, 0x07, 0x00, 0xc0, 0xff, 0x00, 0x00, 0x80, 0xff, 0x02, 0x00, 0x80, 0xff,
+    0x00, 0x00, 0x80, 0xff, 0x02, 0x00, 0x80, 0xff, 0x00, 0x00, 0x80, 0xff, 0x02, 0x00, 0x80, 0xff,
+    0x00, 0x00, 0x80, 0xff, 0x02, 0x00, 0x80, 0xff, 0x00, 0x00, 0x80, 0xff, 0x02, 0x00, 0x80, 0xff,
+    0x00, 0x00, 0x80, 0xff, 0x02, 0x00, 0x80, 0xff, 0x00, 0x00, 0xd0, 0xff, 0x07, 0x00, 0xc0, 0xff,
+    0x00, 0x00, 0xf4, 0xff, 0x1f, 0x00, 0xe0, 0x7f, 0x00, 0x90, 0xfe, 0xff, 0xbf, 0xaa, 0xfe, 0x1f,
+    0x00, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0b, 0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x06,
+    0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x00, 0xf4, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x00,
+    0x00, 0x90, 0xaa, 0xaa, 0xaa, 0xaa, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'B' (66)
+    0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2f, 0x00, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf,
+    0x40, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x80, 0xff, 0xbf, 0xfe, 0xff, 0xbf, 0xfe, 0xff, 0x80, 0xff, 0x1f, 0xf4, 0xff, 0x1f, 0xf4, 0xff,
+    0x80, 0xff, 0x07, 0xd0, 0xff, 0x07, 0xd0, 0xff, 0x80, 0xff, 0x02, 0x80, 0xff, 0x02, 0x80, 0xff,
+    0x80, 0xff, 0x02, 0x80, 0xff, 0x02, 0x80, 0xff, 0x80, 0xff, 0x02, 0x80, 0xff, 0x02, 0x80, 0xff,
+    0x80, 0xff, 0x02, 0x80, 0xff, 0x02, 0x80, 0xff, 0x80, 0xff, 0x02, 0x80, 0xff, 0x02, 0x80, 0xff,
+    0x80, 0xff, 0x02, 0x80, 0xff, 0x02, 0x80, 0xff, 0x40, 0xff, 0x03, 0xc0, 0xff, 0x03, 0xc0, 0xff,
+    0x00, 0xfd, 0x0b, 0xe0, 0xff, 0x0b, 0xe0, 0x7f, 0x00, 0xf4, 0xbf, 0xfe, 0xff, 0xbf, 0xfe, 0x1f,
+    0x00, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0b, 0x00, 0x90, 0xff, 0xff, 0xff, 0xff, 0xff, 0x06,
+    0x00, 0x00, 0xfd, 0x7f, 0x69, 0xfd, 0x7f, 0x00, 0x00, 0x00, 0xf4, 0x1f, 0x00, 0xf4, 0x1f, 0x00,
+    0x00, 0x00, 0x90, 0x06, 0x00, 0x90, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'C' (67)
+    0x00, 0x00, 0xf4, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x00, 0xfd, 0xff, 0xff, 0xff, 0x7f, 0x00,
+    0x00, 0x90, 0xff, 0xff, 0xff, 0xff, 0xff, 0x06, 0x00, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0b,
+    0x00, 0xf4, 0xbf, 0xaa, 0xaa, 0xaa, 0xfe, 0x1f, 0x00, 0xfd, 0x0b, 0x00, 0x00, 0x00, 0xe0, 0x7f,
+    0x40, 0xff, 0x03, 0x00, 0x00, 0x00, 0xc0, 0xff, 0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x80, 0xff,
+    0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x80, 0xff, 0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x80, 0xff,
+    0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x80, 0xff, 0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x80, 0xff,
+    0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x80, 0xff, 0x40, 0xff, 0x03, 0x00, 0x00, 0x00, 0xc0, 0xff,
+    0x00, 0xfd, 0x07, 0x00, 0x00, 0x00, 0xd0, 0x7f, 0x00, 0xf4, 0x0b, 0x00, 0x00, 0x00, 0xe0, 0x1f,
+    0x00, 0xe0, 0x0f, 0x00, 0x00, 0x00, 0xf0, 0x0b, 0x00, 0x90, 0x03, 0x00, 0x00, 0x00, 0xc0, 0x06,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'D' (68)
+    0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2f, 0x00, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf,
+    0x40, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x80, 0xff, 0xbf, 0xaa, 0xaa, 0xaa, 0xfe, 0xff, 0x80, 0xff, 0x1f, 0x00, 0x00, 0x00, 0xf4, 0xff,
+    0x80, 0xff, 0x07, 0x00, 0x00, 0x00, 0xd0, 0xff, 0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x80, 0xff,
+    0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x80, 0xff, 0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x80, 0xff,
+    0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x80, 0xff, 0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x80, 0xff,
+    0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x80, 0xff, 0x40, 0xff, 0x03, 0x00, 0x00, 0x00, 0xc0, 0xff,
+    0x00, 0xfd, 0x0b, 0x00, 0x00, 0x00, 0xe0, 0x7f, 0x00, 0xf4, 0xbf, 0xaa, 0xaa, 0xaa, 0xfe, 0x1f,
+    0x00, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0b, 0x00, 0x90, 0xff, 0xff, 0xff, 0xff, 0xff, 0x06,
+    0x00, 0x00, 0xfd, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xff, 0xff, 0x1f, 0x00,
+    0x00, 0x00, 0x90, 0xaa, 0xaa, 0xaa, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'E' (69)
+    0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2f, 0x00, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf,
+    0x40, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x80, 0xff, 0xbf, 0xfe, 0xff, 0xbf, 0xfe, 0xff, 0x80, 0xff, 0x1f, 0xf4, 0xff, 0x1f, 0xf4, 0xff,
+    0x80, 0xff, 0x07, 0xd0, 0xff, 0x07, 0xd0, 0xff, 0x80, 0xff, 0x02, 0x80, 0xff, 0x02, 0x80, 0xff,
+    0x80, 0xff, 0x02, 0x80, 0xff, 0x02, 0x80, 0xff, 0x80, 0xff, 0x02, 0x40, 0xff, 0x01, 0x80, 0xff,
+    0x80, 0xff, 0x02, 0x00, 0x69, 0x00, 0x80, 0xff, 0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x80, 0xff,
+    0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x80, 0xff, 0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x80, 0xff,
+    0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x80, 0xff, 0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x80, 0xff,
+    0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x80, 0xff, 0x40, 0xff, 0x01, 0x00, 0x00, 0x00, 0x40, 0xff,
+    0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'F' (70)
+    0x00, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2f, 0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf,
+    0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0x90, 0xaa, 0xfe, 0xff, 0xbf, 0xfe, 0xff, 0x00, 0x00, 0x00, 0xf4, 0xff, 0x1f, 0xf4, 0xff,
+    0x00, 0x00, 0x00, 0xd0, 0xff, 0x07, 0xd0, 0xff, 0x00, 0x00, 0x00, 0x80, 0xff, 0x02, 0x80, 0xff,
+    0x00, 0x00, 0x00, 0x80, 0xff, 0x02, 0x80, 0xff, 0x00, 0x00, 0x00, 0x40, 0xff, 0x01, 0x80, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x80, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'G' (71)
+    0x00, 0x00, 0xf4, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x00, 0xfd, 0xff, 0xff, 0xff, 0x7f, 0x00,
+    0x00, 0x90, 0xff, 0xff, 0xff, 0xff, 0xff, 0x06, 0x00, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0b,
+    0x00, 0xf4, 0xbf, 0xaa, 0xff, 0xaa, 0xfe, 0x1f, 0x00, 0xfd, 0x0b, 0x00, 0x00, 0x00, 0xe0, 0x7f,
+    0x40, 0xff, 0x03, 0x00, 0x00, 0x00, 0xc0, 0xff, 0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x80, 0xff,
+    0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x80, 0xff, 0x80, 0xff, 0x02, 0x00, 0x69, 0x00, 0x80, 0xff,
+    0x80, 0xff, 0x02, 0x40, 0xff, 0x01, 0x80, 0xff, 0x80, 0xff, 0x02, 0x80, 0xff, 0x02, 0x80, 0xff,
+    0x80, 0xff, 0x02, 0x80, 0xff, 0x02, 0x80, 0xff, 0x40, 0xff, 0x03, 0xd0, 0xff, 0x02, 0xc0, 0xff,
+    0x00, 0xfd, 0x0b, 0xf4, 0xff, 0x02, 0xd0, 0x7f, 0x00, 0xf4, 0xbf, 0xfe, 0xff, 0x02, 0xe0, 0x1f,
+    0x00, 0xe0, 0xff, 0xff, 0xff, 0x03, 0xf0, 0x0b, 0x00, 0x90, 0xff, 0xff, 0xff, 0x01, 0xc0, 0x06,
+    0x00, 0x00, 0xfd, 0xff, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0x2f, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x90, 0xaa, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'H' (72)
+    0x00, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2f,
+    0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2f, 0x00, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f,
+    0x00, 0x90, 0xaa, 0xfe, 0xff, 0xbf, 0xaa, 0x06, 0x00, 0x00, 0x00, 0xf4, 0xff, 0x1f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xd0, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0xff, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xf4, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x90, 0xaa, 0xfe, 0xff, 0xbf, 0xaa, 0x06,
+    0x00, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2f,
+    0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2f, 0x00, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f,
+    0x00, 0x90, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'I' (73)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69,
+    0x40, 0xff, 0x01, 0x00, 0x00, 0x00, 0x40, 0xff, 0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x80, 0xff,
+    0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x80, 0xff, 0x80, 0xff, 0x07, 0x00, 0x00, 0x00, 0xd0, 0xff,
+    0x80, 0xff, 0x1f, 0x00, 0x00, 0x00, 0xf4, 0xff, 0x80, 0xff, 0xbf, 0xaa, 0xaa, 0xaa, 0xfe, 0xff,
+    0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x80, 0xff, 0xbf, 0xaa, 0xaa, 0xaa, 0xfe, 0xff, 0x80, 0xff, 0x1f, 0x00, 0x00, 0x00, 0xf4, 0xff,
+    0x80, 0xff, 0x07, 0x00, 0x00, 0x00, 0xd0, 0xff, 0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x80, 0xff,
+    0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x80, 0xff, 0x40, 0xff, 0x01, 0x00, 0x00, 0x00, 0x40, 0xff,
+    0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'J' (74)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69,
+    0x00, 0x90, 0x03, 0x00, 0x00, 0x00, 0x40, 0xff, 0x00, 0xe0, 0x0f, 0x00, 0x00, 0x00, 0x80, 0xff,
+    0x00, 0xf4, 0x0b, 0x00, 0x00, 0x00, 0x80, 0xff, 0x00, 0xfd, 0x07, 0x00, 0x00, 0x00, 0x80, 0xff,
+    0x40, 0xff, 0x03, 0x00, 0x00, 0x00, 0x80, 0xff, 0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x80, 0xff,
+    0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x80, 0xff, 0x40, 0xff, 0x03, 0x00, 0x00, 0x00, 0xd0, 0xff,
+    0x00, 0xfd, 0x0b, 0x00, 0x00, 0x00, 0xf4, 0xff, 0x00, 0xf4, 0xbf, 0xaa, 0xaa, 0xaa, 0xfe, 0xff,
+    0x00, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x90, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0x00, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0x00, 0x90, 0xaa, 0xaa, 0xaa, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'K' (75)
+    0x00, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2f,
+    0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2f, 0x00, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f,
+    0x00, 0x90, 0xaa, 0xfe, 0xff, 0xbf, 0xaa, 0x06, 0x00, 0x00, 0x00, 0xf4, 0xff, 0x1f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xd0, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xff, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xd0, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xff, 0x0b, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xf0, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xff, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x90, 0x03, 0x69, 0xc0, 0x06, 0x00, 0x00, 0x90, 0xfe, 0x0f, 0x00, 0xf0, 0xbf, 0x06,
+    0x00, 0xf4, 0xff, 0x0b, 0x00, 0xe0, 0xff, 0x1f, 0x00, 0xf8, 0xff, 0x06, 0x00, 0x90, 0xff, 0x2f,
+    0x00, 0xf8, 0x7f, 0x00, 0x00, 0x00, 0xfd, 0x2f, 0x00, 0xf4, 0x1f, 0x00, 0x00, 0x00, 0xf4, 0x1f,
+    0x00, 0x90, 0x06, 0x00, 0x00, 0x00, 0x90, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'L' (76)
+    0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x00, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2f,
+    0x40, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2f, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f,
+    0x80, 0xff, 0xbf, 0xaa, 0xaa, 0xaa, 0xaa, 0x06, 0x80, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'M' (77)
+    0x00, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2f,
+    0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x00, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f,
+    0x00, 0x90, 0xaa, 0xaa, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x50, 0xfe, 0xff, 0x0b,
+    0x00, 0x00, 0x00, 0x00, 0x40, 0xfe, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0xd0, 0xff, 0x2f, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0x2f, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0x1f, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xd0, 0xff, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xfe, 0xff, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x50, 0xfe, 0xff, 0x0b, 0x00, 0x90, 0xaa, 0xaa, 0xff, 0xff, 0xff, 0x1f,
+    0x00, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f,
+    0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2f, 0x00, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f,
+    0x00, 0x90, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'N' (78)
+    0x00, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2f,
+    0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x00, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f,
+    0x00, 0x90, 0xaa, 0xaa, 0xaa, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xff, 0x0b,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x2f, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x06, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x90, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x0f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x2f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xe4, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x90, 0xaa, 0xfe, 0xff, 0xff, 0xaa, 0x06,
+    0x00, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2f,
+    0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2f, 0x00, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f,
+    0x00, 0x90, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'O' (79)
+    0x00, 0x00, 0xf4, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x00, 0xfd, 0xff, 0xff, 0xff, 0x7f, 0x00,
+    0x00, 0x90, 0xff, 0xff, 0xff, 0xff, 0xff, 0x06, 0x00, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0b,
+    0x00, 0xf4, 0xbf, 0xaa, 0xaa, 0xaa, 0xfe, 0x1f, 0x00, 0xfd, 0x0b, 0x00, 0x00, 0x00, 0xe0, 0x7f,
+    0x40, 0xff, 0x03, 0x00, 0x00, 0x00, 0xc0, 0xff, 0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x80, 0xff,
+    0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x80, 0xff, 0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x80, 0xff,
+    0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x80, 0xff, 0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x80, 0xff,
+    0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x80, 0xff, 0x40, 0xff, 0x03, 0x00, 0x00, 0x00, 0xc0, 0xff,
+    0x00, 0xfd, 0x0b, 0x00, 0x00, 0x00, 0xe0, 0x7f, 0x00, 0xf4, 0xbf, 0xaa, 0xaa, 0xaa, 0xfe, 0x1f,
+    0x00, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0b, 0x00, 0x90, 0xff, 0xff, 0xff, 0xff, 0xff, 0x06,
+    0x00, 0x00, 0xfd, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xff, 0xff, 0x1f, 0x00,
+    0x00, 0x00, 0x90, 0xaa, 0xaa, 0xaa, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'P' (80)
+    0x00, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2f, 0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf,
+    0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0x90, 0xaa, 0xfe, 0xff, 0xbf, 0xfe, 0xff, 0x00, 0x00, 0x00, 0xf4, 0xff, 0x1f, 0xf4, 0xff,
+    0x00, 0x00, 0x00, 0xd0, 0xff, 0x07, 0xd0, 0xff, 0x00, 0x00, 0x00, 0x80, 0xff, 0x02, 0x80, 0xff,
+    0x00, 0x00, 0x00, 0x80, 0xff, 0x02, 0x80, 0xff, 0x00, 0x00, 0x00, 0x80, 0xff, 0x02, 0x80, 0xff,
+    0x00, 0x00, 0x00, 0x80, 0xff, 0x02, 0x80, 0xff, 0x00, 0x00, 0x00, 0x80, 0xff, 0x02, 0x80, 0xff,
+    0x00, 0x00, 0x00, 0x80, 0xff, 0x02, 0x80, 0xff, 0x00, 0x00, 0x00, 0x40, 0xff, 0x03, 0xc0, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0xfd, 0x0b, 0xe0, 0x7f, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xbf, 0xfe, 0x1f,
+    0x00, 0x00, 0x00, 0x00, 0xe0, 0xff, 0xff, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x90, 0xff, 0xff, 0x06,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x1f, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'Q' (81)
+    0x00, 0x00, 0xf4, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x00, 0xfd, 0xff, 0xff, 0xff, 0x7f, 0x00,
+    0x00, 0x90, 0xff, 0xff, 0xff, 0xff, 0xff, 0x06, 0x00, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0b,
+    0x00, 0xf4, 0xff, 0xaa, 0xaa, 0xaa, 0xfe, 0x1f, 0x00, 0xfd, 0x7f, 0x00, 0x00, 0x00, 0xe0, 0x7f,
+    0x40, 0xff, 0x3f, 0x00, 0x00, 0x00, 0xc0, 0xff, 0x80, 0xff, 0x2f, 0x00, 0x00, 0x00, 0x80, 0xff,
+    0x80, 0xff, 0x3f, 0x00, 0x00, 0x00, 0x80, 0xff, 0x80, 0xff, 0x3f, 0x00, 0x00, 0x00, 0x80, 0xff,
+    0x80, 0xff, 0x3f, 0x00, 0x00, 0x00, 0x80, 0xff, 0x80, 0xff, 0x3f, 0x00, 0x00, 0x00, 0x80, 0xff,
+    0x80, 0xff, 0x2f, 0x00, 0x00, 0x00, 0x80, 0xff, 0x40, 0xff, 0x3f, 0x00, 0x00, 0x00, 0xc0, 0xff,
+    0x00, 0xfd, 0x7f, 0x00, 0x00, 0x00, 0xe0, 0x7f, 0x00, 0xf4, 0xff, 0xaa, 0xaa, 0xaa, 0xfe, 0x1f,
+    0x00, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0b, 0x00, 0x90, 0xff, 0xff, 0xff, 0xff, 0xff, 0x06,
+    0x00, 0x00, 0xfd, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xff, 0xff, 0x1f, 0x00,
+    0x00, 0x00, 0x90, 0xaa, 0xaa, 0xaa, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'R' (82)
+    0x00, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2f, 0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf,
+    0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0x90, 0xfe, 0xff, 0xbf, 0xaa, 0xfe, 0xff, 0x00, 0x00, 0xf4, 0xff, 0x1f, 0x00, 0xf4, 0xff,
+    0x00, 0x00, 0xd0, 0xff, 0x07, 0x00, 0xd0, 0xff, 0x00, 0x00, 0x80, 0xff, 0x02, 0x00, 0x80, 0xff,
+    0x00, 0x00, 0x80, 0xff, 0x02, 0x00, 0x80, 0xff, 0x00, 0x00, 0x80, 0xff, 0x02, 0x00, 0x80, 0xff,
+    0x00, 0x00, 0x80, 0xff, 0x02, 0x00, 0x80, 0xff, 0x00, 0x00, 0x80, 0xff, 0x02, 0x00, 0x80, 0xff,
+    0x00, 0x00, 0x80, 0xff, 0x02, 0x00, 0x80, 0xff, 0x00, 0x00, 0xc0, 0xff, 0x03, 0x00, 0xc0, 0xff,
+    0x00, 0x00, 0xe0, 0xff, 0x0b, 0x00, 0xe0, 0x7f, 0x00, 0x90, 0xfe, 0xff, 0xbf, 0xaa, 0xfe, 0x1f,
+    0x00, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0b, 0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x06,
+    0x00, 0xf8, 0x7f, 0x69, 0xfd, 0xff, 0x7f, 0x00, 0x00, 0xf4, 0x1f, 0x00, 0xf4, 0xff, 0x1f, 0x00,
+    0x00, 0x90, 0x06, 0x00, 0x90, 0xaa, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'S' (83)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x1f, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0xfd, 0x7f, 0x00,
+    0x40, 0xff, 0x01, 0x00, 0x90, 0xff, 0xff, 0x06, 0x80, 0xff, 0x02, 0x00, 0xe0, 0xff, 0xff, 0x0b,
+    0x80, 0xff, 0x02, 0x00, 0xf4, 0xbf, 0xfe, 0x1f, 0x80, 0xff, 0x02, 0x00, 0xfd, 0x0b, 0xe0, 0x7f,
+    0x80, 0xff, 0x02, 0x40, 0xff, 0x03, 0xc0, 0xff, 0x80, 0xff, 0x02, 0x80, 0xff, 0x02, 0x80, 0xff,
+    0x80, 0xff, 0x02, 0x80, 0xff, 0x02, 0x80, 0xff, 0x80, 0xff, 0x02, 0x80, 0xff, 0x02, 0x80, 0xff,
+    0x80, 0xff, 0x02, 0x80, 0xff, 0x02, 0x80, 0xff, 0x80, 0xff, 0x02, 0x80, 0xff, 0x02, 0x80, 0xff,
+    0x80, 0xff, 0x02, 0x80, 0xff, 0x02, 0x80, 0xff, 0x40, 0xff, 0x03, 0xc0, 0xff, 0x01, 0x80, 0xff,
+    0x00, 0xfd, 0x0b, 0xe0, 0x7f, 0x00, 0x80, 0xff, 0x00, 0xf4, 0xbf, 0xfe, 0x1f, 0x00, 0x80, 0xff,
+    0x00, 0xe0, 0xff, 0xff, 0x0b, 0x00, 0x80, 0xff, 0x00, 0x90, 0xff, 0xff, 0x06, 0x00, 0x40, 0xff,
+    0x00, 0x00, 0xfd, 0x7f, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0xf4, 0x1f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x90, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'T' (84)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0x00, 0x90, 0xaa, 0xaa, 0xaa, 0xaa, 0xfe, 0xff,
+    0x00, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0x90, 0xaa, 0xaa, 0xaa, 0xaa, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'U' (85)
+    0x00, 0x00, 0xf4, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x00, 0xfd, 0xff, 0xff, 0xff, 0xff, 0x2f,
+    0x00, 0x90, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2f, 0x00, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f,
+    0x00, 0xf4, 0xbf, 0xaa, 0xaa, 0xaa, 0xaa, 0x06, 0x00, 0xfd, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xfd, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xbf, 0xaa, 0xaa, 0xaa, 0xaa, 0x06,
+    0x00, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x90, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2f,
+    0x00, 0x00, 0xfd, 0xff, 0xff, 0xff, 0xff, 0x2f, 0x00, 0x00, 0xf4, 0xff, 0xff, 0xff, 0xff, 0x1f,
+    0x00, 0x00, 0x90, 0xaa, 0xaa, 0xaa, 0xaa, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'V' (86)
+    0x00, 0x00, 0x00, 0xf4, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x00, 0xfd, 0xff, 0xff, 0xff, 0x2f,
+    0x00, 0x00, 0x90, 0xff, 0xff, 0xff, 0xff, 0x2f, 0x00, 0x00, 0xe0, 0xff, 0xff, 0xff, 0xff, 0x1f,
+    0x00, 0x00, 0xf0, 0xbf, 0xaa, 0xaa, 0xaa, 0x06, 0x00, 0x00, 0xc0, 0x06, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x90, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xf0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xe0, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xe0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xc0, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xbf, 0xaa, 0xaa, 0xaa, 0x06,
+    0x00, 0x00, 0xe0, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x90, 0xff, 0xff, 0xff, 0xff, 0x2f,
+    0x00, 0x00, 0x00, 0xfd, 0xff, 0xff, 0xff, 0x2f, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xff, 0xff, 0x1f,
+    0x00, 0x00, 0x00, 0x90, 0xaa, 0xaa, 0xaa, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'W' (87)
+    0x00, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2f,
+    0x00, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2f, 0x00, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f,
+    0x00, 0xf4, 0xff, 0xff, 0xff, 0xaa, 0xaa, 0x06, 0x00, 0xe0, 0xff, 0xbf, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x40, 0xff, 0xbf, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xf4, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0x2f, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xf8, 0xff, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0x1f, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xf8, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0xbf, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0xe0, 0xff, 0xbf, 0x05, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xff, 0xff, 0xaa, 0xaa, 0x06,
+    0x00, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x00, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2f,
+    0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2f, 0x00, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f,
+    0x00, 0x90, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'X' (88)
+    0x00, 0xf4, 0x1f, 0x00, 0x00, 0x00, 0xf4, 0x1f, 0x00, 0xf8, 0x7f, 0x00, 0x00, 0x00, 0xfd, 0x2f,
+    0x00, 0xf8, 0xff, 0x06, 0x00, 0x90, 0xff, 0x2f, 0x00, 0xf4, 0xff, 0x0b, 0x00, 0xe0, 0xff, 0x1f,
+    0x00, 0x90, 0xfe, 0x0f, 0x00, 0xf0, 0xbf, 0x06, 0x00, 0x00, 0x90, 0x03, 0x69, 0xc0, 0x06, 0x00,
+    0x00, 0x00, 0x00, 0xc0, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xff, 0x0f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xf4, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0x2f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xf8, 0xff, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0x1f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xf0, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xff, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x90, 0x03, 0x69, 0xc0, 0x06, 0x00, 0x00, 0x90, 0xfe, 0x0f, 0x00, 0xf0, 0xbf, 0x06,
+    0x00, 0xf4, 0xff, 0x0b, 0x00, 0xe0, 0xff, 0x1f, 0x00, 0xf8, 0xff, 0x06, 0x00, 0x90, 0xff, 0x2f,
+    0x00, 0xf8, 0x7f, 0x00, 0x00, 0x00, 0xfd, 0x2f, 0x00, 0xf4, 0x1f, 0x00, 0x00, 0x00, 0xf4, 0x1f,
+    0x00, 0x90, 0x06, 0x00, 0x00, 0x00, 0x90, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'Y' (89)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xff, 0x2f,
+    0x00, 0x00, 0x00, 0x00, 0x90, 0xff, 0xff, 0x2f, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xff, 0xff, 0x1f,
+    0x00, 0x00, 0x00, 0x00, 0xf0, 0xbf, 0xaa, 0x06, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x90, 0x03, 0x00, 0x00, 0x00, 0x00, 0x90, 0xaa, 0xfe, 0x0f, 0x00, 0x00, 0x00,
+    0x00, 0xf4, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xff, 0x2f, 0x00, 0x00, 0x00,
+    0x00, 0xf8, 0xff, 0xff, 0x2f, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x00,
+    0x00, 0x90, 0xaa, 0xfe, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xc0, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xbf, 0xaa, 0x06,
+    0x00, 0x00, 0x00, 0x00, 0xe0, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x90, 0xff, 0xff, 0x2f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xff, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0x1f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xaa, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'Z' (90)
+    0x00, 0xf8, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x69,
+    0x40, 0xff, 0xff, 0x06, 0x00, 0x00, 0x40, 0xff, 0x80, 0xff, 0xff, 0x0b, 0x00, 0x00, 0x80, 0xff,
+    0x80, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x80, 0xff, 0x80, 0xff, 0xff, 0x03, 0x00, 0x00, 0x80, 0xff,
+    0x80, 0xff, 0x6f, 0xc0, 0x06, 0x00, 0x80, 0xff, 0x80, 0xff, 0x07, 0xf0, 0x0b, 0x00, 0x80, 0xff,
+    0x80, 0xff, 0x02, 0xe0, 0x0f, 0x00, 0x80, 0xff, 0x80, 0xff, 0x02, 0x90, 0x03, 0x00, 0x80, 0xff,
+    0x80, 0xff, 0x02, 0x00, 0xc0, 0x06, 0x80, 0xff, 0x80, 0xff, 0x02, 0x00, 0xf0, 0x0b, 0x80, 0xff,
+    0x80, 0xff, 0x02, 0x00, 0xe0, 0x0f, 0xd0, 0xff, 0x80, 0xff, 0x02, 0x00, 0x90, 0x03, 0xf9, 0xff,
+    0x80, 0xff, 0x02, 0x00, 0x00, 0xc0, 0xff, 0xff, 0x80, 0xff, 0x02, 0x00, 0x00, 0xf0, 0xff, 0xff,
+    0x80, 0xff, 0x02, 0x00, 0x00, 0xe0, 0xff, 0xff, 0x40, 0xff, 0x01, 0x00, 0x00, 0x90, 0xff, 0xff,
+    0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x2f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '[' (91)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x06,
+    0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2f, 0x00, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf,
+    0x40, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x80, 0xff, 0xbf, 0xaa, 0xaa, 0xaa, 0xfe, 0xff, 0x80, 0xff, 0x1f, 0x00, 0x00, 0x00, 0xf4, 0xff,
+    0x80, 0xff, 0x07, 0x00, 0x00, 0x00, 0xd0, 0xff, 0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x80, 0xff,
+    0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x80, 0xff, 0x40, 0xff, 0x01, 0x00, 0x00, 0x00, 0x40, 0xff,
+    0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '\\' (92)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x2f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xff, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xff, 0x1f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xbf, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x06, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x90, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x0f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xf0, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x90, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x0f, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xf0, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x90, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xfe, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xf4, 0xff, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xf8, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x90, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // ']' (93)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69,
+    0x40, 0xff, 0x01, 0x00, 0x00, 0x00, 0x40, 0xff, 0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x80, 0xff,
+    0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x80, 0xff, 0x80, 0xff, 0x07, 0x00, 0x00, 0x00, 0xd0, 0xff,
+    0x80, 0xff, 0x1f, 0x00, 0x00, 0x00, 0xf4, 0xff, 0x80, 0xff, 0xbf, 0xaa, 0xaa, 0xaa, 0xfe, 0xff,
+    0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2f,
+    0x00, 0x90, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '^' (94)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x0b, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x0b,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x0b,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x0f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x06,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x0f, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x06, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '_' (95)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '`' (96)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x0f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x06,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'a' (97)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00,
+    0x00, 0x90, 0xeb, 0x06, 0x40, 0xff, 0x01, 0x00, 0x00, 0xe0, 0xff, 0x0b, 0x80, 0xff, 0x02, 0x00,
+    0x00, 0xf4, 0xff, 0x1f, 0xc0, 0xff, 0x02, 0x00, 0x00, 0xfd, 0xff, 0x7f, 0xc0, 0xff, 0x02, 0x00,
+    0x40, 0xff, 0xff, 0xff, 0xd1, 0xff, 0x02, 0x00, 0x80, 0xff, 0xeb, 0xff, 0xd7, 0xff, 0x02, 0x00,
+    0x80, 0xff, 0xd7, 0xff, 0xd7, 0xff, 0x02, 0x00, 0x80, 0xff, 0xd7, 0xff, 0xd7, 0xff, 0x02, 0x00,
+    0x80, 0xff, 0xd7, 0xff, 0xd7, 0xff, 0x02, 0x00, 0x80, 0xff, 0xd7, 0xff, 0xd7, 0xff, 0x02, 0x00,
+    0x80, 0xff, 0xeb, 0xff, 0xeb, 0xff, 0x02, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00,
+    0x80, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x00,
+    0x80, 0xff, 0xff, 0xff, 0xff, 0x0b, 0x00, 0x00, 0x40, 0xff, 0xff, 0xff, 0xff, 0x06, 0x00, 0x00,
+    0x00, 0xfe, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x00,
+    0x00, 0x90, 0xaa, 0xaa, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'b' (98)
+    0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x00, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2f,
+    0x40, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2f, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f,
+    0x80, 0xff, 0xbf, 0xaa, 0xfe, 0xff, 0xbf, 0x06, 0x80, 0xff, 0x1f, 0x00, 0xf4, 0xff, 0x1f, 0x00,
+    0x80, 0xff, 0x07, 0x00, 0xd0, 0xff, 0x07, 0x00, 0x80, 0xff, 0x02, 0x00, 0x80, 0xff, 0x02, 0x00,
+    0x80, 0xff, 0x02, 0x00, 0x80, 0xff, 0x02, 0x00, 0x80, 0xff, 0x02, 0x00, 0x80, 0xff, 0x02, 0x00,
+    0x80, 0xff, 0x02, 0x00, 0x80, 0xff, 0x02, 0x00, 0x80, 0xff, 0x02, 0x00, 0x80, 0xff, 0x02, 0x00,
+    0x80, 0xff, 0x02, 0x00, 0x80, 0xff, 0x02, 0x00, 0x40, 0xff, 0x03, 0x00, 0xc0, 0xff, 0x01, 0x00,
+    0x00, 0xfd, 0x0b, 0x00, 0xe0, 0x7f, 0x00, 0x00, 0x00, 0xf4, 0xbf, 0xaa, 0xfe, 0x1f, 0x00, 0x00,
+    0x00, 0xe0, 0xff, 0xff, 0xff, 0x0b, 0x00, 0x00, 0x00, 0x90, 0xff, 0xff, 0xff, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0xfd, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0x1f, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x90, 0xaa, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'c' (99)
+    0x00, 0x00, 0xf4, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xff, 0x7f, 0x00, 0x00, 0x00,
+    0x00, 0x90, 0xff, 0xff, 0xff, 0x06, 0x00, 0x00, 0x00, 0xe0, 0xff, 0xff, 0xff, 0x0b, 0x00, 0x00,
+    0x00, 0xf4, 0xbf, 0xaa, 0xfe, 0x1f, 0x00, 0x00, 0x00, 0xfd, 0x0b, 0x00, 0xe0, 0x7f, 0x00, 0x00,
+    0x40, 0xff, 0x03, 0x00, 0xc0, 0xff, 0x01, 0x00, 0x80, 0xff, 0x02, 0x00, 0x80, 0xff, 0x02, 0x00,
+    0x80, 0xff, 0x02, 0x00, 0x80, 0xff, 0x02, 0x00, 0x80, 0xff, 0x02, 0x00, 0x80, 0xff, 0x02, 0x00,
+    0x80, 0xff, 0x02, 0x00, 0x80, 0xff, 0x02, 0x00, 0x80, 0xff, 0x02, 0x00, 0x80, 0xff, 0x02, 0x00,
+    0x80, 0xff, 0x02, 0x00, 0x80, 0xff, 0x02, 0x00, 0x80, 0xff, 0x02, 0x00, 0xc0, 0xff, 0x01, 0x00,
+    0x80, 0xff, 0x02, 0x00, 0xd0, 0x7f, 0x00, 0x00, 0x80, 0xff, 0x02, 0x00, 0xe0, 0x1f, 0x00, 0x00,
+    0x80, 0xff, 0x02, 0x00, 0xf0, 0x0b, 0x00, 0x00, 0x40, 0xff, 0x01, 0x00, 0xc0, 0x06, 0x00, 0x00,
+    0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'd' (100)
+    0x00, 0x00, 0xf4, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xff, 0x7f, 0x00, 0x00, 0x00,
+    0x00, 0x90, 0xff, 0xff, 0xff, 0x06, 0x00, 0x00, 0x00, 0xe0, 0xff, 0xff, 0xff, 0x0b, 0x00, 0x00,
+    0x00, 0xf4, 0xbf, 0xaa, 0xfe, 0x1f, 0x00, 0x00, 0x00, 0xfd, 0x0b, 0x00, 0xe0, 0x7f, 0x00, 0x00,
+    0x40, 0xff, 0x03, 0x00, 0xc0, 0xff, 0x01, 0x00, 0x80, 0xff, 0x02, 0x00, 0x80, 0xff, 0x02, 0x00,
+    0x80, 0xff, 0x02, 0x00, 0x80, 0xff, 0x02, 0x00, 0x80, 0xff, 0x02, 0x00, 0x80, 0xff, 0x02, 0x00,
+    0x80, 0xff, 0x02, 0x00, 0x80, 0xff, 0x02, 0x00, 0x80, 0xff, 0x02, 0x00, 0x80, 0xff, 0x02, 0x00,
+    0x80, 0xff, 0x02, 0x00, 0x80, 0xff, 0x02, 0x00, 0x80, 0xff, 0x07, 0x00, 0xd0, 0xff, 0x07, 0x00,
+    0x80, 0xff, 0x1f, 0x00, 0xf4, 0xff, 0x1f, 0x00, 0x80, 0xff, 0xbf, 0xaa, 0xfe, 0xff, 0xbf, 0x06,
+    0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x40, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2f,
+    0x00, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2f, 0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f,
+    0x00, 0x90, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'e' (101)
+    0x00, 0x00, 0xf4, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xff, 0x7f, 0x00, 0x00, 0x00,
+    0x00, 0x90, 0xff, 0xff, 0xff, 0x06, 0x00, 0x00, 0x00, 0xe0, 0xff, 0xff, 0xff, 0x0b, 0x00, 0x00,
+    0x00, 0xf4, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x00, 0xfd, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x00,
+    0x40, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x80, 0xff, 0xeb, 0xff, 0xeb, 0xff, 0x02, 0x00,
+    0x80, 0xff, 0xd7, 0xff, 0xd7, 0xff, 0x02, 0x00, 0x80, 0xff, 0xd7, 0xff, 0xd7, 0xff, 0x02, 0x00,
+    0x80, 0xff, 0xd7, 0xff, 0xd7, 0xff, 0x02, 0x00, 0x80, 0xff, 0xd7, 0xff, 0xd7, 0xff, 0x02, 0x00,
+    0x80, 0xff, 0xd7, 0xff, 0xeb, 0xff, 0x02, 0x00, 0x80, 0xff, 0xd7, 0xff, 0xff, 0xff, 0x01, 0x00,
+    0x80, 0xff, 0xd7, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x80, 0xff, 0xd7, 0xff, 0xff, 0x1f, 0x00, 0x00,
+    0x80, 0xff, 0xd7, 0xff, 0xff, 0x0b, 0x00, 0x00, 0x40, 0xff, 0x41, 0xff, 0xff, 0x06, 0x00, 0x00,
+    0x00, 0x69, 0x00, 0xfe, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x1f, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x90, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'f' (102)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xe4, 0xff, 0x1b, 0x00, 0x00, 0x00, 0x90, 0xaa, 0xfe, 0xff, 0xbf, 0x06, 0x00,
+    0x00, 0xf4, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x00,
+    0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x06, 0x00, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0b,
+    0x00, 0x90, 0xaa, 0xfe, 0xff, 0xbf, 0xfe, 0x1f, 0x00, 0x00, 0x00, 0xf4, 0xff, 0x1f, 0xe0, 0x7f,
+    0x00, 0x00, 0x00, 0xd0, 0xff, 0x07, 0xc0, 0xff, 0x00, 0x00, 0x00, 0x80, 0xff, 0x02, 0x80, 0xff,
+    0x00, 0x00, 0x00, 0x80, 0xff, 0x02, 0x80, 0xff, 0x00, 0x00, 0x00, 0x40, 0xff, 0x01, 0x80, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x80, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'g' (103)
+    0x00, 0x00, 0xf4, 0x1f, 0x00, 0xf8, 0x1f, 0x00, 0x00, 0x00, 0xfd, 0x7f, 0xa9, 0xff, 0x7f, 0x00,
+    0x00, 0x90, 0xff, 0xff, 0xff, 0xff, 0xff, 0x06, 0x00, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0b,
+    0x00, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x00, 0xfd, 0x1b, 0xfd, 0xff, 0xff, 0xff, 0x7f,
+    0x40, 0xff, 0x07, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0x03, 0xf4, 0xff, 0xff, 0xeb, 0xff,
+    0x80, 0xff, 0x03, 0xf4, 0xff, 0xff, 0xeb, 0xff, 0x80, 0xff, 0x03, 0xfd, 0xff, 0xff, 0xff, 0xff,
+    0x80, 0xff, 0x47, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xd7, 0xff, 0xeb, 0xff, 0xff, 0xff,
+    0x80, 0xff, 0xeb, 0xff, 0xd7, 0xff, 0xff, 0xff, 0x40, 0xff, 0xff, 0xff, 0x47, 0xff, 0xff, 0xff,
+    0x00, 0xfd, 0xff, 0xff, 0x03, 0xfe, 0xff, 0xff, 0x00, 0xf4, 0xff, 0xff, 0x03, 0xf8, 0xff, 0xff,
+    0x00, 0xe0, 0xff, 0xff, 0x02, 0x90, 0xfe, 0xff, 0x00, 0x90, 0xff, 0xff, 0x01, 0x00, 0xe4, 0xff,
+    0x00, 0x00, 0xfd, 0xbf, 0x00, 0x00, 0x40, 0x6f, 0x00, 0x00, 0xf4, 0x2f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x90, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'h' (104)
+    0x00, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2f,
+    0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2f, 0x00, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f,
+    0x00, 0x90, 0xaa, 0xfe, 0xff, 0xff, 0xaa, 0x06, 0x00, 0x00, 0x00, 0xe4, 0xff, 0x7f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0xff, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x1f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xe0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x7f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xc0, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xff, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xe0, 0x7f, 0x00, 0x00, 0x00, 0x90, 0xaa, 0xaa, 0xfe, 0x1f, 0x00, 0x00,
+    0x00, 0xf4, 0xff, 0xff, 0xff, 0x0b, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xff, 0xff, 0x06, 0x00, 0x00,
+    0x00, 0xf8, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x00,
+    0x00, 0x90, 0xaa, 0xaa, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'i' (105)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x01, 0x00, 0x40, 0x6f, 0x00, 0x00,
+    0x40, 0xff, 0x1b, 0x00, 0xe4, 0xff, 0x01, 0x00, 0x80, 0xff, 0xbf, 0xaa, 0xfe, 0xff, 0x02, 0x00,
+    0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00,
+    0x80, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0x2f, 0x00, 0x00,
+    0x80, 0xff, 0xbf, 0xaa, 0xaa, 0x06, 0x00, 0x00, 0x40, 0xff, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xf9, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'j' (106)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x90, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xf4, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xfd, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xbf, 0xaa, 0xaa, 0x06, 0x00, 0x00,
+    0x00, 0xe0, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x90, 0xff, 0xff, 0xff, 0x2f, 0x00, 0x00,
+    0x00, 0x00, 0xfd, 0xff, 0xff, 0x2f, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xff, 0x1f, 0x00, 0x00,
+    0x00, 0x00, 0x90, 0xaa, 0xaa, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'k' (107)
+    0x00, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2f,
+    0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2f, 0x00, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f,
+    0x00, 0x90, 0xaa, 0xfe, 0xff, 0xbf, 0xaa, 0x06, 0x00, 0x00, 0x00, 0xf4, 0xff, 0x1f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xd0, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xff, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xd0, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xff, 0x0b, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xf0, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xff, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x90, 0x03, 0x69, 0xc0, 0x06, 0x00, 0x00, 0x90, 0xfe, 0x0f, 0x00, 0xf0, 0x0b, 0x00,
+    0x00, 0xf4, 0xff, 0x0b, 0x00, 0xe0, 0x0f, 0x00, 0x00, 0xf8, 0xff, 0x06, 0x00, 0x90, 0x03, 0x00,
+    0x00, 0xf8, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x90, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'l' (108)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x01, 0x00, 0x00, 0x00, 0x40, 0x6f,
+    0x40, 0xff, 0x1b, 0x00, 0x00, 0x00, 0xe4, 0xff, 0x80, 0xff, 0xbf, 0xaa, 0xaa, 0xaa, 0xfe, 0xff,
+    0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2f,
+    0x80, 0xff, 0xbf, 0xaa, 0xaa, 0xaa, 0xaa, 0x06, 0x40, 0xff, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xf9, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'm' (109)
+    0x00, 0xf4, 0xff, 0xff, 0xff, 0x2f, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xff, 0xff, 0xbf, 0x00, 0x00,
+    0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0xf4, 0xff, 0xff, 0xff, 0xff, 0x02, 0x00,
+    0x00, 0xd0, 0xff, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00, 0x40, 0x55, 0x55, 0xfe, 0xff, 0x01, 0x00,
+    0x00, 0x40, 0x55, 0x55, 0xfe, 0x7f, 0x00, 0x00, 0x00, 0xd0, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x00,
+    0x00, 0xf4, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xff, 0xff, 0x2f, 0x00, 0x00,
+    0x00, 0xf8, 0xff, 0xff, 0xff, 0x2f, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x00,
+    0x00, 0xd0, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x40, 0x55, 0x55, 0xfe, 0x7f, 0x00, 0x00,
+    0x00, 0x40, 0x55, 0x55, 0xfe, 0xff, 0x01, 0x00, 0x00, 0xd0, 0xff, 0xff, 0xff, 0xff, 0x02, 0x00,
+    0x00, 0xf4, 0xff, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00,
+    0x00, 0xf8, 0xff, 0xff, 0xff, 0xbf, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xff, 0xff, 0x2f, 0x00, 0x00,
+    0x00, 0x90, 0xaa, 0xaa, 0xaa, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'n' (110)
+    0x00, 0xf4, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xff, 0xff, 0x2f, 0x00, 0x00,
+    0x00, 0xf8, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x00,
+    0x00, 0x90, 0xaa, 0xfe, 0xff, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0xff, 0x2f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0xff, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x1f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xe0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x7f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xc0, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xff, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xe0, 0x7f, 0x00, 0x00, 0x00, 0x90, 0xaa, 0xaa, 0xfe, 0x1f, 0x00, 0x00,
+    0x00, 0xf4, 0xff, 0xff, 0xff, 0x0b, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xff, 0xff, 0x06, 0x00, 0x00,
+    0x00, 0xf8, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x00,
+    0x00, 0x90, 0xaa, 0xaa, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'o' (111)
+    0x00, 0x00, 0xf4, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xff, 0x7f, 0x00, 0x00, 0x00,
+    0x00, 0x90, 0xff, 0xff, 0xff, 0x06, 0x00, 0x00, 0x00, 0xe0, 0xff, 0xff, 0xff, 0x0b, 0x00, 0x00,
+    0x00, 0xf4, 0xbf, 0xaa, 0xfe, 0x1f, 0x00, 0x00, 0x00, 0xfd, 0x0b, 0x00, 0xe0, 0x7f, 0x00, 0x00,
+    0x40, 0xff, 0x03, 0x00, 0xc0, 0xff, 0x01, 0x00, 0x80, 0xff, 0x02, 0x00, 0x80, 0xff, 0x02, 0x00,
+    0x80, 0xff, 0x02, 0x00, 0x80, 0xff, 0x02, 0x00, 0x80, 0xff, 0x02, 0x00, 0x80, 0xff, 0x02, 0x00,
+    0x80, 0xff, 0x02, 0x00, 0x80, 0xff, 0x02, 0x00, 0x80, 0xff, 0x02, 0x00, 0x80, 0xff, 0x02, 0x00,
+    0x80, 0xff, 0x02, 0x00, 0x80, 0xff, 0x02, 0x00, 0x40, 0xff, 0x03, 0x00, 0xc0, 0xff, 0x01, 0x00,
+    0x00, 0xfd, 0x0b, 0x00, 0xe0, 0x7f, 0x00, 0x00, 0x00, 0xf4, 0xbf, 0xaa, 0xfe, 0x1f, 0x00, 0x00,
+    0x00, 0xe0, 0xff, 0xff, 0xff, 0x0b, 0x00, 0x00, 0x00, 0x90, 0xff, 0xff, 0xff, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0xfd, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0x1f, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x90, 0xaa, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'p' (112)
+    0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x2f, 0x00, 0x00, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x00,
+    0x40, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x02,
+    0x80, 0xff, 0xff, 0xff, 0xbf, 0xfe, 0xff, 0x02, 0x40, 0xff, 0xff, 0xff, 0x1f, 0xf4, 0xff, 0x02,
+    0x00, 0xf9, 0xfe, 0xff, 0x07, 0xd0, 0xff, 0x02, 0x00, 0x00, 0xd0, 0xff, 0x02, 0x80, 0xff, 0x02,
+    0x00, 0x00, 0x80, 0xff, 0x02, 0x80, 0xff, 0x02, 0x00, 0x00, 0x80, 0xff, 0x02, 0x80, 0xff, 0x02,
+    0x00, 0x00, 0x80, 0xff, 0x02, 0x80, 0xff, 0x02, 0x00, 0x00, 0x80, 0xff, 0x02, 0x80, 0xff, 0x02,
+    0x00, 0x00, 0x80, 0xff, 0x02, 0x80, 0xff, 0x02, 0x00, 0x00, 0x40, 0xff, 0x03, 0xc0, 0xff, 0x01,
+    0x00, 0x00, 0x00, 0xfd, 0x0b, 0xe0, 0x7f, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xbf, 0xfe, 0x1f, 0x00,
+    0x00, 0x00, 0x00, 0xe0, 0xff, 0xff, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x90, 0xff, 0xff, 0x06, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xfd, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x1f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x90, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'q' (113)
+    0x00, 0x00, 0x00, 0x00, 0xf4, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x7f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x90, 0xff, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xff, 0xff, 0x0b, 0x00,
+    0x00, 0x00, 0x00, 0xf4, 0xbf, 0xfe, 0x1f, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x0b, 0xe0, 0x7f, 0x00,
+    0x00, 0x00, 0x40, 0xff, 0x03, 0xc0, 0xff, 0x01, 0x00, 0x00, 0x80, 0xff, 0x02, 0x80, 0xff, 0x02,
+    0x00, 0x00, 0x80, 0xff, 0x02, 0x80, 0xff, 0x02, 0x00, 0x00, 0x80, 0xff, 0x02, 0x80, 0xff, 0x02,
+    0x00, 0x00, 0x80, 0xff, 0x02, 0x80, 0xff, 0x02, 0x00, 0x00, 0x80, 0xff, 0x02, 0x80, 0xff, 0x02,
+    0x00, 0x00, 0xd0, 0xff, 0x02, 0x80, 0xff, 0x02, 0x00, 0xf9, 0xfe, 0xff, 0x07, 0xd0, 0xff, 0x02,
+    0x40, 0xff, 0xff, 0xff, 0x1f, 0xf4, 0xff, 0x02, 0x80, 0xff, 0xff, 0xff, 0xbf, 0xfe, 0xff, 0x02,
+    0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x02, 0x40, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01,
+    0x00, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x00, 0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x2f, 0x00,
+    0x00, 0x90, 0xaa, 0xaa, 0xaa, 0xaa, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'r' (114)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0xff, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xbf, 0xaa, 0xaa, 0x06, 0x00, 0x00,
+    0x80, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0x2f, 0x00, 0x00,
+    0x80, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x00,
+    0x80, 0xff, 0xbf, 0xfe, 0xff, 0x2f, 0x00, 0x00, 0x40, 0xff, 0x1b, 0xe4, 0xff, 0x2f, 0x00, 0x00,
+    0x00, 0xf9, 0x01, 0x40, 0xff, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x1f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xf4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x0b, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xf8, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x0f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xf0, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 's' (115)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0xff, 0x01, 0x90, 0xeb, 0x06, 0x00, 0x00, 0x80, 0xff, 0x02, 0xe0, 0xff, 0x0b, 0x00, 0x00,
+    0x80, 0xff, 0x03, 0xf4, 0xff, 0x1f, 0x00, 0x00, 0x80, 0xff, 0x03, 0xfd, 0xff, 0x7f, 0x00, 0x00,
+    0x80, 0xff, 0x47, 0xff, 0xff, 0xff, 0x01, 0x00, 0x80, 0xff, 0xd7, 0xff, 0xeb, 0xff, 0x02, 0x00,
+    0x80, 0xff, 0xd7, 0xff, 0xd7, 0xff, 0x02, 0x00, 0x80, 0xff, 0xd7, 0xff, 0xd7, 0xff, 0x02, 0x00,
+    0x80, 0xff, 0xd7, 0xff, 0xd7, 0xff, 0x02, 0x00, 0x80, 0xff, 0xd7, 0xff, 0xd7, 0xff, 0x02, 0x00,
+    0x80, 0xff, 0xeb, 0xff, 0xd7, 0xff, 0x02, 0x00, 0x40, 0xff, 0xff, 0xff, 0xd1, 0xff, 0x02, 0x00,
+    0x00, 0xfd, 0xff, 0x7f, 0xc0, 0xff, 0x02, 0x00, 0x00, 0xf4, 0xff, 0x1f, 0xc0, 0xff, 0x02, 0x00,
+    0x00, 0xe0, 0xff, 0x0b, 0x80, 0xff, 0x02, 0x00, 0x00, 0x90, 0xeb, 0x06, 0x40, 0xff, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 't' (116)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xaa, 0xaa, 0xaa, 0xaa, 0x06,
+    0x00, 0x00, 0xf4, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x00, 0xfd, 0xff, 0xff, 0xff, 0xff, 0x2f,
+    0x00, 0x90, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2f, 0x00, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f,
+    0x00, 0xf4, 0xbf, 0xaa, 0xfe, 0xff, 0xbf, 0x06, 0x00, 0xfd, 0x0b, 0x00, 0xf4, 0xff, 0x1f, 0x00,
+    0x40, 0xff, 0x03, 0x00, 0xd0, 0xff, 0x07, 0x00, 0x80, 0xff, 0x02, 0x00, 0x80, 0xff, 0x02, 0x00,
+    0x80, 0xff, 0x02, 0x00, 0x80, 0xff, 0x02, 0x00, 0x40, 0xff, 0x03, 0x00, 0x40, 0xff, 0x01, 0x00,
+    0x00, 0xfd, 0x07, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0xf4, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xe0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'u' (117)
+    0x00, 0x00, 0xf4, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xff, 0xff, 0x2f, 0x00, 0x00,
+    0x00, 0x90, 0xff, 0xff, 0xff, 0x2f, 0x00, 0x00, 0x00, 0xe0, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x00,
+    0x00, 0xf4, 0xbf, 0xaa, 0xaa, 0x06, 0x00, 0x00, 0x00, 0xfd, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xfd, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xf4, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xf8, 0xff, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xbf, 0xaa, 0x06, 0x00, 0x00,
+    0x00, 0xfc, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x00, 0xfc, 0xff, 0xff, 0xff, 0x2f, 0x00, 0x00,
+    0x00, 0xf8, 0xff, 0xff, 0xff, 0x2f, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x00,
+    0x00, 0x90, 0xaa, 0xaa, 0xaa, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'v' (118)
+    0x00, 0x00, 0x00, 0xf4, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xff, 0x2f, 0x00, 0x00,
+    0x00, 0x00, 0x90, 0xff, 0xff, 0x2f, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xff, 0xff, 0x1f, 0x00, 0x00,
+    0x00, 0x00, 0xf0, 0xbf, 0xaa, 0x06, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x06, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x90, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xf0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xe0, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xe0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xc0, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xbf, 0xaa, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0xe0, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x90, 0xff, 0xff, 0x2f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xfd, 0xff, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0x1f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x90, 0xaa, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'w' (119)
+    0x00, 0x00, 0xf4, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xff, 0xff, 0x2f, 0x00, 0x00,
+    0x00, 0x90, 0xff, 0xff, 0xff, 0x2f, 0x00, 0x00, 0x00, 0xe0, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x00,
+    0x00, 0xf0, 0xff, 0xff, 0xaa, 0x06, 0x00, 0x00, 0x00, 0xe0, 0xbf, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xe0, 0xbf, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xf4, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0x2f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xf8, 0xff, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xf0, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xbf, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xe0, 0xbf, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xff, 0xff, 0xaa, 0x06, 0x00, 0x00,
+    0x00, 0xe0, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x90, 0xff, 0xff, 0xff, 0x2f, 0x00, 0x00,
+    0x00, 0x00, 0xfd, 0xff, 0xff, 0x2f, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xff, 0x1f, 0x00, 0x00,
+    0x00, 0x00, 0x90, 0xaa, 0xaa, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'x' (120)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xc0, 0x06, 0x00, 0x90, 0x03, 0x00, 0x00, 0x00, 0xf0, 0x0b, 0x00, 0xe0, 0x0f, 0x00, 0x00,
+    0x00, 0xe0, 0x0f, 0x00, 0xf0, 0x0b, 0x00, 0x00, 0x00, 0x90, 0x03, 0x69, 0xc0, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0xc0, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xff, 0x0f, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xf4, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0x2f, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xf8, 0xff, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0x1f, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xf0, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xff, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x90, 0x03, 0x69, 0xc0, 0x06, 0x00, 0x00, 0x00, 0xe0, 0x0f, 0x00, 0xf0, 0x0b, 0x00, 0x00,
+    0x00, 0xf0, 0x0b, 0x00, 0xe0, 0x0f, 0x00, 0x00, 0x00, 0xc0, 0x06, 0x00, 0x90, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'y' (121)
+    0x00, 0x00, 0x00, 0xf8, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x69, 0x00, 0xfe, 0xff, 0xff, 0x2f, 0x00,
+    0x40, 0xff, 0x41, 0xff, 0xff, 0xff, 0x2f, 0x00, 0x80, 0xff, 0xd7, 0xff, 0xff, 0xff, 0x1f, 0x00,
+    0x80, 0xff, 0xd7, 0xff, 0xbf, 0xaa, 0x06, 0x00, 0x80, 0xff, 0xd7, 0xff, 0x1f, 0x00, 0x00, 0x00,
+    0x80, 0xff, 0xd7, 0xff, 0x07, 0x00, 0x00, 0x00, 0x80, 0xff, 0xd7, 0xff, 0x02, 0x00, 0x00, 0x00,
+    0x80, 0xff, 0xd7, 0xff, 0x02, 0x00, 0x00, 0x00, 0x80, 0xff, 0xd7, 0xff, 0x02, 0x00, 0x00, 0x00,
+    0x80, 0xff, 0xd7, 0xff, 0x02, 0x00, 0x00, 0x00, 0x80, 0xff, 0xd7, 0xff, 0x02, 0x00, 0x00, 0x00,
+    0x80, 0xff, 0xeb, 0xff, 0x02, 0x00, 0x00, 0x00, 0x40, 0xff, 0xff, 0xff, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0xfd, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xff, 0xbf, 0xaa, 0x06, 0x00,
+    0x00, 0xe0, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x90, 0xff, 0xff, 0xff, 0xff, 0x2f, 0x00,
+    0x00, 0x00, 0xfd, 0xff, 0xff, 0xff, 0x2f, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xff, 0xff, 0x1f, 0x00,
+    0x00, 0x00, 0x90, 0xaa, 0xaa, 0xaa, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // 'z' (122)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x01, 0x00, 0x00, 0x69, 0x00, 0x00,
+    0x40, 0xff, 0x0b, 0x00, 0x40, 0xff, 0x01, 0x00, 0x80, 0xff, 0x1f, 0x00, 0x80, 0xff, 0x02, 0x00,
+    0x80, 0xff, 0x3f, 0x00, 0x80, 0xff, 0x02, 0x00, 0x80, 0xff, 0xbf, 0x00, 0x80, 0xff, 0x02, 0x00,
+    0x80, 0xff, 0xff, 0x06, 0x80, 0xff, 0x02, 0x00, 0x80, 0xff, 0xff, 0x0b, 0x80, 0xff, 0x02, 0x00,
+    0x80, 0xff, 0xff, 0x0f, 0xd0, 0xff, 0x02, 0x00, 0x80, 0xff, 0xff, 0x03, 0xf9, 0xff, 0x02, 0x00,
+    0x80, 0xff, 0x6f, 0xc0, 0xff, 0xff, 0x02, 0x00, 0x80, 0xff, 0x07, 0xf0, 0xff, 0xff, 0x02, 0x00,
+    0x80, 0xff, 0x02, 0xe0, 0xff, 0xff, 0x02, 0x00, 0x80, 0xff, 0x02, 0x90, 0xff, 0xff, 0x02, 0x00,
+    0x80, 0xff, 0x02, 0x00, 0xfe, 0xff, 0x02, 0x00, 0x80, 0xff, 0x02, 0x00, 0xfc, 0xff, 0x02, 0x00,
+    0x80, 0xff, 0x02, 0x00, 0xf4, 0xff, 0x02, 0x00, 0x40, 0xff, 0x01, 0x00, 0xe0, 0xff, 0x01, 0x00,
+    0x00, 0x69, 0x00, 0x00, 0x40, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '{' (123)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x90, 0xeb, 0x06, 0x00, 0x00, 0x00, 0x00, 0x90, 0xfe, 0xff, 0xbf, 0x06, 0x00,
+    0x00, 0x00, 0xf4, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x00, 0xfd, 0xff, 0xff, 0xff, 0x7f, 0x00,
+    0x00, 0x90, 0xff, 0x7f, 0x69, 0xfd, 0xff, 0x06, 0x00, 0xe0, 0xff, 0x1f, 0x00, 0xf4, 0xff, 0x0b,
+    0x00, 0xf4, 0xbf, 0x06, 0x00, 0x90, 0xfe, 0x1f, 0x00, 0xfd, 0x0b, 0x00, 0x00, 0x00, 0xe0, 0x7f,
+    0x40, 0xff, 0x03, 0x00, 0x00, 0x00, 0xc0, 0xff, 0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x80, 0xff,
+    0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x80, 0xff, 0x40, 0xff, 0x03, 0x00, 0x00, 0x00, 0xc0, 0xff,
+    0x00, 0xfd, 0x07, 0x00, 0x00, 0x00, 0xd0, 0x7f, 0x00, 0xf4, 0x0b, 0x00, 0x00, 0x00, 0xe0, 0x1f,
+    0x00, 0xe0, 0x0f, 0x00, 0x00, 0x00, 0xf0, 0x0b, 0x00, 0x90, 0x03, 0x00, 0x00, 0x00, 0xc0, 0x06,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '|' (124)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x06,
+    0x00, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2f,
+    0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2f, 0x00, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f,
+    0x00, 0x90, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '}' (125)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x90, 0x03, 0x00, 0x00, 0x00, 0xc0, 0x06, 0x00, 0xe0, 0x0f, 0x00, 0x00, 0x00, 0xf0, 0x0b,
+    0x00, 0xf4, 0x0b, 0x00, 0x00, 0x00, 0xe0, 0x1f, 0x00, 0xfd, 0x07, 0x00, 0x00, 0x00, 0xd0, 0x7f,
+    0x40, 0xff, 0x03, 0x00, 0x00, 0x00, 0xc0, 0xff, 0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x80, 0xff,
+    0x80, 0xff, 0x02, 0x00, 0x00, 0x00, 0x80, 0xff, 0x40, 0xff, 0x03, 0x00, 0x00, 0x00, 0xc0, 0xff,
+    0x00, 0xfd, 0x0b, 0x00, 0x00, 0x00, 0xe0, 0x7f, 0x00, 0xf4, 0xbf, 0x06, 0x00, 0x90, 0xfe, 0x1f,
+    0x00, 0xe0, 0xff, 0x1f, 0x00, 0xf4, 0xff, 0x0b, 0x00, 0x90, 0xff, 0x7f, 0x69, 0xfd, 0xff, 0x06,
+    0x00, 0x00, 0xfd, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xff, 0xff, 0x1f, 0x00,
+    0x00, 0x00, 0x90, 0xfe, 0xff, 0xbf, 0x06, 0x00, 0x00, 0x00, 0x00, 0x90, 0xeb, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '~' (126)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xc0, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x0b, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xf4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x0b, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xf8, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x0f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xf0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x2f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xe0, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x1f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xe0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { // '°' (176)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  }
+};
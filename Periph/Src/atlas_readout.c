@@ -0,0 +1,223 @@
+/*
+ * Filename: atlas_readout.c
+ * Description: font_dot_10x14 in 0xffe0 on 0x001f, 15 glyphs.
+ *              Generated by Tools/atlas.py, do not edit.
+ */
+
+#include "atlas.h"
+
+
+static const uint16_t atlas_readout_pixels[2880] = {
+  // ' ' (32)
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  // '0' (48)
+  0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0x001f, 0x001f,
+  0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0,
+  0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0,
+  0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0,
+  0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0,
+  0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0xffe0, 0xffe0,
+  0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0xffe0, 0xffe0,
+  0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  // '1' (49)
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0,
+  0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0,
+  0x001f, 0x001f, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0,
+  0x001f, 0x001f, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0,
+  0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  // '2' (50)
+  0x001f, 0x001f, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f,
+  0x001f, 0x001f, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f,
+  0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0,
+  0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0,
+  0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0,
+  0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0,
+  0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0,
+  0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0,
+  0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0x001f, 0x001f,
+  0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  // '3' (51)
+  0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f,
+  0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0,
+  0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0,
+  0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0,
+  0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0,
+  0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0,
+  0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0,
+  0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0x001f, 0x001f, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0x001f, 0x001f, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  // '4' (52)
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0,
+  0x001f, 0x001f, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  // '5' (53)
+  0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0,
+  0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0,
+  0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0,
+  0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0,
+  0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0,
+  0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0,
+  0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0,
+  0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0,
+  0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0,
+  0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  // '6' (54)
+  0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0x001f, 0x001f,
+  0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0,
+  0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0,
+  0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0,
+  0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0,
+  0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0,
+  0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0,
+  0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0,
+  0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  // '7' (55)
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0,
+  0x001f, 0x001f, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0,
+  0x001f, 0x001f, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  // '8' (56)
+  0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0x001f, 0x001f, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0x001f, 0x001f, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0x001f, 0x001f,
+  0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0,
+  0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0,
+  0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0,
+  0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0,
+  0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0,
+  0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0,
+  0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0x001f, 0x001f, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0x001f, 0x001f, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  // '9' (57)
+  0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0x001f, 0x001f,
+  0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0,
+  0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0,
+  0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0,
+  0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0,
+  0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0,
+  0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0,
+  0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  // ':' (58)
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  // 'x' (120)
+  0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  // 'y' (121)
+  0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0x001f, 0x001f,
+  0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0x001f, 0x001f,
+  0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  // '-' (45)
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0xffe0, 0xffe0, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f,
+  0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f, 0x001f
+};
+
+static const uint8_t atlas_readout_index[96] = {
+  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0e, 0xff, 0xff,
+  0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0c, 0x0d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+};
+
+const FontAtlas_TypeDef atlas_readout = {
+  .Font    = (const uint8_t*)font_dot_10x14,
+  .Color   = 0xffe0,
+  .Bgcolor = 0x001f,
+  .Index   = atlas_readout_index,
+  .Pixels  = atlas_readout_pixels,
+};
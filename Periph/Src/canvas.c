@@ -0,0 +1,229 @@
+/**
+  ******************************************************************************
+  * @file           : canvas.c
+  * @brief          : This file contain in-RAM drawing primitives code. Every
+  *                   primitive is clipped to the canvas, so a scene can be
+  *                   painted band by band.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2017-2026 Askug Ltd.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#include "canvas.h"
+
+
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Cuts a rectangle down to the canvas, the result is relative to
+ *          the canvas origin.
+ * @retval  false when nothing is left to draw
+ */
+__STATIC_INLINE bool canvas_clip(Canvas_TypeDef* cv, int32_t* x0, int32_t* y0, int32_t* x1, int32_t* y1) {
+  *x0 -= cv->X; *x1 -= cv->X;
+  *y0 -= cv->Y; *y1 -= cv->Y;
+
+  if (*x0 < 0) *x0 = 0;
+  if (*y0 < 0) *y0 = 0;
+  if (*x1 > cv->W) *x1 = cv->W;
+  if (*y1 > cv->H) *y1 = cv->H;
+
+  return ((*x1 > *x0) && (*y1 > *y0));
+}
+
+
+// --------------------------------------------------------------------------
+
+void Canvas_Fill(Canvas_TypeDef* cv, uint16_t c) {
+  uint32_t total = (uint32_t)cv->W * cv->H;
+
+  for (uint32_t i = 0; i < total; i++) {
+    cv->Buf[i] = c;
+  }
+}
+
+
+// --------------------------------------------------------------------------
+
+void Canvas_FillRectangle(Canvas_TypeDef* cv, int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t c) {
+
+  int32_t x0 = x, y0 = y, x1 = x + w, y1 = y + h;
+  if (!canvas_clip(cv, &x0, &y0, &x1, &y1)) return;
+
+  for (int32_t col = x0; col < x1; col++) {
+    uint16_t* px = &cv->Buf[(col * cv->H) + y0];
+    for (int32_t row = y0; row < y1; row++) {
+      *px++ = c;
+    }
+  }
+}
+
+
+// --------------------------------------------------------------------------
+
+void Canvas_DrawRectangle(Canvas_TypeDef* cv, int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t b, uint16_t c) {
+  Canvas_DrawVLine(cv, x, y, (w + b), b, c);
+  Canvas_DrawVLine(cv, (x + h), y, (w + b), b, c);
+  Canvas_DrawHLine(cv, x, y, h, b, c);
+  Canvas_DrawHLine(cv, x, (y + w), h, b, c);
+}
+
+
+// --------------------------------------------------------------------------
+
+void Canvas_DrawPixel(Canvas_TypeDef* cv, int16_t x, int16_t y, uint16_t c) {
+  Canvas_FillRectangle(cv, x, y, 1, 1, c);
+}
+
+
+// --------------------------------------------------------------------------
+
+void Canvas_DrawVLine(Canvas_TypeDef* cv, int16_t x, int16_t y, uint16_t l, uint16_t b, uint16_t c) {
+  Canvas_FillRectangle(cv, x, y, b, l, c);
+}
+
+
+// --------------------------------------------------------------------------
+
+void Canvas_DrawHLine(Canvas_TypeDef* cv, int16_t x, int16_t y, uint16_t l, uint16_t b, uint16_t c) {
+  Canvas_FillRectangle(cv, x, y, l, b, c);
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Paints the ring pixels over the canvas, everything else is left
+ *          as it is.
+ */
+static void canvas_draw_ring(Canvas_TypeDef* cv, Ring_TypeDef* s, uint16_t c) {
+
+  int32_t x0 = s->Outer.X, x1 = s->Outer.X + s->Outer.W;
+  if (x0 < cv->X) x0 = cv->X;
+  if (x1 > (cv->X + cv->W)) x1 = cv->X + cv->W;
+
+  for (int32_t x = x0; x < x1; x++) {
+    int16_t sp[4];
+
+    Shape_RingSpan(s, x, &sp[0], &sp[1], &sp[2], &sp[3]);
+
+    for (uint32_t k = 0; k < 4; k += 2) {
+      if (s->Sweep >= 360) {
+        if (sp[k + 1] >= sp[k]) Canvas_FillRectangle(cv, x, sp[k], 1, (sp[k + 1] - sp[k] + 1), c);
+        continue;
+      }
+      for (int32_t y = sp[k]; y <= sp[k + 1]; y++) {
+        if (Shape_ArcInside(s, x, y)) Canvas_DrawPixel(cv, x, y, c);
+      }
+    }
+  }
+}
+
+
+// --------------------------------------------------------------------------
+
+void Canvas_DrawCircle(Canvas_TypeDef* cv, int16_t x0, int16_t y0, uint16_t r, uint16_t b, uint16_t c) {
+  Ring_TypeDef s;
+
+  Shape_Ring(&s, x0, y0, r, b);
+  canvas_draw_ring(cv, &s, c);
+}
+
+
+// --------------------------------------------------------------------------
+
+void Canvas_DrawArc(Canvas_TypeDef* cv, int16_t x0, int16_t y0, uint16_t r, uint16_t b, int16_t start, int16_t end, uint16_t c) {
+  Ring_TypeDef s;
+
+  Shape_Arc(&s, x0, y0, r, b, start, end);
+  canvas_draw_ring(cv, &s, c);
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Fills a shape column by column, the columns are contiguous in the
+ *          canvas.
+ */
+static void canvas_fill_shape(Canvas_TypeDef* cv, Shape_TypeDef* s, uint16_t c) {
+
+  int32_t x0 = s->X, x1 = s->X + s->W;
+  if (x0 < cv->X) x0 = cv->X;
+  if (x1 > (cv->X + cv->W)) x1 = cv->X + cv->W;
+
+  for (int32_t x = x0; x < x1; x++) {
+    int16_t top, bottom;
+
+    Shape_Span(s, x, &top, &bottom);
+    Canvas_FillRectangle(cv, x, top, 1, (bottom - top + 1), c);
+  }
+}
+
+
+// --------------------------------------------------------------------------
+
+void Canvas_FillCircle(Canvas_TypeDef* cv, int16_t x0, int16_t y0, uint16_t r, uint16_t c) {
+  Shape_TypeDef s;
+
+  Shape_Circle(&s, x0, y0, r);
+  canvas_fill_shape(cv, &s, c);
+}
+
+
+// --------------------------------------------------------------------------
+
+void Canvas_FillEllipse(Canvas_TypeDef* cv, int16_t x0, int16_t y0, uint16_t rx, uint16_t ry, uint16_t c) {
+  Shape_TypeDef s;
+
+  Shape_Ellipse(&s, x0, y0, rx, ry);
+  canvas_fill_shape(cv, &s, c);
+}
+
+
+// --------------------------------------------------------------------------
+
+void Canvas_FillRoundRect(Canvas_TypeDef* cv, int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t r, uint16_t c) {
+  Shape_TypeDef s;
+
+  Shape_RoundRect(&s, x, y, w, h, r);
+  canvas_fill_shape(cv, &s, c);
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Prints a UTF-8 string up to NUL or '\n', glyphs are cut to the
+ *          canvas.
+ */
+void Canvas_PrintString(Canvas_TypeDef* cv, int16_t x, int16_t y, Font_TypeDef* f, const char* str) {
+
+  if (!str || !f) return;
+
+  for (int32_t gx = x; *str && (*str != '\n'); gx += f->Width) {
+    uint16_t code;
+    str += Glyph_Decode(str, 3, &code);
+
+    int32_t x0 = gx, y0 = y, x1 = gx + f->Width, y1 = y + f->Height;
+
+    if (x0 >= (cv->X + cv->W)) break;
+    if (!canvas_clip(cv, &x0, &y0, &x1, &y1)) continue;
+
+    // glyph columns/rows that land on the canvas
+    uint16_t c0 = x0 + cv->X - gx;
+    uint16_t r0 = y0 + cv->Y - y;
+
+    GlyphCache_Expand(f, code, &cv->Buf[(x0 * cv->H) + y0], cv->H, c0, (c0 + x1 - x0), r0, (r0 + y1 - y0));
+  }
+}
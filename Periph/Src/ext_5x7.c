@@ -0,0 +1,205 @@
+/*
+ * Filename: ext_5x7.c
+ * Description: font_dot_5x7 with Cyrillic, arrows and a few signs, 170 glyphs.
+ *              Generated by Tools/extfont.py, do not edit.
+ */
+
+#include "extfont.h"
+
+
+const uint8_t font_ext_5x7[170][6] = {
+  {0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, // U+0020
+  {0x00, 0x00, 0x00, 0xfa, 0x00, 0x00}, // U+0021
+  {0x00, 0x00, 0xe0, 0x00, 0xe0, 0x00}, // U+0022
+  {0x48, 0xfe, 0x48, 0xfe, 0x48, 0x00}, // U+0023
+  {0x24, 0x54, 0xfe, 0x54, 0x48, 0x00}, // U+0024
+  {0xe6, 0xa8, 0xf6, 0x2a, 0xce, 0x00}, // U+0025
+  {0x6c, 0x92, 0x92, 0x7c, 0x12, 0x00}, // U+0026
+  {0x00, 0x00, 0xc0, 0x00, 0x00, 0x00}, // U+0027
+  {0x00, 0x00, 0x7c, 0x82, 0x00, 0x00}, // U+0028
+  {0x00, 0x82, 0x7c, 0x00, 0x00, 0x00}, // U+0029
+  {0x00, 0x00, 0x50, 0xe0, 0x50, 0x00}, // U+002A
+  {0x10, 0x10, 0x7c, 0x10, 0x10, 0x00}, // U+002B
+  {0x00, 0x05, 0x06, 0x00, 0x00, 0x00}, // U+002C
+  {0x00, 0x10, 0x10, 0x10, 0x00, 0x00}, // U+002D
+  {0x00, 0x02, 0x00, 0x00, 0x00, 0x00}, // U+002E
+  {0x06, 0x08, 0x10, 0x20, 0xc0, 0x00}, // U+002F
+  {0x7c, 0x8a, 0x92, 0xa2, 0x7c, 0x00}, // U+0030
+  {0x00, 0x00, 0x82, 0xfe, 0x02, 0x00}, // U+0031
+  {0x4e, 0x92, 0x92, 0x92, 0x62, 0x00}, // U+0032
+  {0x44, 0x82, 0x92, 0x92, 0x6c, 0x00}, // U+0033
+  {0xf0, 0x10, 0x10, 0xfe, 0x10, 0x00}, // U+0034
+  {0xf2, 0x92, 0x92, 0x92, 0x8c, 0x00}, // U+0035
+  {0x7c, 0x92, 0x92, 0x92, 0x8c, 0x00}, // U+0036
+  {0x80, 0x8e, 0x90, 0x90, 0xe0, 0x00}, // U+0037
+  {0x6c, 0x92, 0x92, 0x92, 0x6c, 0x00}, // U+0038
+  {0x64, 0x92, 0x92, 0x92, 0x7c, 0x00}, // U+0039
+  {0x00, 0x00, 0x24, 0x00, 0x00, 0x00}, // U+003A
+  {0x00, 0x02, 0x26, 0x00, 0x00, 0x00}, // U+003B
+  {0x00, 0x10, 0x28, 0x44, 0x00, 0x00}, // U+003C
+  {0x00, 0x28, 0x28, 0x28, 0x28, 0x00}, // U+003D
+  {0x00, 0x00, 0x44, 0x28, 0x10, 0x00}, // U+003E
+  {0x40, 0x80, 0x9a, 0x90, 0x60, 0x00}, // U+003F
+  {0x46, 0x92, 0xaa, 0xaa, 0x7c, 0x00}, // U+0040
+  {0x7e, 0x88, 0x88, 0x88, 0x7e, 0x00}, // U+0041
+  {0xfe, 0x92, 0x92, 0x92, 0x6c, 0x00}, // U+0042
+  {0x7c, 0x82, 0x82, 0x82, 0x44, 0x00}, // U+0043
+  {0xfe, 0x82, 0x82, 0x82, 0x7c, 0x00}, // U+0044
+  {0xfe, 0x92, 0x92, 0x82, 0x82, 0x00}, // U+0045
+  {0xfe, 0x90, 0x90, 0x80, 0x80, 0x00}, // U+0046
+  {0x7e, 0x82, 0x92, 0x92, 0x5c, 0x00}, // U+0047
+  {0xfe, 0x10, 0x10, 0x10, 0xfe, 0x00}, // U+0048
+  {0x82, 0x82, 0xfe, 0x82, 0x82, 0x00}, // U+0049
+  {0x8c, 0x82, 0x82, 0xfc, 0x80, 0x00}, // U+004A
+  {0xfe, 0x10, 0x10, 0x28, 0xc6, 0x00}, // U+004B
+  {0xfe, 0x02, 0x02, 0x02, 0x02, 0x00}, // U+004C
+  {0xfe, 0x40, 0x30, 0x40, 0xfe, 0x00}, // U+004D
+  {0xfe, 0x40, 0x20, 0x10, 0xfe, 0x00}, // U+004E
+  {0x7c, 0x82, 0x82, 0x82, 0x7c, 0x00}, // U+004F
+  {0xfe, 0x90, 0x90, 0x90, 0x60, 0x00}, // U+0050
+  {0x7c, 0x82, 0x86, 0x82, 0x7c, 0x00}, // U+0051
+  {0xfe, 0x88, 0x88, 0x88, 0x76, 0x00}, // U+0052
+  {0x62, 0x92, 0x92, 0x92, 0x8c, 0x00}, // U+0053
+  {0x80, 0x80, 0xfe, 0x80, 0x80, 0x00}, // U+0054
+  {0xfc, 0x02, 0x02, 0x02, 0xfc, 0x00}, // U+0055
+  {0xf8, 0x04, 0x02, 0x04, 0xf8, 0x00}, // U+0056
+  {0xfe, 0x04, 0x18, 0x04, 0xfe, 0x00}, // U+0057
+  {0xc6, 0x28, 0x10, 0x28, 0xc6, 0x00}, // U+0058
+  {0xe0, 0x10, 0x0e, 0x10, 0xe0, 0x00}, // U+0059
+  {0x86, 0x8a, 0x92, 0xa2, 0xc2, 0x00}, // U+005A
+  {0x00, 0x00, 0xfe, 0x82, 0x82, 0x00}, // U+005B
+  {0xc0, 0x20, 0x10, 0x08, 0x06, 0x00}, // U+005C
+  {0x82, 0x82, 0xfe, 0x00, 0x00, 0x00}, // U+005D
+  {0x20, 0x40, 0x80, 0x40, 0x20, 0x00}, // U+005E
+  {0x02, 0x02, 0x02, 0x02, 0x02, 0x00}, // U+005F
+  {0x00, 0x80, 0x40, 0x00, 0x00, 0x00}, // U+0060
+  {0x24, 0x2a, 0x2a, 0x2a, 0x1e, 0x00}, // U+0061
+  {0xfe, 0x22, 0x22, 0x22, 0x1c, 0x00}, // U+0062
+  {0x1c, 0x22, 0x22, 0x22, 0x12, 0x00}, // U+0063
+  {0x1c, 0x22, 0x22, 0x22, 0xfe, 0x00}, // U+0064
+  {0x1c, 0x2a, 0x2a, 0x2a, 0x1a, 0x00}, // U+0065
+  {0x10, 0x7e, 0x90, 0x90, 0x80, 0x00}, // U+0066
+  {0x6c, 0xb2, 0xaa, 0xea, 0x8c, 0x00}, // U+0067
+  {0xfe, 0x10, 0x20, 0x20, 0x1e, 0x00}, // U+0068
+  {0x00, 0x22, 0xbe, 0x02, 0x00, 0x00}, // U+0069
+  {0x04, 0x02, 0x02, 0xbc, 0x00, 0x00}, // U+006A
+  {0xfe, 0x10, 0x10, 0x28, 0x46, 0x00}, // U+006B
+  {0x00, 0x82, 0xfe, 0x02, 0x00, 0x00}, // U+006C
+  {0x3e, 0x20, 0x1c, 0x20, 0x3e, 0x00}, // U+006D
+  {0x3e, 0x10, 0x20, 0x20, 0x1e, 0x00}, // U+006E
+  {0x1c, 0x22, 0x22, 0x22, 0x1c, 0x00}, // U+006F
+  {0x7e, 0x4a, 0x48, 0x48, 0x30, 0x00}, // U+0070
+  {0x30, 0x48, 0x48, 0x4a, 0x7e, 0x00}, // U+0071
+  {0x02, 0x3e, 0x12, 0x20, 0x10, 0x00}, // U+0072
+  {0x12, 0x2a, 0x2a, 0x2a, 0x24, 0x00}, // U+0073
+  {0x00, 0xfc, 0x22, 0x22, 0x04, 0x00}, // U+0074
+  {0x3c, 0x02, 0x02, 0x04, 0x3e, 0x00}, // U+0075
+  {0x38, 0x04, 0x02, 0x04, 0x38, 0x00}, // U+0076
+  {0x3c, 0x02, 0x0c, 0x02, 0x3c, 0x00}, // U+0077
+  {0x22, 0x14, 0x08, 0x14, 0x22, 0x00}, // U+0078
+  {0x7a, 0x0a, 0x0a, 0x0a, 0x7c, 0x00}, // U+0079
+  {0x22, 0x26, 0x0a, 0x32, 0x22, 0x00}, // U+007A
+  {0x10, 0x6c, 0x82, 0x82, 0x44, 0x00}, // U+007B
+  {0x00, 0x00, 0x00, 0xef, 0x00, 0x00}, // U+007C
+  {0x44, 0x82, 0x82, 0x6c, 0x10, 0x00}, // U+007D
+  {0x00, 0x10, 0x20, 0x10, 0x20, 0x00}, // U+007E
+  {0x00, 0x00, 0x00, 0x00, 0x40, 0x00}, // U+00B0
+  {0x7e, 0x88, 0x88, 0x88, 0x7e, 0x00}, // U+0410
+  {0xfe, 0x92, 0x92, 0x92, 0x8c, 0x00}, // U+0411
+  {0xfe, 0x92, 0x92, 0x92, 0x6c, 0x00}, // U+0412
+  {0xfe, 0x80, 0x80, 0x80, 0x80, 0x00}, // U+0413
+  {0x03, 0xfe, 0x82, 0xfe, 0x03, 0x00}, // U+0414
+  {0xfe, 0x92, 0x92, 0x82, 0x82, 0x00}, // U+0415
+  {0xc6, 0x28, 0xfe, 0x28, 0xc6, 0x00}, // U+0416
+  {0x44, 0x82, 0x92, 0x92, 0x6c, 0x00}, // U+0417
+  {0xfe, 0x08, 0x10, 0x20, 0xfe, 0x00}, // U+0418
+  {0x7e, 0x08, 0x90, 0x20, 0x7e, 0x00}, // U+0419
+  {0xfe, 0x10, 0x10, 0x28, 0xc6, 0x00}, // U+041A
+  {0x02, 0x7c, 0x80, 0x80, 0xfe, 0x00}, // U+041B
+  {0xfe, 0x40, 0x30, 0x40, 0xfe, 0x00}, // U+041C
+  {0xfe, 0x10, 0x10, 0x10, 0xfe, 0x00}, // U+041D
+  {0x7c, 0x82, 0x82, 0x82, 0x7c, 0x00}, // U+041E
+  {0xfe, 0x80, 0x80, 0x80, 0xfe, 0x00}, // U+041F
+  {0xfe, 0x90, 0x90, 0x90, 0x60, 0x00}, // U+0420
+  {0x7c, 0x82, 0x82, 0x82, 0x44, 0x00}, // U+0421
+  {0x80, 0x80, 0xfe, 0x80, 0x80, 0x00}, // U+0422
+  {0xe4, 0x12, 0x12, 0x12, 0xfc, 0x00}, // U+0423
+  {0x30, 0x48, 0xfe, 0x48, 0x30, 0x00}, // U+0424
+  {0xc6, 0x28, 0x10, 0x28, 0xc6, 0x00}, // U+0425
+  {0xfe, 0x02, 0x02, 0xfe, 0x03, 0x00}, // U+0426
+  {0xe0, 0x10, 0x10, 0x10, 0xfe, 0x00}, // U+0427
+  {0xfe, 0x02, 0xfe, 0x02, 0xfe, 0x00}, // U+0428
+  {0xfe, 0x02, 0xfe, 0x02, 0xff, 0x00}, // U+0429
+  {0x80, 0xfe, 0x12, 0x12, 0x0c, 0x00}, // U+042A
+  {0xfe, 0x12, 0x0c, 0x00, 0xfe, 0x00}, // U+042B
+  {0xfe, 0x12, 0x12, 0x12, 0x0c, 0x00}, // U+042C
+  {0x44, 0x82, 0x92, 0x92, 0x7c, 0x00}, // U+042D
+  {0xfe, 0x10, 0x7c, 0x82, 0x7c, 0x00}, // U+042E
+  {0x62, 0x94, 0x98, 0x90, 0xfe, 0x00}, // U+042F
+  {0x24, 0x2a, 0x2a, 0x2a, 0x1e, 0x00}, // U+0430
+  {0x7c, 0xa2, 0xa2, 0xa2, 0x9c, 0x00}, // U+0431
+  {0x3e, 0x2a, 0x2a, 0x2a, 0x14, 0x00}, // U+0432
+  {0x3e, 0x20, 0x20, 0x20, 0x20, 0x00}, // U+0433
+  {0x06, 0x3c, 0x24, 0x3c, 0x06, 0x00}, // U+0434
+  {0x1c, 0x2a, 0x2a, 0x2a, 0x1a, 0x00}, // U+0435
+  {0x22, 0x14, 0x3e, 0x14, 0x22, 0x00}, // U+0436
+  {0x00, 0x22, 0x2a, 0x2a, 0x14, 0x00}, // U+0437
+  {0x3e, 0x04, 0x08, 0x10, 0x3e, 0x00}, // U+0438
+  {0x3e, 0x04, 0x48, 0x10, 0x3e, 0x00}, // U+0439
+  {0x3e, 0x08, 0x14, 0x22, 0x00, 0x00}, // U+043A
+  {0x02, 0x1c, 0x20, 0x20, 0x3e, 0x00}, // U+043B
+  {0x3e, 0x10, 0x08, 0x10, 0x3e, 0x00}, // U+043C
+  {0x3e, 0x08, 0x08, 0x08, 0x3e, 0x00}, // U+043D
+  {0x1c, 0x22, 0x22, 0x22, 0x1c, 0x00}, // U+043E
+  {0x3e, 0x20, 0x20, 0x20, 0x3e, 0x00}, // U+043F
+  {0x7e, 0x4a, 0x48, 0x48, 0x30, 0x00}, // U+0440
+  {0x1c, 0x22, 0x22, 0x22, 0x12, 0x00}, // U+0441
+  {0x20, 0x20, 0x3e, 0x20, 0x20, 0x00}, // U+0442
+  {0x7a, 0x0a, 0x0a, 0x0a, 0x7c, 0x00}, // U+0443
+  {0x18, 0x24, 0x7e, 0x24, 0x18, 0x00}, // U+0444
+  {0x22, 0x14, 0x08, 0x14, 0x22, 0x00}, // U+0445
+  {0x3e, 0x02, 0x02, 0x3e, 0x03, 0x00}, // U+0446
+  {0x30, 0x08, 0x08, 0x08, 0x3e, 0x00}, // U+0447
+  {0x3e, 0x02, 0x3e, 0x02, 0x3e, 0x00}, // U+0448
+  {0x3e, 0x02, 0x3e, 0x02, 0x3f, 0x00}, // U+0449
+  {0x20, 0x3e, 0x0a, 0x0a, 0x04, 0x00}, // U+044A
+  {0x3e, 0x0a, 0x04, 0x00, 0x3e, 0x00}, // U+044B
+  {0x3e, 0x0a, 0x0a, 0x0a, 0x04, 0x00}, // U+044C
+  {0x14, 0x22, 0x2a, 0x2a, 0x1c, 0x00}, // U+044D
+  {0x3e, 0x08, 0x1c, 0x22, 0x1c, 0x00}, // U+044E
+  {0x12, 0x2c, 0x28, 0x28, 0x3e, 0x00}, // U+044F
+  {0x10, 0x38, 0x54, 0x10, 0x10, 0x00}, // U+2190
+  {0x20, 0x40, 0xfe, 0x40, 0x20, 0x00}, // U+2191
+  {0x10, 0x10, 0x54, 0x38, 0x10, 0x00}, // U+2192
+  {0x08, 0x04, 0xfe, 0x04, 0x08, 0x00}, // U+2193
+  {0x22, 0x22, 0xfa, 0x22, 0x22, 0x00}, // U+00B1
+  {0x3f, 0x04, 0x02, 0x04, 0x3e, 0x00}, // U+00B5
+  {0x00, 0x00, 0x10, 0x00, 0x00, 0x00}, // U+00B7
+  {0x44, 0x28, 0x10, 0x28, 0x44, 0x00}, // U+00D7
+  {0x7e, 0xd2, 0x52, 0xd2, 0x42, 0x00}, // U+0401
+  {0x1c, 0xaa, 0x2a, 0xaa, 0x18, 0x00}  // U+0451
+};
+
+static const FontRange_TypeDef font_ext_5x7_ranges[3] = {
+  {0x0020,  95,   0},
+  {0x0410,  64,  96},
+  {0x2190,   4, 160}
+};
+
+static const uint16_t font_ext_5x7_hash_code[8] = {
+  0x0451, 0x0401, 0x00b0, 0x00b1, 0x00b5, 0x00b7, 0x00d7, 0x0000
+};
+
+static const uint16_t font_ext_5x7_hash_glyph[8] = {
+  169, 168, 95, 164, 165, 166, 167, 0
+};
+
+const FontMap_TypeDef font_ext_5x7_map = {
+  .Ranges    = font_ext_5x7_ranges,
+  .RangeNum  = 3,
+  .HashSize  = 8,
+  .Seed      = 0x4a2e,
+  .HashCode  = font_ext_5x7_hash_code,
+  .HashGlyph = font_ext_5x7_hash_glyph,
+  .Missing   = 0,
+};
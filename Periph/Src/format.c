@@ -0,0 +1,236 @@
+/**
+  ******************************************************************************
+  * @file           : format.c
+  * @brief          : This file contain a small printf-style formatter. It
+  *                   hands characters one by one to a put() callback, so the
+  *                   output needs no buffer and no heap.
+  *
+  *                   %[-+0][width][.precision]conv, width and precision may
+  *                   be '*', 'l' and 'h' are accepted and ignored.
+  *                   d i   signed int
+  *                   u     unsigned int
+  *                   x X   unsigned int in hex
+  *                   c     character
+  *                   s     string, precision limits its length
+  *                   q     fixed point, a signed int scaled by 10^precision,
+  *                         "%.2q" of 1234 is "12.34"
+  *                   %     percent sign
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2017-2026 Askug Ltd.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#include "format.h"
+
+
+#define FORMAT_LEFT       0x01U
+#define FORMAT_ZERO       0x02U
+#define FORMAT_PLUS       0x04U
+
+
+typedef struct {
+  void                  (*Put)(void*, char);
+  void*                 Ctx;
+  uint32_t              Count;
+} FormatOut_TypeDef;
+
+
+
+
+// --------------------------------------------------------------------------
+
+__STATIC_INLINE void format_put(FormatOut_TypeDef* out, char ch) {
+  out->Put(out->Ctx, ch);
+  out->Count++;
+}
+
+
+// --------------------------------------------------------------------------
+
+__STATIC_INLINE void format_pad(FormatOut_TypeDef* out, char ch, int32_t n) {
+  while (n-- > 0) format_put(out, ch);
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Writes a number. The digits are worked out backwards into a
+ *          few bytes of stack, point is the count of fractional digits.
+ */
+static void format_number(FormatOut_TypeDef* out, uint32_t v, bool neg, uint32_t base, bool upper, uint32_t point, uint32_t flags, int32_t width) {
+
+  char digits[12];
+  const char* hex = upper ? "0123456789ABCDEF" : "0123456789abcdef";
+  int32_t n = 0;
+
+  if (point > 9) point = 9;
+
+  do {
+    digits[n++] = hex[v % base];
+    v /= base;
+  } while ((v || (n <= (int32_t)point)) && (n < (int32_t)sizeof(digits)));
+
+  char sign = neg ? '-' : ((flags & FORMAT_PLUS) ? '+' : 0);
+  int32_t len = n + (sign ? 1 : 0) + (point ? 1 : 0);
+
+  if (!(flags & FORMAT_LEFT) && !(flags & FORMAT_ZERO)) format_pad(out, ' ', (width - len));
+  if (sign) format_put(out, sign);
+  if (!(flags & FORMAT_LEFT) && (flags & FORMAT_ZERO)) format_pad(out, '0', (width - len));
+
+  while (n--) {
+    format_put(out, digits[n]);
+    if (point && (n == (int32_t)point)) format_put(out, '.');
+  }
+
+  if (flags & FORMAT_LEFT) format_pad(out, ' ', (width - len));
+}
+
+
+// --------------------------------------------------------------------------
+
+uint32_t Format_Stream(void (*put)(void*, char), void* ctx, const char* fmt, va_list ap) {
+
+  FormatOut_TypeDef out = {put, ctx, 0};
+
+  while (*fmt) {
+    if (*fmt != '%') {
+      format_put(&out, *fmt++);
+      continue;
+    }
+    fmt++;
+
+    uint32_t flags = 0;
+    int32_t width = 0;
+    int32_t precision = -1;
+
+    for (;; fmt++) {
+      if (*fmt == '-') flags |= FORMAT_LEFT;
+      else if (*fmt == '0') flags |= FORMAT_ZERO;
+      else if (*fmt == '+') flags |= FORMAT_PLUS;
+      else break;
+    }
+
+    if (*fmt == '*') {
+      width = va_arg(ap, int);
+      if (width < 0) {
+        flags |= FORMAT_LEFT;
+        width = -width;
+      }
+      fmt++;
+    }
+    while ((*fmt >= '0') && (*fmt <= '9')) width = (width * 10) + (*fmt++ - '0');
+
+    if (*fmt == '.') {
+      fmt++;
+      precision = 0;
+      if (*fmt == '*') {
+        precision = va_arg(ap, int);
+        fmt++;
+      }
+      while ((*fmt >= '0') && (*fmt <= '9')) precision = (precision * 10) + (*fmt++ - '0');
+    }
+
+    while ((*fmt == 'l') || (*fmt == 'h')) fmt++;
+
+    switch (*fmt) {
+      case 'd':
+      case 'i':
+      case 'q': {
+        int32_t v = va_arg(ap, int);
+        uint32_t point = ((*fmt == 'q') && (precision > 0)) ? precision : 0;
+        format_number(&out, (v < 0) ? (0U - (uint32_t)v) : (uint32_t)v, (v < 0), 10, false, point, flags, width);
+        break;
+      }
+
+      case 'u':
+        format_number(&out, va_arg(ap, unsigned int), false, 10, false, 0, (flags & ~FORMAT_PLUS), width);
+        break;
+
+      case 'x':
+      case 'X':
+        format_number(&out, va_arg(ap, unsigned int), false, 16, (*fmt == 'X'), 0, (flags & ~FORMAT_PLUS), width);
+        break;
+
+      case 'c':
+        if (!(flags & FORMAT_LEFT)) format_pad(&out, ' ', (width - 1));
+        format_put(&out, (char)va_arg(ap, int));
+        if (flags & FORMAT_LEFT) format_pad(&out, ' ', (width - 1));
+        break;
+
+      case 's': {
+        const char* s = va_arg(ap, const char*);
+        if (!s) s = "(null)";
+
+        int32_t len = 0;
+        while (s[len] && ((precision < 0) || (len < precision))) len++;
+
+        if (!(flags & FORMAT_LEFT)) format_pad(&out, ' ', (width - len));
+        for (int32_t i = 0; i < len; i++) format_put(&out, s[i]);
+        if (flags & FORMAT_LEFT) format_pad(&out, ' ', (width - len));
+        break;
+      }
+
+      case '%':
+        format_put(&out, '%');
+        break;
+
+      case '\0':
+        return out.Count;
+
+      default:
+        // unknown conversion, show it as it is
+        format_put(&out, '%');
+        format_put(&out, *fmt);
+        break;
+    }
+    fmt++;
+  }
+
+  return out.Count;
+}
+
+
+// --------------------------------------------------------------------------
+
+typedef struct {
+  char*                 Buf;
+  uint32_t              Size;
+  uint32_t              Len;
+} FormatBuf_TypeDef;
+
+
+static void format_buf_put(void* ctx, char ch) {
+  FormatBuf_TypeDef* b = (FormatBuf_TypeDef*)ctx;
+
+  if ((b->Len + 1) < b->Size) b->Buf[b->Len++] = ch;
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   snprintf() on top of Format_Stream(), the output is always NUL
+ *          terminated when size is not 0.
+ * @retval  length of the full output, as if the buffer were large enough
+ */
+uint32_t Format_String(char* buf, uint32_t size, const char* fmt, ...) {
+
+  FormatBuf_TypeDef b = {buf, size, 0};
+  va_list ap;
+
+  va_start(ap, fmt);
+  uint32_t n = Format_Stream(format_buf_put, &b, fmt, ap);
+  va_end(ap);
+
+  if (size) buf[b.Len] = '\0';
+  return n;
+}
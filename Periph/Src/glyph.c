@@ -0,0 +1,427 @@
+/**
+  ******************************************************************************
+  * @file           : glyph.c
+  * @brief          : This file contain glyph lookup and expansion code shared
+  *                   by the display driver and the canvas.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2017-2026 Askug Ltd.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#include "glyph.h"
+#include <string.h>
+
+
+/* --- pixel pair masks of a font byte, bit 2k in the low half-word --- */
+#define GLYPH_M2(b, k)  (((((b) >> (2 * (k))) & 1) ? 0x0000ffffU : 0) | ((((b) >> (2 * (k) + 1)) & 1) ? 0xffff0000U : 0))
+#define GLYPH_M1(b)     {GLYPH_M2(b, 0), GLYPH_M2(b, 1), GLYPH_M2(b, 2), GLYPH_M2(b, 3)}
+#define GLYPH_M4(b)     GLYPH_M1(b), GLYPH_M1((b) + 1), GLYPH_M1((b) + 2), GLYPH_M1((b) + 3)
+#define GLYPH_M16(b)    GLYPH_M4(b), GLYPH_M4((b) + 4), GLYPH_M4((b) + 8), GLYPH_M4((b) + 12)
+#define GLYPH_M64(b)    GLYPH_M16(b), GLYPH_M16((b) + 16), GLYPH_M16((b) + 32), GLYPH_M16((b) + 48)
+
+static const uint32_t glyph_mask[256][4] = {
+  GLYPH_M64(0), GLYPH_M64(64), GLYPH_M64(128), GLYPH_M64(192)
+};
+
+
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Returns the 1-bpp bitmap of a character. Glyphs are stored column
+ *          by column, Height bits per column, LSB first.
+ */
+const uint8_t* Glyph_Bits(const Font_TypeDef* f, uint16_t code) {
+  return f->Font + (Glyph_Index(f->Map, code) * f->BytesPerGlif);
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Returns the glyph number of a code point. Without a character map
+ *          the font has the 96 glyphs of ASCII 32..126 and the degree sign.
+ *          A map looks at a few dense ranges first and then at one slot of
+ *          its perfect hash, so a lookup never walks the glyphs.
+ */
+uint16_t Glyph_Index(const FontMap_TypeDef* map, uint16_t code) {
+
+  if (!map) {
+    // shift the glyph index
+    if ((code < 32) || (code > 126)) {
+      if (code == 176) code = 127;
+      else code = 32;
+    }
+    return code - 32;
+  }
+
+  for (uint32_t i = 0; i < map->RangeNum; i++) {
+    const FontRange_TypeDef* r = &map->Ranges[i];
+    uint16_t k = code - r->First;
+
+    if (k < r->Count) return r->Glyph + k;
+  }
+
+  if (map->HashSize) {
+    uint32_t slot = (((uint32_t)code * map->Seed) >> 16) & (map->HashSize - 1);
+    if (map->HashCode[slot] == code) return map->HashGlyph[slot];
+  }
+
+  return map->Missing;
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Takes one character off UTF-8 text of len bytes. A byte that does
+ *          not start a valid sequence is taken as Latin-1, so "\xb0" still
+ *          is the degree sign. Code points above U+FFFF are not supported.
+ * @retval  bytes taken, 0 when len ends inside a sequence
+ */
+uint32_t Glyph_Decode(const char* s, uint32_t len, uint16_t* code) {
+
+  uint8_t b = (uint8_t)s[0];
+  uint32_t n = ((b >= 0xc2) && (b <= 0xdf)) ? 2 : (((b & 0xf0) == 0xe0) ? 3 : 1);
+  uint32_t v = b & ((n == 2) ? 0x1f : 0x0f);
+
+  *code = b;
+  if (n == 1) return 1;
+
+  for (uint32_t k = 1; k < n; k++) {
+    if (k >= len) return 0;
+    if (((uint8_t)s[k] & 0xc0) != 0x80) return 1;
+    v = (v << 6) | ((uint8_t)s[k] & 0x3f);
+  }
+
+  // overlong three-byte forms and surrogates stay Latin-1 bytes
+  if ((n == 3) && ((v < 0x800) || ((v >= 0xd800) && (v < 0xe000)))) return 1;
+
+  *code = v;
+  return n;
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Returns the pre-expanded pixels of a character from the font
+ *          atlas, when there is one made for the same colors.
+ * @retval  NULL when the glyph has to be expanded
+ */
+const uint16_t* Glyph_Atlas(const Font_TypeDef* f, uint16_t code) {
+  const FontAtlas_TypeDef* a = f->Atlas;
+
+  if (!a || (f->Scale > 1) || (a->Font != f->Font) || (a->Color != f->Color) || (a->Bgcolor != f->Bgcolor)) return NULL;
+
+  uint16_t g = Glyph_Index(f->Map, code);
+  if (g >= 96) return NULL;
+
+  uint8_t i = a->Index[g];
+  if (i == 0xff) return NULL;
+
+  return &a->Pixels[(uint32_t)i * f->Width * f->Height];
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Expands one font byte into 8 pixels with four word stores. The
+ *          mask table does not depend on the colors, a pair of pixels is
+ *          bg2 ^ (mask & diff2) with both colors doubled into a word.
+ */
+__STATIC_INLINE void glyph_byte(uint32_t* dst, uint8_t bits, uint32_t bg2, uint32_t diff2) {
+  const uint32_t* m = glyph_mask[bits];
+
+  dst[0] = bg2 ^ (m[0] & diff2);
+  dst[1] = bg2 ^ (m[1] & diff2);
+  dst[2] = bg2 ^ (m[2] & diff2);
+  dst[3] = bg2 ^ (m[3] & diff2);
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Expands columns c0..c1-1 and rows r0..r1-1 of a 1-bpp bitmap of
+ *          h rows per column into RGB565. dst is the pixel of (c0, r0),
+ *          stride is the distance between two columns in dst. Whole font
+ *          bytes on a word boundary go through the mask table, the rows
+ *          around them bit by bit.
+ */
+__STATIC_INLINE void glyph_expand(const uint8_t* glyph, uint32_t h, uint16_t fg, uint16_t bg, uint16_t* dst, uint32_t stride, uint16_t c0, uint16_t c1, uint16_t r0, uint16_t r1) {
+
+  uint32_t bg2 = bg * 0x00010001U;
+  uint32_t diff2 = (fg ^ bg) * 0x00010001U;
+
+  for (uint32_t col = c0; col < c1; col++) {
+    uint16_t* px = dst;
+    uint32_t bit = (col * h) + r0;
+    uint32_t row = r0;
+
+    while (row < r1) {
+      if (!(bit & 7) && ((row + 8) <= r1) && !((uintptr_t)px & 3)) {
+        glyph_byte((uint32_t*)px, glyph[bit >> 3], bg2, diff2);
+        px += 8;
+        bit += 8;
+        row += 8;
+        continue;
+      }
+      *px++ = (glyph[bit >> 3] & (1 << (bit & 7))) ? fg : bg;
+      bit++;
+      row++;
+    }
+    dst += stride;
+  }
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Fills n pixels with one color, two pixels per store when dst is
+ *          word aligned.
+ */
+__STATIC_INLINE void glyph_run(uint16_t* dst, uint16_t c, uint32_t n) {
+  if (n && ((uintptr_t)dst & 2)) {
+    *dst++ = c;
+    n--;
+  }
+
+  uint32_t c2 = c * 0x00010001U;
+  uint32_t* px = (uint32_t*)dst;
+
+  for (; n >= 2; n -= 2) *px++ = c2;
+  if (n) *(uint16_t*)px = c;
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Decodes a run-length encoded glyph. A run byte is the color in
+ *          bit 7 and the length in bits 0..6, runs follow the panel stream
+ *          order and go on from one column into the next. A whole glyph is
+ *          filled run by run, a cut one only where the runs cross the
+ *          rows r0..r1-1 of the columns c0..c1-1.
+ */
+__STATIC_INLINE void glyph_expand_rle(const Font_TypeDef* f, uint16_t code, uint16_t* dst, uint32_t stride, uint16_t c0, uint16_t c1, uint16_t r0, uint16_t r1) {
+
+  uint16_t i = Glyph_Index(f->Map, code);
+  const uint8_t* run = &f->Font[f->Rle[i]];
+  const uint8_t* end = &f->Font[f->Rle[i + 1]];
+  uint32_t h = f->Height;
+
+  if ((c0 == 0) && (c1 == f->Width) && (r0 == 0) && (r1 == h) && (stride == h)) {
+    for (; run < end; run++) {
+      uint32_t n = *run & 0x7f;
+
+      glyph_run(dst, ((*run & 0x80) ? f->Color : f->Bgcolor), n);
+      dst += n;
+    }
+    return;
+  }
+
+  uint32_t col = 0, row = 0;
+
+  for (; (run < end) && (col < c1); run++) {
+    uint16_t c = (*run & 0x80) ? f->Color : f->Bgcolor;
+    uint32_t n = *run & 0x7f;
+
+    while (n) {
+      uint32_t k = ((h - row) < n) ? (h - row) : n;
+
+      if ((col >= c0) && (col < c1)) {
+        uint32_t a = (row > r0) ? row : r0;
+        uint32_t b = ((row + k) < r1) ? (row + k) : r1;
+
+        if (b > a) glyph_run(&dst[((col - c0) * stride) + (a - r0)], c, (b - a));
+      }
+
+      n -= k;
+      row += k;
+      if (row == h) {
+        row = 0;
+        col++;
+      }
+    }
+  }
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Returns the colors of the coverage levels of an anti-aliased font.
+ *          The table is worked out once per color pair and depth and kept
+ *          until another pair comes along.
+ */
+static const uint16_t* glyph_blend(const Font_TypeDef* f) {
+  static uint16_t lut[16];
+  static uint32_t key = 0;
+  static uint8_t depth = 0;
+
+  uint32_t k = ((uint32_t)f->Color << 16) | f->Bgcolor;
+
+  if ((k == key) && (f->Bpp == depth)) return lut;
+
+  uint32_t top = (1U << f->Bpp) - 1;
+
+  for (uint32_t a = 0; a <= top; a++) {
+    uint32_t r = ((((f->Color >> 11) & 0x1f) * a) + (((f->Bgcolor >> 11) & 0x1f) * (top - a)) + (top / 2)) / top;
+    uint32_t g = ((((f->Color >> 5) & 0x3f) * a) + (((f->Bgcolor >> 5) & 0x3f) * (top - a)) + (top / 2)) / top;
+    uint32_t b = (((f->Color & 0x1f) * a) + ((f->Bgcolor & 0x1f) * (top - a)) + (top / 2)) / top;
+
+    lut[a] = (r << 11) | (g << 5) | b;
+  }
+
+  key = k;
+  depth = f->Bpp;
+  return lut;
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Expands an anti-aliased glyph, Bpp bits per pixel packed like a
+ *          dot font glyph. Every pixel is one table lookup.
+ */
+__STATIC_INLINE void glyph_expand_aa(const Font_TypeDef* f, uint16_t code, uint16_t* dst, uint32_t stride, uint16_t c0, uint16_t c1, uint16_t r0, uint16_t r1) {
+
+  const uint8_t* glyph = Glyph_Bits(f, code);
+  const uint16_t* lut = glyph_blend(f);
+  uint32_t bpp = f->Bpp;
+  uint32_t mask = (1U << bpp) - 1;
+
+  for (uint32_t col = c0; col < c1; col++) {
+    uint16_t* px = dst;
+    uint32_t bit = ((col * f->Height) + r0) * bpp;
+
+    for (uint32_t row = r0; row < r1; row++, bit += bpp) {
+      *px++ = lut[(glyph[bit >> 3] >> (bit & 7)) & mask];
+    }
+    dst += stride;
+  }
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Expands a dot font glyph blown up Scale times. Every dot of a
+ *          column is a run of Scale pixels, the following Scale - 1 columns
+ *          are copies of the first one.
+ */
+__STATIC_INLINE void glyph_expand_scaled(const Font_TypeDef* f, uint16_t code, uint16_t* dst, uint32_t stride, uint16_t c0, uint16_t c1, uint16_t r0, uint16_t r1) {
+
+  const uint8_t* glyph = Glyph_Bits(f, code);
+  uint32_t s = f->Scale;
+  uint32_t h = f->Height / s;
+  uint32_t rows = r1 - r0;
+
+  for (uint32_t col = c0; col < c1; col++, dst += stride) {
+    if ((col > c0) && (col % s)) {
+      memcpy(dst, (dst - stride), (rows * 2));
+      continue;
+    }
+
+    uint16_t* px = dst;
+    uint32_t bit = ((col / s) * h) + (r0 / s);
+
+    for (uint32_t row = r0; row < r1; bit++) {
+      uint32_t n = s - (row % s);
+      if (n > (r1 - row)) n = r1 - row;
+
+      glyph_run(px, ((glyph[bit >> 3] & (1 << (bit & 7))) ? f->Color : f->Bgcolor), n);
+      px += n;
+      row += n;
+    }
+  }
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Expands columns c0..c1-1 and rows r0..r1-1 of a glyph into RGB565.
+ */
+void Glyph_Expand(const Font_TypeDef* f, uint16_t code, uint16_t* dst, uint32_t stride, uint16_t c0, uint16_t c1, uint16_t r0, uint16_t r1) {
+  if (f->Rle) {
+    glyph_expand_rle(f, code, dst, stride, c0, c1, r0, r1);
+    return;
+  }
+  if (f->Bpp > 1) {
+    glyph_expand_aa(f, code, dst, stride, c0, c1, r0, r1);
+    return;
+  }
+  if (f->Scale > 1) {
+    glyph_expand_scaled(f, code, dst, stride, c0, c1, r0, r1);
+    return;
+  }
+  glyph_expand(Glyph_Bits(f, code), f->Height, f->Color, f->Bgcolor, dst, stride, c0, c1, r0, r1);
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Expands a whole glyph, Width columns of Height pixels.
+ */
+void Glyph_Render(const Font_TypeDef* f, uint16_t code, uint16_t* dst) {
+  Glyph_Expand(f, code, dst, f->Height, 0, f->Width, 0, f->Height);
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Returns the bounding box and advance of a proportional glyph.
+ */
+const FontGlyph_TypeDef* Glyph_Prop(const PropFont_TypeDef* f, uint16_t code) {
+  return &f->Glyphs[Glyph_Index(NULL, code)];
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Expands columns c0..c1-1 and rows r0..r1-1 of the inked box of a
+ *          proportional glyph, the box is packed like a dot font glyph.
+ */
+void Glyph_ExpandProp(const PropFont_TypeDef* f, uint16_t code, uint16_t* dst, uint32_t stride, uint16_t c0, uint16_t c1, uint16_t r0, uint16_t r1) {
+  const FontGlyph_TypeDef* g = Glyph_Prop(f, code);
+
+  glyph_expand(&f->Bitmap[g->Offset], g->Height, f->Color, f->Bgcolor, dst, stride, c0, c1, r0, r1);
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Returns the width in pixels of the first n bytes of a UTF-8 line,
+ *          up to NUL or '\n', when printed in a proportional font.
+ */
+uint32_t Glyph_PropWidth(const PropFont_TypeDef* f, const char* str, uint32_t n) {
+  uint32_t w = 0;
+  uint16_t code;
+
+  for (uint32_t i = 0; (i < n) && str[i] && (str[i] != '\n');) {
+    uint32_t k = Glyph_Decode(&str[i], (n - i), &code);
+    if (!k) break;
+
+    w += Glyph_Prop(f, code)->Advance;
+    i += k;
+  }
+  return w;
+}
@@ -0,0 +1,197 @@
+/**
+  ******************************************************************************
+  * @file           : glyph_cache.c
+  * @brief          : This file contain the LRU cache of expanded RGB565
+  *                   glyphs, keyed by font, character and color pair.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2017-2026 Askug Ltd.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#include "glyph_cache.h"
+#include <string.h>
+
+
+#if GLYPH_CACHE_SZ
+
+#define GLYPH_CACHE_NUM     (GLYPH_CACHE_SZ / GLYPH_CACHE_BLOCK)
+#define GLYPH_CACHE_NONE    0xff
+
+#if (GLYPH_CACHE_NUM > 0xfe)
+  #error "GLYPH_CACHE_SZ / GLYPH_CACHE_BLOCK must fit a block index"
+#endif
+
+
+/* --- private variables --- */
+__attribute__((aligned(4))) static uint16_t glyph_cache_arena[GLYPH_CACHE_SZ];
+static GlyphCacheEntry_TypeDef glyph_cache[GLYPH_CACHE_NUM];
+static uint8_t glyph_cache_head[GLYPH_CACHE_BUCKETS];
+static uint32_t glyph_cache_clock = 0;
+static bool glyph_cache_ready = false;
+
+
+
+
+// --------------------------------------------------------------------------
+
+__STATIC_INLINE uint32_t glyph_cache_hash(const uint8_t* font, uint16_t code, uint16_t c, uint16_t bg) {
+  uint32_t h = (uint32_t)(uintptr_t)font;
+
+  h ^= code * 0x9e3779b1U;
+  h ^= ((uint32_t)c << 16) | bg;
+  h ^= h >> 15;
+  h *= 0x2c1b3c6dU;
+  h ^= h >> 13;
+
+  return h & (GLYPH_CACHE_BUCKETS - 1);
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Drops a glyph and frees all of its blocks.
+ */
+static void glyph_cache_evict(uint8_t i) {
+  GlyphCacheEntry_TypeDef* e = &glyph_cache[i];
+  uint8_t* link = &glyph_cache_head[glyph_cache_hash(e->Font, e->Code, e->Color, e->Bgcolor)];
+
+  while ((*link != GLYPH_CACHE_NONE) && (*link != i)) link = &glyph_cache[*link].Next;
+  if (*link == i) *link = e->Next;
+
+  uint32_t end = i + e->Blocks;
+  for (uint32_t b = i; b < end; b++) {
+    glyph_cache[b].Owner = GLYPH_CACHE_NONE;
+    glyph_cache[b].Blocks = 0;
+  }
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Picks n blocks in a row whose newest glyph is the oldest one, free
+ *          blocks count as never used.
+ */
+static uint8_t glyph_cache_victim(uint32_t n) {
+  uint32_t best = 0, best_stamp = 0xffffffff;
+
+  for (uint32_t i = 0; (i + n) <= GLYPH_CACHE_NUM; i++) {
+    uint32_t stamp = 0;
+
+    for (uint32_t b = i; b < (i + n); b++) {
+      uint8_t o = glyph_cache[b].Owner;
+      if ((o != GLYPH_CACHE_NONE) && (glyph_cache[o].Stamp > stamp)) stamp = glyph_cache[o].Stamp;
+    }
+
+    if (stamp < best_stamp) {
+      best = i;
+      best_stamp = stamp;
+      if (!stamp) break;
+    }
+  }
+
+  return best;
+}
+
+
+// --------------------------------------------------------------------------
+
+void GlyphCache_Reset(void) {
+  memset(glyph_cache, 0, sizeof(glyph_cache));
+  for (uint32_t i = 0; i < GLYPH_CACHE_NUM; i++) glyph_cache[i].Owner = GLYPH_CACHE_NONE;
+  memset(glyph_cache_head, GLYPH_CACHE_NONE, sizeof(glyph_cache_head));
+  glyph_cache_clock = 0;
+  glyph_cache_ready = true;
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Returns the expanded glyph, Width columns of Height pixels, from
+ *          the cache, rendering it on a miss. The pixels stay valid until
+ *          the next call.
+ * @retval  NULL when the glyph does not fit the cache
+ */
+const uint16_t* GlyphCache_Get(const Font_TypeDef* f, uint16_t code) {
+
+  if (!glyph_cache_ready) GlyphCache_Reset();
+
+  uint32_t h = glyph_cache_hash(f->Font, code, f->Color, f->Bgcolor);
+
+  for (uint8_t i = glyph_cache_head[h]; i != GLYPH_CACHE_NONE; i = glyph_cache[i].Next) {
+    GlyphCacheEntry_TypeDef* e = &glyph_cache[i];
+
+    if ((e->Font == f->Font) && (e->Code == code) && (e->Height == f->Height) && (e->Color == f->Color) && (e->Bgcolor == f->Bgcolor)) {
+      e->Stamp = ++glyph_cache_clock;
+      return &glyph_cache_arena[i * GLYPH_CACHE_BLOCK];
+    }
+  }
+
+  uint32_t n = (((uint32_t)f->Width * f->Height) + GLYPH_CACHE_BLOCK - 1) / GLYPH_CACHE_BLOCK;
+  if (!n || (n > GLYPH_CACHE_NUM)) return NULL;
+
+  uint8_t i = glyph_cache_victim(n);
+
+  for (uint32_t b = i; b < (i + n); b++) {
+    if (glyph_cache[b].Owner != GLYPH_CACHE_NONE) glyph_cache_evict(glyph_cache[b].Owner);
+  }
+
+  GlyphCacheEntry_TypeDef* e = &glyph_cache[i];
+  e->Font    = f->Font;
+  e->Code    = code;
+  e->Height  = f->Height;
+  e->Color   = f->Color;
+  e->Bgcolor = f->Bgcolor;
+  e->Blocks  = n;
+  e->Stamp   = ++glyph_cache_clock;
+  e->Next    = glyph_cache_head[h];
+  glyph_cache_head[h] = i;
+  for (uint32_t b = i; b < (i + n); b++) glyph_cache[b].Owner = i;
+
+  Glyph_Render(f, code, &glyph_cache_arena[i * GLYPH_CACHE_BLOCK]);
+  return &glyph_cache_arena[i * GLYPH_CACHE_BLOCK];
+}
+
+#endif
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Glyph_Expand() served from the font atlas or the cache, a whole
+ *          glyph is a single copy and a cut one a copy per column.
+ */
+void GlyphCache_Expand(const Font_TypeDef* f, uint16_t code, uint16_t* dst, uint32_t stride, uint16_t c0, uint16_t c1, uint16_t r0, uint16_t r1) {
+
+  const uint16_t* src = Glyph_Atlas(f, code);
+
+  #if GLYPH_CACHE_SZ
+    if (!src) src = GlyphCache_Get(f, code);
+  #endif
+
+  if (!src) {
+    Glyph_Expand(f, code, dst, stride, c0, c1, r0, r1);
+    return;
+  }
+
+  uint32_t rows = r1 - r0;
+
+  if ((rows == f->Height) && (stride == rows)) {
+    memcpy(dst, &src[c0 * f->Height], ((uint32_t)(c1 - c0) * rows * 2));
+    return;
+  }
+
+  for (uint32_t col = c0; col < c1; col++, dst += stride) {
+    memcpy(dst, &src[(col * f->Height) + r0], (rows * 2));
+  }
+}
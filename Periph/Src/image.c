@@ -0,0 +1,130 @@
+/**
+  ******************************************************************************
+  * @file           : image.c
+  * @brief          : This file contain the compressed image decoder. The
+  *                   format follows QOI, cut down to native RGB565 pixels in
+  *                   the panel stream order. Every pixel is one of
+  *
+  *                   00iiiiii              the color in slot i of the index
+  *                   01rrggbb              the last pixel + r, g, b - 2
+  *                   10gggggg rrrrbbbb     the last pixel + g - 32 in green,
+  *                                         r - 8 + g - 32 in red and
+  *                                         b - 8 + g - 32 in blue
+  *                   11nnnnnn              the last pixel again n + 1 times,
+  *                                         n up to 61
+  *                   11111110 hhhhhhhh llllllll
+  *                                         a pixel as it is, MSB first
+  *
+  *                   Differences wrap within their 5 or 6 bits. Every pixel
+  *                   but a run also goes to index slot
+  *                   (3 * red + 5 * green + 7 * blue) % 64. Decoding starts
+  *                   from black with an all black index. See Tools/image.py.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2017-2026 Askug Ltd.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#include "image.h"
+
+
+
+
+// --------------------------------------------------------------------------
+
+__STATIC_INLINE uint8_t image_hash(uint16_t p) {
+  return (((p >> 11) * 3) + (((p >> 5) & 0x3f) * 5) + ((p & 0x1f) * 7)) & 0x3f;
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Adds the differences to the channels of p, each wraps in its own
+ *          bits.
+ */
+__STATIC_INLINE uint16_t image_add(uint16_t p, int32_t dr, int32_t dg, int32_t db) {
+  uint32_t r = ((p >> 11) + dr) & 0x1f;
+  uint32_t g = (((p >> 5) & 0x3f) + dg) & 0x3f;
+  uint32_t b = ((p & 0x1f) + db) & 0x1f;
+
+  return (uint16_t)((r << 11) | (g << 5) | b);
+}
+
+
+// --------------------------------------------------------------------------
+
+void Image_Begin(ImageDecoder_TypeDef* dec, const Image_TypeDef* img) {
+  dec->Src  = img->Data;
+  dec->End  = img->Data + img->Size;
+  dec->Prev = 0x0000;
+  dec->Run  = 0;
+  for (uint32_t i = 0; i < 64; i++) dec->Index[i] = 0x0000;
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Decodes the next n pixels into out, or skips them when out is
+ *          NULL. A run may end in the next call.
+ * @retval  the number of pixels, less than n only at the end of the data or
+ *          at a broken op
+ */
+uint32_t Image_Decode(ImageDecoder_TypeDef* dec, uint16_t* out, uint32_t n) {
+
+  uint32_t done = 0;
+  uint16_t p = dec->Prev;
+
+  while (done < n) {
+    if (dec->Run) {
+      uint32_t k = ((n - done) < dec->Run) ? (n - done) : dec->Run;
+
+      if (out) {
+        for (uint32_t i = 0; i < k; i++) out[done + i] = p;
+      }
+      dec->Run -= k;
+      done += k;
+      continue;
+    }
+
+    if (dec->Src >= dec->End) break;
+
+    uint8_t op = *dec->Src++;
+
+    if (op < 0x40) {
+      p = dec->Index[op];
+    } else if (op < 0x80) {
+      p = image_add(p, (((op >> 4) & 3) - 2), (((op >> 2) & 3) - 2), ((op & 3) - 2));
+    } else if (op < 0xc0) {
+      if (dec->Src >= dec->End) break;
+
+      int32_t dg = (op & 0x3f) - 32;
+      uint8_t rb = *dec->Src++;
+
+      p = image_add(p, ((rb >> 4) - 8 + dg), dg, ((rb & 0x0f) - 8 + dg));
+    } else if (op < 0xfe) {
+      dec->Run = (op & 0x3f) + 1;
+      continue;
+    } else if ((op == 0xfe) && ((dec->End - dec->Src) >= 2)) {
+      p = ((uint16_t)dec->Src[0] << 8) | dec->Src[1];
+      dec->Src += 2;
+    } else {
+      break;
+    }
+
+    dec->Index[image_hash(p)] = p;
+    if (out) out[done] = p;
+    done++;
+  }
+
+  dec->Prev = p;
+  return done;
+}
@@ -0,0 +1,705 @@
+/**
+  ******************************************************************************
+  * @file           : jpeg.c
+  * @brief          : This file contain a baseline JPEG decoder working in a
+  *                   fixed few KB. The picture comes in through a read
+  *                   callback and goes out one MCU at a time, as native
+  *                   RGB565 in the panel stream order.
+  *
+  *                   Huffman coded sequential DCT with 8-bit samples (SOF0,
+  *                   SOF1), one scan with all components, grayscale or
+  *                   YCbCr with sampling factors 1 or 2 (4:4:4, 4:2:2,
+  *                   4:2:0, 4:4:0) and restart intervals. Progressive and
+  *                   arithmetic coded pictures are refused. Chroma is
+  *                   upsampled by repeating samples.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2017-2026 Askug Ltd.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#include "jpeg.h"
+#include <string.h>
+
+
+
+/* natural order of the zigzag coefficients */
+static const uint8_t jpeg_zigzag[64] = {
+   0,  1,  8, 16,  9,  2,  3, 10, 17, 24, 32, 25, 18, 11,  4,  5,
+  12, 19, 26, 33, 40, 48, 41, 34, 27, 20, 13,  6,  7, 14, 21, 28,
+  35, 42, 49, 56, 57, 50, 43, 36, 29, 22, 15, 23, 30, 37, 44, 51,
+  58, 59, 52, 45, 38, 31, 39, 46, 53, 60, 61, 54, 47, 55, 62, 63,
+};
+
+/* IDCT constants in Q13, the islow kernel of the IJG library */
+#define FIX_0_298631336   2446
+#define FIX_0_390180644   3196
+#define FIX_0_541196100   4433
+#define FIX_0_765366865   6270
+#define FIX_0_899976223   7373
+#define FIX_1_175875602   9633
+#define FIX_1_501321110   12299
+#define FIX_1_847759065   15137
+#define FIX_1_961570560   16069
+#define FIX_2_053119869   16819
+#define FIX_2_562915447   20995
+#define FIX_3_072711026   25172
+
+#define IDCT_CONST_BITS   13
+#define IDCT_PASS1_BITS   2
+
+/* YCbCr to RGB constants in Q16 */
+#define YCC_CR_R          91881
+#define YCC_CB_G          22554
+#define YCC_CR_G          46802
+#define YCC_CB_B          116130
+
+
+
+
+// --------------------------------------------------------------------------
+
+__STATIC_INLINE uint8_t jpeg_clamp(int32_t v) {
+  return (v < 0) ? 0 : ((v > 255) ? 255 : (uint8_t)v);
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Takes the next source byte, refilling the input buffer.
+ * @retval  false at the end of the source
+ */
+static bool jpeg_byte(Jpeg_TypeDef* jpg, uint8_t* b) {
+
+  if (jpg->InPos >= jpg->InLen) {
+    uint32_t n = jpg->Read(jpg->Ctx, jpg->In, sizeof(jpg->In));
+
+    jpg->InLen = (n > sizeof(jpg->In)) ? sizeof(jpg->In) : n;
+    jpg->InPos = 0;
+    if (!jpg->InLen) return false;
+  }
+
+  *b = jpg->In[jpg->InPos++];
+  return true;
+}
+
+
+// --------------------------------------------------------------------------
+
+static bool jpeg_word(Jpeg_TypeDef* jpg, uint16_t* w) {
+  uint8_t hi, lo;
+
+  if (!jpeg_byte(jpg, &hi) || !jpeg_byte(jpg, &lo)) return false;
+  *w = ((uint16_t)hi << 8) | lo;
+  return true;
+}
+
+
+// --------------------------------------------------------------------------
+
+static bool jpeg_skip(Jpeg_TypeDef* jpg, uint32_t n) {
+  uint8_t b;
+
+  while (n--) {
+    if (!jpeg_byte(jpg, &b)) return false;
+  }
+  return true;
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Reads quantization tables, kept in the zigzag order.
+ */
+static bool jpeg_dqt(Jpeg_TypeDef* jpg, int32_t len) {
+
+  while (len > 0) {
+    uint8_t pt;
+    if (!jpeg_byte(jpg, &pt) || ((pt & 0x0f) > 3)) return false;
+
+    uint16_t* q = jpg->Qt[pt & 0x0f];
+
+    for (uint32_t k = 0; k < 64; k++) {
+      uint8_t b;
+
+      if (pt >> 4) {
+        if (!jpeg_word(jpg, &q[k])) return false;
+      } else {
+        if (!jpeg_byte(jpg, &b)) return false;
+        q[k] = b;
+      }
+    }
+    len -= 1 + ((pt >> 4) ? 128 : 64);
+  }
+
+  return (len == 0);
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Reads Huffman tables and lays out their canonical codes.
+ */
+static bool jpeg_dht(Jpeg_TypeDef* jpg, int32_t len) {
+
+  while (len > 0) {
+    uint8_t tc, counts[16];
+    uint32_t total = 0;
+
+    if (!jpeg_byte(jpg, &tc) || ((tc >> 4) > 1) || ((tc & 0x0f) > 1)) return false;
+
+    for (uint32_t l = 0; l < 16; l++) {
+      if (!jpeg_byte(jpg, &counts[l])) return false;
+      total += counts[l];
+    }
+
+    JpegHuff_TypeDef* t = (tc >> 4) ? &jpg->Ac[tc & 0x0f] : &jpg->Dc[tc & 0x0f];
+
+    if (total > sizeof(t->Vals)) return false;
+
+    for (uint32_t i = 0; i < total; i++) {
+      if (!jpeg_byte(jpg, &t->Vals[i])) return false;
+    }
+
+    uint32_t code = 0, k = 0;
+
+    for (uint32_t l = 1; l <= 16; l++) {
+      t->ValOff[l]  = k;
+      t->MinCode[l] = code;
+      code += counts[l - 1];
+      k += counts[l - 1];
+      t->MaxCode[l] = counts[l - 1] ? (int32_t)(code - 1) : -1;
+      code <<= 1;
+    }
+    len -= 17 + total;
+  }
+
+  return (len == 0);
+}
+
+
+// --------------------------------------------------------------------------
+
+static bool jpeg_sof(Jpeg_TypeDef* jpg, int32_t len) {
+  uint8_t p, n;
+
+  if (!jpeg_byte(jpg, &p) || (p != 8)) return false;
+  if (!jpeg_word(jpg, &jpg->H) || !jpeg_word(jpg, &jpg->W)) return false;
+  if (!jpg->W || !jpg->H) return false;
+  if (!jpeg_byte(jpg, &n) || ((n != 1) && (n != 3)) || (len != (6 + (3 * n)))) return false;
+
+  jpg->CompNum = n;
+
+  for (uint32_t i = 0; i < n; i++) {
+    JpegComp_TypeDef* c = &jpg->Comp[i];
+    uint8_t hv;
+
+    if (!jpeg_byte(jpg, &c->Id) || !jpeg_byte(jpg, &hv) || !jpeg_byte(jpg, &c->Tq)) return false;
+    c->H = hv >> 4;
+    c->V = hv & 0x0f;
+    if ((c->H < 1) || (c->H > 2) || (c->V < 1) || (c->V > 2) || (c->Tq > 3)) return false;
+  }
+
+  return true;
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Reads the scan header and lays out the MCU. A single component
+ *          scan is coded block by block whatever its sampling factors.
+ */
+static bool jpeg_sos(Jpeg_TypeDef* jpg, int32_t len) {
+  uint8_t n, b;
+
+  if (!jpg->CompNum || !jpeg_byte(jpg, &n) || (n != jpg->CompNum) || (len != (4 + (2 * n)))) return false;
+
+  for (uint32_t i = 0; i < n; i++) {
+    uint8_t id, t;
+
+    if (!jpeg_byte(jpg, &id) || !jpeg_byte(jpg, &t)) return false;
+
+    JpegComp_TypeDef* c = NULL;
+    for (uint32_t k = 0; k < jpg->CompNum; k++) {
+      if (jpg->Comp[k].Id == id) c = &jpg->Comp[k];
+    }
+    if (!c || ((t >> 4) > 1) || ((t & 0x0f) > 1)) return false;
+
+    c->Td = t >> 4;
+    c->Ta = t & 0x0f;
+  }
+
+  // Ss, Se and Ah/Al of a sequential scan
+  if (!jpeg_byte(jpg, &b) || (b != 0)) return false;
+  if (!jpeg_byte(jpg, &b) || (b != 63)) return false;
+  if (!jpeg_byte(jpg, &b) || (b != 0)) return false;
+
+  if (jpg->CompNum == 1) jpg->Comp[0].H = jpg->Comp[0].V = 1;
+
+  uint32_t hmax = 1, vmax = 1, blk = 0;
+
+  for (uint32_t i = 0; i < jpg->CompNum; i++) {
+    JpegComp_TypeDef* c = &jpg->Comp[i];
+
+    if (c->H > hmax) hmax = c->H;
+    if (c->V > vmax) vmax = c->V;
+    c->Blk  = blk;
+    c->Pred = 0;
+    blk += c->H * c->V;
+  }
+  if (blk > 6) return false;
+
+  jpg->McuW  = 8 * hmax;
+  jpg->McuH  = 8 * vmax;
+  jpg->McusX = (jpg->W + jpg->McuW - 1) / jpg->McuW;
+  jpg->McusY = (jpg->H + jpg->McuH - 1) / jpg->McuH;
+
+  return true;
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Tops the bit buffer up to more than 24 bits. Stuffed 0xff 0x00
+ *          pairs give 0xff, a marker stops the data and zeros are fed from
+ *          then on. A source that ends before EOI leaves Marker at 0xff,
+ *          which no marker can be.
+ */
+static void jpeg_fill(Jpeg_TypeDef* jpg) {
+
+  while (jpg->BitCnt <= 24) {
+    uint8_t b = 0;
+
+    if (!jpg->Marker) {
+      if (!jpeg_byte(jpg, &b)) {
+        jpg->Marker = 0xff;
+        b = 0;
+      } else if (b == 0xff) {
+        uint8_t m = 0xff;
+
+        while ((m == 0xff) && jpeg_byte(jpg, &m));
+
+        if (m) {
+          // a marker, or 0xff when the source ended
+          jpg->Marker = m;
+          b = 0;
+        }
+      }
+    }
+
+    jpg->Bits |= (uint32_t)b << (24 - jpg->BitCnt);
+    jpg->BitCnt += 8;
+  }
+}
+
+
+// --------------------------------------------------------------------------
+
+__STATIC_INLINE uint32_t jpeg_bits(Jpeg_TypeDef* jpg, uint32_t n) {
+  jpeg_fill(jpg);
+
+  uint32_t v = jpg->Bits >> (32 - n);
+  jpg->Bits <<= n;
+  jpg->BitCnt -= n;
+  return v;
+}
+
+
+// --------------------------------------------------------------------------
+
+__STATIC_INLINE int32_t jpeg_extend(uint32_t v, uint32_t s) {
+  return (v < (1UL << (s - 1))) ? ((int32_t)v - (int32_t)((1UL << s) - 1)) : (int32_t)v;
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Decodes one Huffman symbol. The next 16 bits are looked at once
+ *          and matched against the code ranges from the shortest length.
+ * @retval  the symbol, -1 for a code the table does not have
+ */
+static int32_t jpeg_huff(Jpeg_TypeDef* jpg, const JpegHuff_TypeDef* t) {
+  jpeg_fill(jpg);
+
+  uint32_t peek = jpg->Bits >> 16;
+
+  for (uint32_t l = 1; l <= 16; l++) {
+    int32_t code = peek >> (16 - l);
+
+    if (code <= t->MaxCode[l]) {
+      uint32_t i = t->ValOff[l] + code - t->MinCode[l];
+
+      jpg->Bits <<= l;
+      jpg->BitCnt -= l;
+      return (i < sizeof(t->Vals)) ? t->Vals[i] : -1;
+    }
+  }
+
+  return -1;
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Inverse DCT of a dequantized block into 8-bit samples, row by row.
+ *          Columns first, rows second, both passes in fixed point; a column
+ *          without AC coefficients is a flat one.
+ */
+static void jpeg_idct(int32_t* in, uint8_t* out) {
+  int32_t ws[64];
+  int32_t tmp0, tmp1, tmp2, tmp3, tmp10, tmp11, tmp12, tmp13;
+  int32_t z1, z2, z3, z4, z5;
+
+  for (uint32_t c = 0; c < 8; c++) {
+    int32_t* s = &in[c];
+    int32_t* d = &ws[c];
+
+    if (!s[8] && !s[16] && !s[24] && !s[32] && !s[40] && !s[48] && !s[56]) {
+      int32_t dc = s[0] * (1 << IDCT_PASS1_BITS);
+
+      for (uint32_t r = 0; r < 64; r += 8) d[r] = dc;
+      continue;
+    }
+
+    // even part
+    z2 = s[16];
+    z3 = s[48];
+    z1 = (z2 + z3) * FIX_0_541196100;
+    tmp2 = z1 - (z3 * FIX_1_847759065);
+    tmp3 = z1 + (z2 * FIX_0_765366865);
+
+    tmp0 = (s[0] + s[32]) * (1 << IDCT_CONST_BITS);
+    tmp1 = (s[0] - s[32]) * (1 << IDCT_CONST_BITS);
+
+    tmp10 = tmp0 + tmp3;
+    tmp13 = tmp0 - tmp3;
+    tmp11 = tmp1 + tmp2;
+    tmp12 = tmp1 - tmp2;
+
+    // odd part
+    tmp0 = s[56];
+    tmp1 = s[40];
+    tmp2 = s[24];
+    tmp3 = s[8];
+
+    z1 = tmp0 + tmp3;
+    z2 = tmp1 + tmp2;
+    z3 = tmp0 + tmp2;
+    z4 = tmp1 + tmp3;
+    z5 = (z3 + z4) * FIX_1_175875602;
+
+    tmp0 *= FIX_0_298631336;
+    tmp1 *= FIX_2_053119869;
+    tmp2 *= FIX_3_072711026;
+    tmp3 *= FIX_1_501321110;
+    z1 *= -FIX_0_899976223;
+    z2 *= -FIX_2_562915447;
+    z3 = (z3 * -FIX_1_961570560) + z5;
+    z4 = (z4 * -FIX_0_390180644) + z5;
+
+    tmp0 += z1 + z3;
+    tmp1 += z2 + z4;
+    tmp2 += z2 + z3;
+    tmp3 += z1 + z4;
+
+    #define PASS1(v)  (((v) + (1 << (IDCT_CONST_BITS - IDCT_PASS1_BITS - 1))) >> (IDCT_CONST_BITS - IDCT_PASS1_BITS))
+    d[0]  = PASS1(tmp10 + tmp3);
+    d[56] = PASS1(tmp10 - tmp3);
+    d[8]  = PASS1(tmp11 + tmp2);
+    d[48] = PASS1(tmp11 - tmp2);
+    d[16] = PASS1(tmp12 + tmp1);
+    d[40] = PASS1(tmp12 - tmp1);
+    d[24] = PASS1(tmp13 + tmp0);
+    d[32] = PASS1(tmp13 - tmp0);
+    #undef PASS1
+  }
+
+  for (uint32_t r = 0; r < 64; r += 8) {
+    int32_t* s = &ws[r];
+    uint8_t* d = &out[r];
+
+    // even part
+    z2 = s[2];
+    z3 = s[6];
+    z1 = (z2 + z3) * FIX_0_541196100;
+    tmp2 = z1 - (z3 * FIX_1_847759065);
+    tmp3 = z1 + (z2 * FIX_0_765366865);
+
+    tmp0 = (s[0] + s[4]) * (1 << IDCT_CONST_BITS);
+    tmp1 = (s[0] - s[4]) * (1 << IDCT_CONST_BITS);
+
+    tmp10 = tmp0 + tmp3;
+    tmp13 = tmp0 - tmp3;
+    tmp11 = tmp1 + tmp2;
+    tmp12 = tmp1 - tmp2;
+
+    // odd part
+    tmp0 = s[7];
+    tmp1 = s[5];
+    tmp2 = s[3];
+    tmp3 = s[1];
+
+    z1 = tmp0 + tmp3;
+    z2 = tmp1 + tmp2;
+    z3 = tmp0 + tmp2;
+    z4 = tmp1 + tmp3;
+    z5 = (z3 + z4) * FIX_1_175875602;
+
+    tmp0 *= FIX_0_298631336;
+    tmp1 *= FIX_2_053119869;
+    tmp2 *= FIX_3_072711026;
+    tmp3 *= FIX_1_501321110;
+    z1 *= -FIX_0_899976223;
+    z2 *= -FIX_2_562915447;
+    z3 = (z3 * -FIX_1_961570560) + z5;
+    z4 = (z4 * -FIX_0_390180644) + z5;
+
+    tmp0 += z1 + z3;
+    tmp1 += z2 + z4;
+    tmp2 += z2 + z3;
+    tmp3 += z1 + z4;
+
+    // back to samples, level shifted by 128
+    #define PASS2(v)  jpeg_clamp((((v) + (1 << (IDCT_CONST_BITS + IDCT_PASS1_BITS + 2))) >> (IDCT_CONST_BITS + IDCT_PASS1_BITS + 3)) + 128)
+    d[0] = PASS2(tmp10 + tmp3);
+    d[7] = PASS2(tmp10 - tmp3);
+    d[1] = PASS2(tmp11 + tmp2);
+    d[6] = PASS2(tmp11 - tmp2);
+    d[2] = PASS2(tmp12 + tmp1);
+    d[5] = PASS2(tmp12 - tmp1);
+    d[3] = PASS2(tmp13 + tmp0);
+    d[4] = PASS2(tmp13 - tmp0);
+    #undef PASS2
+  }
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Decodes and transforms one block of component c.
+ */
+static bool jpeg_block(Jpeg_TypeDef* jpg, JpegComp_TypeDef* c, uint8_t* out) {
+  int32_t* coef = jpg->Coef;
+  const uint16_t* q = jpg->Qt[c->Tq];
+
+  memset(coef, 0, sizeof(jpg->Coef));
+
+  int32_t s = jpeg_huff(jpg, &jpg->Dc[c->Td]);
+  if ((s < 0) || (s > 11)) return false;
+  if (s) c->Pred += jpeg_extend(jpeg_bits(jpg, s), s);
+  coef[0] = c->Pred * q[0];
+
+  for (uint32_t k = 1; k < 64; k++) {
+    int32_t rs = jpeg_huff(jpg, &jpg->Ac[c->Ta]);
+    if (rs < 0) return false;
+
+    s = rs & 0x0f;
+    if (!s) {
+      // end of block, or a run of 16 zeros
+      if ((rs >> 4) != 15) break;
+      k += 15;
+      continue;
+    }
+
+    k += rs >> 4;
+    if (k > 63) return false;
+    coef[jpeg_zigzag[k]] = jpeg_extend(jpeg_bits(jpg, s), s) * q[k];
+  }
+
+  jpeg_idct(coef, out);
+  return true;
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Moves past a restart marker: the bits left before it are padding,
+ *          the DC predictions start over.
+ */
+static bool jpeg_restart(Jpeg_TypeDef* jpg) {
+  jpg->Bits   = 0;
+  jpg->BitCnt = 0;
+
+  while (!jpg->Marker) {
+    uint8_t b;
+
+    if (!jpeg_byte(jpg, &b)) return false;
+    if (b != 0xff) continue;
+
+    do {
+      if (!jpeg_byte(jpg, &b)) return false;
+    } while (b == 0xff);
+    jpg->Marker = b;
+  }
+
+  if ((jpg->Marker & 0xf8) != 0xd0) return false;
+
+  jpg->Marker = 0;
+  for (uint32_t i = 0; i < jpg->CompNum; i++) jpg->Comp[i].Pred = 0;
+  return true;
+}
+
+
+// --------------------------------------------------------------------------
+
+__STATIC_INLINE uint8_t jpeg_sample(const Jpeg_TypeDef* jpg, const JpegComp_TypeDef* c, uint32_t x, uint32_t y) {
+  return jpg->Samples[c->Blk + ((y >> 3) * c->H) + (x >> 3)][((y & 7) << 3) | (x & 7)];
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Reads the headers up to the start of the scan. W, H and the MCU
+ *          layout are known afterwards.
+ */
+HAL_StatusTypeDef Jpeg_Begin(Jpeg_TypeDef* jpg, uint32_t (*read)(void*, uint8_t*, uint32_t), void* ctx) {
+
+  if (!jpg || !read) return HAL_ERROR;
+
+  memset(jpg, 0, sizeof(Jpeg_TypeDef));
+  jpg->Read = read;
+  jpg->Ctx  = ctx;
+
+  for (uint32_t t = 0; t < 2; t++) {
+    for (uint32_t l = 0; l <= 16; l++) {
+      jpg->Dc[t].MaxCode[l] = -1;
+      jpg->Ac[t].MaxCode[l] = -1;
+    }
+  }
+
+  uint8_t b, m;
+  if (!jpeg_byte(jpg, &b) || !jpeg_byte(jpg, &m) || (b != 0xff) || (m != 0xd8)) return HAL_ERROR;
+
+  for (;;) {
+    uint16_t len;
+
+    // markers may be padded with 0xff
+    do {
+      if (!jpeg_byte(jpg, &b)) return HAL_ERROR;
+    } while (b != 0xff);
+    do {
+      if (!jpeg_byte(jpg, &m)) return HAL_ERROR;
+    } while (m == 0xff);
+
+    if ((m == 0x01) || ((m >= 0xd0) && (m <= 0xd9))) return HAL_ERROR;
+    if (!jpeg_word(jpg, &len) || (len < 2)) return HAL_ERROR;
+    len -= 2;
+
+    bool ok;
+
+    switch (m) {
+      case 0xc0:
+      case 0xc1:
+        ok = jpeg_sof(jpg, len);
+      break;
+
+      case 0xc4:
+        ok = jpeg_dht(jpg, len);
+      break;
+
+      case 0xdb:
+        ok = jpeg_dqt(jpg, len);
+      break;
+
+      case 0xdd:
+        ok = (len == 2) && jpeg_word(jpg, &jpg->Restart);
+      break;
+
+      case 0xda:
+        if (!jpeg_sos(jpg, len)) return HAL_ERROR;
+        jpg->Left = jpg->Restart;
+        return HAL_OK;
+
+      default:
+        // other frame types are not baseline, the rest is skipped
+        if (((m & 0xf0) == 0xc0) && (m != 0xc8) && (m != 0xcc)) return HAL_ERROR;
+        ok = jpeg_skip(jpg, len);
+      break;
+    }
+
+    if (!ok) return HAL_ERROR;
+  }
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Decodes the next MCU into out, McuW columns of McuH pixels. MCUs
+ *          come left to right, top to bottom, the ones on the right and
+ *          bottom edges reach past the picture.
+ */
+HAL_StatusTypeDef Jpeg_Mcu(Jpeg_TypeDef* jpg, uint16_t* out) {
+
+  if (jpg->Restart) {
+    if (!jpg->Left) {
+      if (!jpeg_restart(jpg)) return HAL_ERROR;
+      jpg->Left = jpg->Restart;
+    }
+    jpg->Left--;
+  }
+
+  for (uint32_t i = 0; i < jpg->CompNum; i++) {
+    JpegComp_TypeDef* c = &jpg->Comp[i];
+
+    for (uint32_t b = 0; b < (uint32_t)(c->H * c->V); b++) {
+      if (!jpeg_block(jpg, c, jpg->Samples[c->Blk + b])) return HAL_ERROR;
+    }
+  }
+
+  // the picture was cut short
+  if (jpg->Marker == 0xff) return HAL_ERROR;
+
+  const JpegComp_TypeDef* cy = &jpg->Comp[0];
+
+  if (jpg->CompNum == 1) {
+    for (uint32_t x = 0; x < 8; x++) {
+      for (uint32_t y = 0; y < 8; y++) {
+        uint32_t v = jpeg_sample(jpg, cy, x, y);
+        *out++ = ((v >> 3) << 11) | ((v >> 2) << 5) | (v >> 3);
+      }
+    }
+    return HAL_OK;
+  }
+
+  const JpegComp_TypeDef* cb = &jpg->Comp[1];
+  const JpegComp_TypeDef* cr = &jpg->Comp[2];
+
+  // a chroma component with half the MCU size is read at half the position
+  uint32_t bx = ((cb->H * 8) < jpg->McuW), by = ((cb->V * 8) < jpg->McuH);
+  uint32_t rx = ((cr->H * 8) < jpg->McuW), ry = ((cr->V * 8) < jpg->McuH);
+  uint32_t yx = ((cy->H * 8) < jpg->McuW), yy = ((cy->V * 8) < jpg->McuH);
+
+  for (uint32_t x = 0; x < jpg->McuW; x++) {
+    for (uint32_t y = 0; y < jpg->McuH; y++) {
+      int32_t l  = (int32_t)jpeg_sample(jpg, cy, (x >> yx), (y >> yy)) << 16;
+      int32_t u  = (int32_t)jpeg_sample(jpg, cb, (x >> bx), (y >> by)) - 128;
+      int32_t v  = (int32_t)jpeg_sample(jpg, cr, (x >> rx), (y >> ry)) - 128;
+
+      int32_t r = jpeg_clamp((l + (YCC_CR_R * v) + 0x8000) >> 16);
+      int32_t g = jpeg_clamp((l - (YCC_CB_G * u) - (YCC_CR_G * v) + 0x8000) >> 16);
+      int32_t b = jpeg_clamp((l + (YCC_CB_B * u) + 0x8000) >> 16);
+
+      *out++ = ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3);
+    }
+  }
+
+  return HAL_OK;
+}
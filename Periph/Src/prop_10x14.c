@@ -0,0 +1,193 @@
+/*
+ * Filename: prop_10x14.c
+ * Description: font_dot_10x14 cut down to the inked glyph boxes, 1325 bytes.
+ *              Generated by Tools/propfont.py, do not edit.
+ */
+
+#include "propfont.h"
+
+
+const uint8_t prop_10x14_bitmap[1325] = {
+  0xf3, 0xff, 0xfc, 0x0f, 0xff, 0x0f, 0x00, 0xff, 0x0f, 0x60, 0x18, 0x30, 0xcc, 0xff, 0xff, 0xff,
+  0x0f, 0x86, 0x01, 0xc3, 0xfc, 0xff, 0xff, 0xff, 0x60, 0x18, 0x30, 0x0c, 0x18, 0x06, 0x0c, 0x03,
+  0x66, 0x06, 0x33, 0xf3, 0xff, 0xff, 0xff, 0x63, 0x66, 0x30, 0x33, 0x60, 0x18, 0x30, 0x0c, 0x0f,
+  0xff, 0xc3, 0x0f, 0x33, 0xc3, 0xcc, 0xcf, 0xff, 0xf3, 0x3f, 0x33, 0xcc, 0x0c, 0x3f, 0xfc, 0x0f,
+  0x0f, 0x3c, 0x0f, 0xcf, 0x33, 0x0c, 0x0f, 0xc3, 0xc3, 0xf0, 0x30, 0xcc, 0xff, 0xf0, 0x3f, 0xc3,
+  0xc0, 0x30, 0x00, 0xff, 0xfc, 0x3f, 0xfc, 0x3f, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+  0xfc, 0x3f, 0xfc, 0x3f, 0x33, 0x33, 0xfc, 0xfc, 0x33, 0x33, 0x30, 0xc0, 0x00, 0x03, 0x0c, 0xff,
+  0xff, 0x0f, 0x03, 0x0c, 0x30, 0xc0, 0x00, 0xf3, 0xcc, 0xf3, 0xff, 0x0f, 0x0f, 0x0f, 0xc0, 0x03,
+  0x00, 0x03, 0xc0, 0x00, 0xc0, 0x00, 0x30, 0x00, 0x30, 0x00, 0x0c, 0x00, 0x3c, 0x00, 0x0f, 0xfc,
+  0x0f, 0xff, 0x33, 0x03, 0xcf, 0xc0, 0xc3, 0xf0, 0x30, 0x3c, 0x30, 0x0f, 0xcc, 0xfc, 0x0f, 0xff,
+  0x03, 0x03, 0xf0, 0x00, 0xfc, 0xff, 0xff, 0xff, 0x03, 0xc0, 0x00, 0x00, 0x3f, 0xcc, 0x0f, 0x33,
+  0x0c, 0x0f, 0xc3, 0xc3, 0xf0, 0x30, 0x3c, 0x0c, 0x0f, 0xc3, 0x03, 0xcf, 0xc0, 0x03, 0x0c, 0x0c,
+  0x03, 0x33, 0x00, 0x0f, 0xc0, 0xc3, 0xf0, 0x30, 0x3c, 0x0c, 0x0f, 0xc3, 0x3c, 0x0f, 0xcf, 0x03,
+  0xc0, 0x3f, 0xf0, 0x0f, 0x0c, 0x00, 0x03, 0xc0, 0x00, 0x30, 0xf0, 0xff, 0xff, 0xff, 0xc0, 0x00,
+  0x30, 0x00, 0xc3, 0xff, 0xf0, 0x3f, 0x0c, 0x0f, 0xc3, 0xc3, 0xf0, 0x30, 0x3c, 0x0c, 0x0f, 0xc3,
+  0x3c, 0x30, 0x0f, 0x0c, 0xfc, 0x0f, 0xff, 0x33, 0x0c, 0x0f, 0xc3, 0xc3, 0xf0, 0x30, 0x3c, 0x0c,
+  0x0f, 0xc3, 0x3c, 0x30, 0x0f, 0x0c, 0x00, 0x30, 0x00, 0xfc, 0x03, 0xff, 0xc0, 0xc0, 0x30, 0x30,
+  0x0c, 0x0c, 0x03, 0xc3, 0x00, 0x3f, 0xc0, 0x0f, 0x3c, 0x0f, 0xcf, 0x33, 0x0c, 0x0f, 0xc3, 0xc3,
+  0xf0, 0x30, 0x3c, 0x0c, 0x0f, 0xc3, 0x3c, 0x0f, 0xcf, 0x03, 0x0c, 0x0f, 0xc3, 0x33, 0x0c, 0x0f,
+  0xc3, 0xc3, 0xf0, 0x30, 0x3c, 0x0c, 0x0f, 0xc3, 0xfc, 0x0f, 0xff, 0x03, 0xc3, 0xc3, 0x03, 0x0c,
+  0xf0, 0xf0, 0xc3, 0x30, 0xc0, 0xc0, 0x0c, 0x33, 0x03, 0x0f, 0x0c, 0xf3, 0x3c, 0xcf, 0xf3, 0x3c,
+  0xcf, 0x03, 0x0f, 0xcc, 0x0c, 0x33, 0x30, 0xc0, 0x00, 0x00, 0x0c, 0x00, 0x03, 0x00, 0x03, 0xc0,
+  0xf3, 0xf0, 0x3c, 0x0c, 0x0c, 0x03, 0xc3, 0x00, 0x0f, 0xc0, 0x03, 0x0f, 0xcc, 0x03, 0x33, 0x0c,
+  0x0f, 0xc3, 0x33, 0xf3, 0xcc, 0x3c, 0x33, 0xcf, 0xcc, 0xfc, 0x0f, 0xff, 0x03, 0xff, 0xcf, 0xff,
+  0x03, 0x03, 0xc3, 0xc0, 0x30, 0x30, 0x0c, 0x0c, 0x03, 0xc3, 0xc0, 0xff, 0xcf, 0xff, 0x03, 0xff,
+  0xff, 0xff, 0x3f, 0x0c, 0x0f, 0xc3, 0xc3, 0xf0, 0x30, 0x3c, 0x0c, 0x0f, 0xc3, 0x3c, 0x0f, 0xcf,
+  0x03, 0xfc, 0x0f, 0xff, 0x33, 0x00, 0x0f, 0xc0, 0x03, 0xf0, 0x00, 0x3c, 0x00, 0x0f, 0xc0, 0x0c,
+  0x0c, 0x03, 0x03, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x0f, 0xc0, 0x03, 0xf0, 0x00, 0x3c, 0x00, 0x0f,
+  0xc0, 0xfc, 0x0f, 0xff, 0x03, 0xff, 0xff, 0xff, 0x3f, 0x0c, 0x0f, 0xc3, 0xc3, 0xf0, 0x30, 0x3c,
+  0x00, 0x0f, 0xc0, 0x03, 0xf0, 0x00, 0x0c, 0xff, 0xff, 0xff, 0x0f, 0x0c, 0x03, 0xc3, 0xc0, 0x30,
+  0x30, 0x0c, 0x00, 0x03, 0xc0, 0x00, 0x30, 0x00, 0x0c, 0xfc, 0x0f, 0xff, 0x33, 0x00, 0x0f, 0xc0,
+  0xc3, 0xf0, 0x30, 0x3c, 0x0c, 0x0f, 0xc3, 0xfc, 0x0c, 0x3f, 0x03, 0xff, 0xff, 0xff, 0x0f, 0x0c,
+  0x00, 0x03, 0xc0, 0x00, 0x30, 0x00, 0x0c, 0x00, 0x03, 0xff, 0xff, 0xff, 0x0f, 0x03, 0xf0, 0x00,
+  0x3c, 0x00, 0x0f, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x0f, 0xc0, 0x03, 0xf0, 0x00, 0x0c, 0x3c,
+  0x30, 0x0f, 0x3c, 0x00, 0x0f, 0xc0, 0x03, 0xf0, 0x00, 0xcc, 0xff, 0xf3, 0xff, 0x00, 0x30, 0x00,
+  0x0c, 0xff, 0xff, 0xff, 0x0f, 0x0c, 0x00, 0x03, 0xc0, 0x00, 0x30, 0x00, 0x33, 0xc0, 0x0c, 0x0f,
+  0xfc, 0x03, 0x0f, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x0c, 0x00, 0x03, 0xc0, 0x00, 0x30, 0x00, 0x0c,
+  0x00, 0x03, 0xc0, 0x00, 0x00, 0xff, 0xff, 0xff, 0x0f, 0xc0, 0x00, 0x30, 0xc0, 0x03, 0xf0, 0x00,
+  0xc0, 0x00, 0x30, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x0f, 0xc0, 0x00, 0x30, 0x00, 0x03,
+  0xc0, 0x00, 0x0c, 0x00, 0x03, 0xff, 0xff, 0xff, 0x0f, 0xfc, 0x0f, 0xff, 0x33, 0x00, 0x0f, 0xc0,
+  0x03, 0xf0, 0x00, 0x3c, 0x00, 0x0f, 0xc0, 0xfc, 0x0f, 0xff, 0x03, 0xff, 0xff, 0xff, 0x0f, 0x0c,
+  0x03, 0xc3, 0xc0, 0x30, 0x30, 0x0c, 0x0c, 0x03, 0xc3, 0x00, 0x0f, 0xc0, 0x03, 0xfc, 0x0f, 0xff,
+  0x33, 0x00, 0x0f, 0xc0, 0x0f, 0xf0, 0x03, 0x3c, 0x00, 0x0f, 0xc0, 0xfc, 0x0f, 0xff, 0x03, 0xff,
+  0xff, 0xff, 0x0f, 0x03, 0xc3, 0xc0, 0x30, 0x30, 0x0c, 0x0c, 0x03, 0xc3, 0xc0, 0xcf, 0xcf, 0xf3,
+  0x03, 0x03, 0xcf, 0xc0, 0x33, 0x0c, 0x0f, 0xc3, 0xc3, 0xf0, 0x30, 0x3c, 0x0c, 0x0f, 0xc3, 0x3c,
+  0x30, 0x0f, 0x0c, 0x00, 0x30, 0x00, 0x0c, 0x00, 0x03, 0xc0, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x03,
+  0xc0, 0x00, 0x30, 0x00, 0x0c, 0xfc, 0x3f, 0xff, 0x3f, 0x00, 0x0c, 0x00, 0x03, 0xc0, 0x00, 0x30,
+  0x00, 0x0c, 0x00, 0xfc, 0x3f, 0xff, 0x0f, 0xf0, 0x3f, 0xfc, 0xcf, 0x00, 0x30, 0x00, 0x03, 0xc0,
+  0x00, 0xc0, 0x00, 0x30, 0x00, 0xf0, 0x3f, 0xfc, 0x0f, 0xff, 0xff, 0xff, 0xcf, 0x00, 0x30, 0x00,
+  0xf0, 0x00, 0x3c, 0xc0, 0x00, 0x30, 0x00, 0xff, 0xff, 0xff, 0x0f, 0x0f, 0xfc, 0x03, 0x0f, 0x33,
+  0xc0, 0x0c, 0xc0, 0x00, 0x30, 0x00, 0x33, 0xc0, 0x0c, 0x0f, 0xfc, 0x03, 0x0f, 0x00, 0x3f, 0xc0,
+  0x0f, 0x0c, 0x00, 0x03, 0x3f, 0xc0, 0x0f, 0x00, 0x0c, 0x00, 0x03, 0x00, 0x3f, 0xc0, 0x0f, 0x0f,
+  0xf0, 0x03, 0x3c, 0x03, 0xcf, 0xc0, 0xc3, 0xf0, 0x30, 0x3c, 0x30, 0x0f, 0xcc, 0x03, 0xfc, 0x00,
+  0x0f, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x0f, 0xc0, 0x03, 0xf0, 0x00, 0x0c, 0x00, 0x3c, 0x00, 0x0f,
+  0x30, 0x00, 0x0c, 0xc0, 0x00, 0x30, 0x00, 0x03, 0xc0, 0x00, 0x0f, 0xc0, 0x03, 0x00, 0x03, 0xf0,
+  0x00, 0x3c, 0x00, 0x0f, 0xc0, 0xff, 0xff, 0xff, 0x0f, 0xc3, 0xc0, 0x30, 0x30, 0xcc, 0x30, 0xc3,
+  0x00, 0xff, 0xff, 0x0f, 0xc0, 0xc0, 0x03, 0x03, 0x0c, 0x33, 0x3c, 0xf3, 0xcc, 0x33, 0xcf, 0x3c,
+  0xf3, 0xcc, 0xff, 0xfc, 0x03, 0xff, 0xff, 0xff, 0x3f, 0x30, 0x0c, 0x0c, 0x03, 0xc3, 0xc0, 0x30,
+  0x30, 0x0c, 0x0c, 0xfc, 0x00, 0x3f, 0x00, 0xfc, 0xf0, 0x33, 0xf0, 0xc0, 0x03, 0x0f, 0x3c, 0xf0,
+  0xc0, 0xc3, 0x0c, 0x03, 0xfc, 0x00, 0x3f, 0x30, 0x30, 0x0c, 0x0c, 0x03, 0xc3, 0xc0, 0x30, 0x30,
+  0x0c, 0x0c, 0xff, 0xff, 0xff, 0x0f, 0xfc, 0xf0, 0x33, 0xf3, 0xcc, 0x33, 0xcf, 0x3c, 0xf3, 0xcc,
+  0xf3, 0xcc, 0x03, 0xc0, 0x00, 0x30, 0xf0, 0xff, 0xfc, 0x3f, 0xc0, 0x30, 0x30, 0x0c, 0x0c, 0x03,
+  0xc3, 0x00, 0x30, 0x00, 0x0c, 0x3c, 0x0f, 0xcf, 0x33, 0x3c, 0x0f, 0xcf, 0x33, 0xf3, 0xcc, 0x3c,
+  0xf3, 0xcf, 0xfc, 0x3c, 0x30, 0x0f, 0x0c, 0xff, 0xff, 0xff, 0x0f, 0x0c, 0x00, 0x03, 0x00, 0x03,
+  0xc0, 0x00, 0x30, 0x00, 0x0c, 0xff, 0xc0, 0x3f, 0x00, 0x03, 0xc3, 0xc0, 0xf0, 0x3f, 0xff, 0xcf,
+  0x03, 0xc0, 0x00, 0x00, 0x0c, 0x00, 0x03, 0x30, 0x00, 0x0c, 0x00, 0x03, 0xc0, 0x00, 0xc0, 0x3f,
+  0xf3, 0xcf, 0xff, 0xff, 0xff, 0x0f, 0x0c, 0x00, 0x03, 0xc0, 0x00, 0x30, 0x00, 0x33, 0xc0, 0x0c,
+  0x0f, 0xcc, 0x03, 0x03, 0x03, 0xf0, 0x00, 0xfc, 0xff, 0xff, 0xff, 0x03, 0xc0, 0x00, 0x30, 0x00,
+  0x0c, 0x00, 0xff, 0xff, 0x0f, 0x30, 0xc0, 0xff, 0xfc, 0x03, 0x30, 0xc0, 0xff, 0xff, 0x0f, 0xff,
+  0xff, 0x0f, 0x0c, 0x30, 0x00, 0x03, 0x0c, 0x30, 0xc0, 0xff, 0xfc, 0x03, 0xfc, 0xf0, 0x33, 0xf0,
+  0xc0, 0x03, 0x0f, 0x3c, 0xf0, 0xc0, 0xfc, 0xf0, 0x03, 0xff, 0xff, 0xff, 0x33, 0x3c, 0xc3, 0x30,
+  0x0c, 0xc3, 0x30, 0x0c, 0xc3, 0xc0, 0x03, 0x3c, 0xc0, 0x03, 0x3c, 0x30, 0x0c, 0xc3, 0x30, 0x0c,
+  0xc3, 0x33, 0x3c, 0xc3, 0xff, 0xff, 0xff, 0x03, 0x0c, 0xf0, 0xff, 0xff, 0xc3, 0x0c, 0x03, 0x30,
+  0xc0, 0xc0, 0x00, 0x03, 0xc3, 0x0c, 0x33, 0xf3, 0xcc, 0x33, 0xcf, 0x3c, 0xf3, 0xcc, 0x0c, 0x33,
+  0x0c, 0xfc, 0x3f, 0xff, 0x3f, 0x30, 0x0c, 0x0c, 0x03, 0xc3, 0xc0, 0xc0, 0x00, 0x30, 0x00, 0xfc,
+  0xf3, 0x3f, 0xc0, 0x00, 0x03, 0x0c, 0xc0, 0x00, 0x03, 0xff, 0xff, 0x0f, 0xf0, 0xc3, 0xcf, 0x00,
+  0x03, 0x03, 0x0c, 0xc0, 0x00, 0x03, 0xf0, 0xc3, 0x0f, 0xfc, 0xf3, 0x3f, 0xc0, 0x00, 0x3c, 0xf0,
+  0x30, 0xc0, 0x00, 0xfc, 0xf3, 0x0f, 0x03, 0x0f, 0xcc, 0x0c, 0x33, 0x30, 0xc0, 0xc0, 0x0c, 0x33,
+  0x03, 0x0f, 0x0c, 0xf3, 0x3f, 0xff, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0x33, 0x30, 0x03, 0xfc,
+  0xcf, 0xff, 0x03, 0x0f, 0xfc, 0xf0, 0xc3, 0x33, 0xcf, 0x3c, 0xfc, 0xf0, 0x03, 0x0f, 0x0c, 0xc0,
+  0x00, 0x30, 0xc0, 0xf3, 0xf0, 0x3c, 0x03, 0xf0, 0x00, 0x3c, 0x00, 0x0f, 0xc0, 0x0c, 0x0c, 0x03,
+  0x03, 0xff, 0xff, 0xff, 0x0f, 0x0c, 0x0c, 0x03, 0x33, 0x00, 0x0f, 0xc0, 0x03, 0xf0, 0x00, 0xcc,
+  0xf3, 0xf0, 0x3c, 0xc0, 0x00, 0x30, 0x00, 0x33, 0xcc, 0x33, 0xcc, 0xaa, 0x00
+};
+
+const FontGlyph_TypeDef prop_10x14_glyphs[96] = {
+  {    0,  0,  0, 0,  0,  6}, // ' ' (32)
+  {    0,  2, 14, 0,  2,  4}, // '!' (33)
+  {    4,  6,  6, 0, 10,  8}, // '"' (34)
+  {    9, 10, 15, 0,  1, 12}, // '#' (35)
+  {   28, 10, 15, 0,  1, 12}, // '$' (36)
+  {   47, 10, 14, 0,  2, 12}, // '%' (37)
+  {   65, 10, 14, 0,  2, 12}, // '&' (38)
+  {   83,  2,  4, 0, 12,  4}, // "'" (39)
+  {   84,  4, 16, 0,  0,  6}, // '(' (40)
+  {   92,  4, 16, 0,  0,  6}, // ')' (41)
+  {  100,  6,  8, 0,  8,  8}, // '*' (42)
+  {  106, 10, 10, 0,  4, 12}, // '+' (43)
+  {  119,  4,  6, 0,  0,  6}, // ',' (44)
+  {  122,  6,  2, 0,  8,  8}, // '-' (45)
+  {  124,  2,  2, 0,  2,  4}, // '.' (46)
+  {  125, 10, 14, 0,  2, 12}, // '/' (47)
+  {  143, 10, 14, 0,  2, 12}, // '0' (48)
+  {  161,  6, 14, 0,  2,  8}, // '1' (49)
+  {  172, 10, 14, 0,  2, 12}, // '2' (50)
+  {  190, 10, 14, 0,  2, 12}, // '3' (51)
+  {  208, 10, 14, 0,  2, 12}, // '4' (52)
+  {  226, 10, 14, 0,  2, 12}, // '5' (53)
+  {  244, 10, 14, 0,  2, 12}, // '6' (54)
+  {  262, 10, 14, 0,  2, 12}, // '7' (55)
+  {  280, 10, 14, 0,  2, 12}, // '8' (56)
+  {  298, 10, 14, 0,  2, 12}, // '9' (57)
+  {  316,  2,  8, 0,  4,  4}, // ':' (58)
+  {  318,  4, 10, 0,  2,  6}, // ';' (59)
+  {  323,  6, 10, 0,  4,  8}, // '<' (60)
+  {  331,  8,  6, 0,  6, 10}, // '=' (61)
+  {  337,  6, 10, 0,  4,  8}, // '>' (62)
+  {  345, 10, 14, 0,  2, 12}, // '?' (63)
+  {  363, 10, 14, 0,  2, 12}, // '@' (64)
+  {  381, 10, 14, 0,  2, 12}, // 'A' (65)
+  {  399, 10, 14, 0,  2, 12}, // 'B' (66)
+  {  417, 10, 14, 0,  2, 12}, // 'C' (67)
+  {  435, 10, 14, 0,  2, 12}, // 'D' (68)
+  {  453, 10, 14, 0,  2, 12}, // 'E' (69)
+  {  471, 10, 14, 0,  2, 12}, // 'F' (70)
+  {  489, 10, 14, 0,  2, 12}, // 'G' (71)
+  {  507, 10, 14, 0,  2, 12}, // 'H' (72)
+  {  525, 10, 14, 0,  2, 12}, // 'I' (73)
+  {  543, 10, 14, 0,  2, 12}, // 'J' (74)
+  {  561, 10, 14, 0,  2, 12}, // 'K' (75)
+  {  579, 10, 14, 0,  2, 12}, // 'L' (76)
+  {  597, 10, 14, 0,  2, 12}, // 'M' (77)
+  {  615, 10, 14, 0,  2, 12}, // 'N' (78)
+  {  633, 10, 14, 0,  2, 12}, // 'O' (79)
+  {  651, 10, 14, 0,  2, 12}, // 'P' (80)
+  {  669, 10, 14, 0,  2, 12}, // 'Q' (81)
+  {  687, 10, 14, 0,  2, 12}, // 'R' (82)
+  {  705, 10, 14, 0,  2, 12}, // 'S' (83)
+  {  723, 10, 14, 0,  2, 12}, // 'T' (84)
+  {  741, 10, 14, 0,  2, 12}, // 'U' (85)
+  {  759, 10, 14, 0,  2, 12}, // 'V' (86)
+  {  777, 10, 14, 0,  2, 12}, // 'W' (87)
+  {  795, 10, 14, 0,  2, 12}, // 'X' (88)
+  {  813, 10, 14, 0,  2, 12}, // 'Y' (89)
+  {  831, 10, 14, 0,  2, 12}, // 'Z' (90)
+  {  849,  6, 14, 0,  2,  8}, // '[' (91)
+  {  860, 10, 14, 0,  2, 12}, // '\\' (92)
+  {  878,  6, 14, 0,  2,  8}, // ']' (93)
+  {  889, 10,  6, 0, 10, 12}, // '^' (94)
+  {  897, 10,  2, 0,  2, 12}, // '_' (95)
+  {  900,  4,  8, 0,  8,  6}, // '`' (96)
+  {  904, 10, 10, 0,  2, 12}, // 'a' (97)
+  {  917, 10, 14, 0,  2, 12}, // 'b' (98)
+  {  935, 10, 10, 0,  2, 12}, // 'c' (99)
+  {  948, 10, 14, 0,  2, 12}, // 'd' (100)
+  {  966, 10, 10, 0,  2, 12}, // 'e' (101)
+  {  979, 10, 14, 0,  2, 12}, // 'f' (102)
+  {  997, 10, 14, 0,  2, 12}, // 'g' (103)
+  { 1015, 10, 14, 0,  2, 12}, // 'h' (104)
+  { 1033,  6, 14, 0,  2,  8}, // 'i' (105)
+  { 1044,  8, 14, 0,  2, 10}, // 'j' (106)
+  { 1058, 10, 14, 0,  2, 12}, // 'k' (107)
+  { 1076,  8, 14, 0,  2, 10}, // 'l' (108)
+  { 1090, 10, 10, 0,  2, 12}, // 'm' (109)
+  { 1103, 10, 10, 0,  2, 12}, // 'n' (110)
+  { 1116, 10, 10, 0,  2, 12}, // 'o' (111)
+  { 1129, 10, 12, 0,  2, 12}, // 'p' (112)
+  { 1144, 10, 12, 0,  2, 12}, // 'q' (113)
+  { 1159, 10, 10, 0,  2, 12}, // 'r' (114)
+  { 1172, 10, 10, 0,  2, 12}, // 's' (115)
+  { 1185,  8, 14, 0,  2, 10}, // 't' (116)
+  { 1199, 10, 10, 0,  2, 12}, // 'u' (117)
+  { 1212, 10, 10, 0,  2, 12}, // 'v' (118)
+  { 1225, 10, 10, 0,  2, 12}, // 'w' (119)
+  { 1238, 10, 10, 0,  2, 12}, // 'x' (120)
+  { 1251, 10, 12, 0,  2, 12}, // 'y' (121)
+  { 1266, 10, 10, 0,  2, 12}, // 'z' (122)
+  { 1279, 10, 14, 0,  2, 12}, // '{' (123)
+  { 1297,  2, 14, 0,  2,  4}, // '|' (124)
+  { 1301, 10, 14, 0,  2, 12}, // '}' (125)
+  { 1319,  8,  4, 0,  8, 10}, // '~' (126)
+  { 1323,  3,  3, 0, 11,  5}  // '°' (176)
+};
@@ -0,0 +1,294 @@
+/*
+ * Filename: prop_15x21.c
+ * Description: font_dot_15x21 cut down to the inked glyph boxes, 2930 bytes.
+ *              Generated by Tools/propfont.py, do not edit.
+ */
+
+#include "propfont.h"
+
+
+const uint8_t prop_15x21_bitmap[2930] = {
+  0xc7, 0xff, 0xff, 0xf8, 0xff, 0x1f, 0xff, 0x7f, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x00, 0x00, 0xf0,
+  0xff, 0xff, 0xff, 0x03, 0xc0, 0x81, 0x03, 0x38, 0x70, 0x00, 0x07, 0x8e, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x3f, 0x70, 0xe0, 0x00, 0x0e, 0x1c, 0xc0, 0x81, 0xe3, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x0f, 0x1c, 0x38, 0x80, 0x03, 0x07, 0x70, 0xe0, 0x00, 0x38, 0x70, 0x00, 0x07,
+  0x0e, 0xe0, 0xc0, 0x01, 0x1c, 0xc7, 0x81, 0xe3, 0x38, 0x70, 0x1c, 0xc7, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x1f, 0xc7, 0x71, 0xe0, 0x38, 0x0e, 0x1c, 0xc7, 0x01, 0x1c, 0x38, 0x80, 0x03,
+  0x07, 0x70, 0xe0, 0x00, 0x3f, 0xf0, 0xff, 0x07, 0xfe, 0xff, 0xc0, 0x7f, 0xe0, 0x39, 0x0e, 0x3c,
+  0xc7, 0x81, 0xe7, 0xf8, 0x8f, 0xff, 0xff, 0xf1, 0xff, 0x3f, 0xfe, 0xff, 0x38, 0x0e, 0x1c, 0xc7,
+  0x81, 0xe3, 0x38, 0xf0, 0x1f, 0xf8, 0xff, 0x03, 0xff, 0x7f, 0xe0, 0x07, 0xf8, 0xf1, 0x03, 0x3f,
+  0x7e, 0xe0, 0xc7, 0x8f, 0x03, 0x07, 0x7e, 0xe0, 0xc0, 0x0f, 0x1c, 0xf8, 0x81, 0x03, 0x3f, 0x70,
+  0xe0, 0x07, 0x0e, 0x1c, 0xff, 0x7f, 0xe0, 0xff, 0x0f, 0xfc, 0xff, 0x71, 0xe0, 0x00, 0x0e, 0x1c,
+  0xc0, 0x81, 0x03, 0x00, 0xff, 0xff, 0x03, 0xf8, 0xff, 0x03, 0xff, 0x7f, 0xe0, 0xff, 0x8f, 0x03,
+  0x00, 0x7e, 0x00, 0xc0, 0x0f, 0x00, 0x38, 0x07, 0x00, 0xfc, 0x00, 0x80, 0x1f, 0x00, 0x70, 0xfc,
+  0xff, 0x81, 0xff, 0x3f, 0xf0, 0xff, 0x07, 0xc7, 0x71, 0x1c, 0xc7, 0x81, 0xff, 0xf8, 0x8f, 0xff,
+  0xc7, 0x71, 0x1c, 0xc7, 0x01, 0xc0, 0x01, 0xe0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1c, 0x00, 0x0e,
+  0xfc, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xe0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1c, 0x00, 0x0e, 0x00,
+  0x07, 0x00, 0xc7, 0x8f, 0x1f, 0xc7, 0x8f, 0x1f, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x01,
+  0x3f, 0x00, 0xe0, 0x07, 0x00, 0xfc, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x1c, 0x00, 0x80, 0x03, 0x00,
+  0x80, 0x03, 0x00, 0x70, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x0e, 0x00, 0xc0, 0x01, 0x00, 0x38, 0x00,
+  0x00, 0xf8, 0x01, 0x00, 0x3f, 0x00, 0xe0, 0x07, 0xf8, 0xff, 0x03, 0xff, 0x7f, 0xe0, 0xff, 0x8f,
+  0xe3, 0x00, 0x7e, 0x1c, 0xc0, 0x8f, 0x03, 0xf8, 0x81, 0x03, 0x3f, 0x70, 0xe0, 0x07, 0x0e, 0xfc,
+  0x00, 0x8e, 0x1f, 0xc0, 0xf1, 0x03, 0x38, 0x8e, 0xff, 0x3f, 0xf0, 0xff, 0x07, 0xfe, 0xff, 0x00,
+  0x07, 0x00, 0xfc, 0x00, 0x80, 0x1f, 0x00, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x01, 0x00, 0x38, 0x00, 0x00, 0x07, 0x00, 0x00, 0xff, 0x81, 0xe3, 0x3f, 0x70, 0xfc, 0x07, 0x8e,
+  0x03, 0x07, 0x7e, 0xe0, 0xc0, 0x0f, 0x1c, 0xf8, 0x81, 0x03, 0x3f, 0x70, 0xe0, 0x07, 0x0e, 0xfc,
+  0xc0, 0x81, 0x1f, 0x38, 0xf0, 0x03, 0x07, 0x7e, 0x00, 0x3f, 0x0e, 0xe0, 0xc7, 0x01, 0xfc, 0x00,
+  0x38, 0x80, 0x03, 0x07, 0x70, 0xe0, 0x00, 0x8e, 0x03, 0x00, 0x7e, 0x00, 0xc0, 0x0f, 0x00, 0xf8,
+  0x81, 0x03, 0x3f, 0x70, 0xe0, 0x07, 0x0e, 0xfc, 0xc0, 0x81, 0x1f, 0x38, 0xf0, 0x03, 0x07, 0x8e,
+  0x1f, 0x3f, 0xf0, 0xe3, 0x07, 0x7e, 0xfc, 0x00, 0x00, 0xfe, 0x1f, 0xc0, 0xff, 0x03, 0xf8, 0x7f,
+  0x00, 0x07, 0x00, 0xe0, 0x00, 0x00, 0x1c, 0x00, 0x80, 0x03, 0x00, 0x70, 0x00, 0x00, 0x0e, 0x00,
+  0xc0, 0x01, 0x00, 0x38, 0x00, 0x00, 0x07, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x07,
+  0x07, 0xfe, 0xff, 0xc0, 0xff, 0x1f, 0xf8, 0xff, 0x03, 0x07, 0x7e, 0xe0, 0xc0, 0x0f, 0x1c, 0xf8,
+  0x81, 0x03, 0x3f, 0x70, 0xe0, 0x07, 0x0e, 0xfc, 0xc0, 0x81, 0x1f, 0x38, 0xf0, 0x03, 0x07, 0x8e,
+  0x1f, 0xc0, 0xf1, 0x03, 0x38, 0x7e, 0x00, 0x07, 0xf8, 0xff, 0x03, 0xff, 0x7f, 0xe0, 0xff, 0x8f,
+  0x03, 0x07, 0x7e, 0xe0, 0xc0, 0x0f, 0x1c, 0xf8, 0x81, 0x03, 0x3f, 0x70, 0xe0, 0x07, 0x0e, 0xfc,
+  0xc0, 0x81, 0x1f, 0x38, 0xf0, 0x03, 0x07, 0x8e, 0x1f, 0xc0, 0xf1, 0x03, 0x38, 0x7e, 0x00, 0x07,
+  0x00, 0x00, 0x1c, 0x00, 0x80, 0x03, 0x00, 0xf0, 0xff, 0x00, 0xfe, 0x1f, 0xc0, 0xff, 0x03, 0x38,
+  0x80, 0x03, 0x07, 0x70, 0xe0, 0x00, 0x0e, 0x1c, 0xc0, 0x81, 0x03, 0x38, 0x70, 0x00, 0x07, 0x0e,
+  0x00, 0xff, 0x01, 0xe0, 0x3f, 0x00, 0xfc, 0x07, 0xf8, 0xf1, 0x03, 0x3f, 0x7e, 0xe0, 0xc7, 0x8f,
+  0x03, 0x07, 0x7e, 0xe0, 0xc0, 0x0f, 0x1c, 0xf8, 0x81, 0x03, 0x3f, 0x70, 0xe0, 0x07, 0x0e, 0xfc,
+  0xc0, 0x81, 0x1f, 0x38, 0xf0, 0x03, 0x07, 0x8e, 0x1f, 0x3f, 0xf0, 0xe3, 0x07, 0x7e, 0xfc, 0x00,
+  0x38, 0xf0, 0x03, 0x07, 0x7e, 0xe0, 0xc0, 0x8f, 0x03, 0x07, 0x7e, 0xe0, 0xc0, 0x0f, 0x1c, 0xf8,
+  0x81, 0x03, 0x3f, 0x70, 0xe0, 0x07, 0x0e, 0xfc, 0xc0, 0x81, 0x1f, 0x38, 0xf0, 0x03, 0x07, 0x8e,
+  0xff, 0x3f, 0xf0, 0xff, 0x07, 0xfe, 0xff, 0x00, 0x07, 0x7e, 0xe0, 0x07, 0x0e, 0x07, 0x80, 0x03,
+  0xc0, 0x01, 0xe0, 0x07, 0xfe, 0x03, 0xff, 0x81, 0x03, 0xc0, 0x01, 0xe0, 0x00, 0x70, 0x00, 0xc7,
+  0x81, 0xe3, 0xc0, 0x71, 0x1c, 0xc0, 0x0f, 0xe0, 0x07, 0x70, 0xc7, 0x8f, 0x1f, 0x3f, 0x7e, 0xfc,
+  0xf8, 0xf1, 0xe3, 0xc7, 0x8f, 0x1f, 0x3f, 0x0e, 0x07, 0xf0, 0x03, 0xf8, 0x01, 0x1c, 0xc7, 0x81,
+  0xe3, 0xc0, 0x71, 0x00, 0x07, 0x80, 0x03, 0xc0, 0x01, 0x00, 0x80, 0x03, 0x00, 0x70, 0x00, 0x00,
+  0x0e, 0x00, 0x00, 0x0e, 0x00, 0xc0, 0x01, 0x00, 0xf8, 0xf1, 0x03, 0x3f, 0x7e, 0xe0, 0xc7, 0x0f,
+  0x1c, 0xc0, 0x81, 0x03, 0x38, 0x70, 0x00, 0x07, 0x0e, 0x00, 0x3f, 0x00, 0xe0, 0x07, 0x00, 0xfc,
+  0x00, 0x3f, 0x80, 0xe3, 0x07, 0x70, 0xfc, 0x00, 0x8e, 0x03, 0x07, 0x7e, 0xe0, 0xc0, 0x0f, 0x1c,
+  0xf8, 0x71, 0x1c, 0x3f, 0x8e, 0xe3, 0xc7, 0x71, 0xfc, 0x38, 0x8e, 0x1f, 0xc7, 0xf1, 0xe3, 0x38,
+  0x8e, 0xff, 0x3f, 0xf0, 0xff, 0x07, 0xfe, 0xff, 0x00, 0xff, 0xff, 0xe3, 0xff, 0x7f, 0xfc, 0xff,
+  0x0f, 0x60, 0x00, 0x0e, 0x0c, 0xc0, 0x81, 0x01, 0x38, 0x30, 0x00, 0x07, 0x06, 0xe0, 0xc0, 0x00,
+  0x1c, 0x18, 0x80, 0x03, 0x03, 0x70, 0x60, 0x00, 0xfe, 0xff, 0x3f, 0xfe, 0xff, 0xc7, 0xff, 0xff,
+  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0x07, 0x7e, 0xe0, 0xc0, 0x0f, 0x1c,
+  0xf8, 0x81, 0x03, 0x3f, 0x70, 0xe0, 0x07, 0x0e, 0xfc, 0xc0, 0x81, 0x1f, 0x38, 0xf0, 0x03, 0x07,
+  0x8e, 0x1f, 0x3f, 0xf0, 0xe3, 0x07, 0x7e, 0xfc, 0x00, 0xf8, 0xff, 0x03, 0xff, 0x7f, 0xe0, 0xff,
+  0x8f, 0x03, 0x00, 0x7e, 0x00, 0xc0, 0x0f, 0x00, 0xf8, 0x01, 0x00, 0x3f, 0x00, 0xe0, 0x07, 0x00,
+  0xfc, 0x00, 0x80, 0x1f, 0x00, 0xf0, 0x03, 0x00, 0x8e, 0x03, 0x38, 0x70, 0x00, 0x07, 0x0e, 0xe0,
+  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0x00, 0x7e, 0x00, 0xc0, 0x0f, 0x00,
+  0xf8, 0x01, 0x00, 0x3f, 0x00, 0xe0, 0x07, 0x00, 0xfc, 0x00, 0x80, 0x1f, 0x00, 0xf0, 0x03, 0x00,
+  0x8e, 0xff, 0x3f, 0xf0, 0xff, 0x07, 0xfe, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x03, 0x07, 0x7e, 0xe0, 0xc0, 0x0f, 0x1c, 0xf8, 0x81, 0x03, 0x3f, 0x70, 0xe0, 0x07, 0x0e,
+  0xfc, 0x00, 0x80, 0x1f, 0x00, 0xf0, 0x03, 0x00, 0x7e, 0x00, 0xc0, 0x0f, 0x00, 0xf8, 0x01, 0x00,
+  0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x07, 0x0e, 0xe0, 0xc0, 0x01, 0x1c,
+  0x38, 0x80, 0x03, 0x07, 0x70, 0xe0, 0x00, 0x0e, 0x1c, 0x00, 0x80, 0x03, 0x00, 0x70, 0x00, 0x00,
+  0x0e, 0x00, 0xc0, 0x01, 0x00, 0x38, 0x00, 0x00, 0x07, 0xf8, 0xff, 0x1f, 0xff, 0xff, 0xe3, 0xff,
+  0xff, 0x03, 0x00, 0x7e, 0x00, 0xc0, 0x0f, 0x00, 0xf8, 0x81, 0x03, 0x3f, 0x70, 0xe0, 0x07, 0x0e,
+  0xfc, 0xc0, 0x81, 0x1f, 0x38, 0xf0, 0x03, 0x07, 0x8e, 0xff, 0x38, 0xf0, 0x1f, 0x07, 0xfe, 0xe3,
+  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x07, 0x00, 0xe0, 0x00, 0x00, 0x1c,
+  0x00, 0x80, 0x03, 0x00, 0x70, 0x00, 0x00, 0x0e, 0x00, 0xc0, 0x01, 0x00, 0x38, 0x00, 0x00, 0x07,
+  0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x07, 0x07, 0x00, 0xfc, 0x00, 0x80, 0x1f, 0x00,
+  0xf0, 0x03, 0x00, 0x7e, 0x00, 0xc0, 0x0f, 0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x00, 0x80, 0x1f, 0x00, 0xf0, 0x03, 0x00, 0x7e, 0x00, 0xc0, 0x0f, 0x00, 0xf8, 0x01, 0x00,
+  0x07, 0xf8, 0x01, 0x1c, 0x3f, 0x80, 0xe3, 0x07, 0xf0, 0x03, 0x00, 0x7e, 0x00, 0xc0, 0x0f, 0x00,
+  0xf8, 0x01, 0x00, 0x3f, 0x00, 0xe0, 0x07, 0x00, 0x1c, 0xff, 0xff, 0xe3, 0xff, 0x7f, 0xfc, 0xff,
+  0x0f, 0x00, 0xc0, 0x01, 0x00, 0x38, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x7f, 0x00, 0x07, 0x00, 0xe0, 0x00, 0x00, 0x1c, 0x00, 0x80, 0x03, 0x00, 0x70, 0x00, 0x00, 0x0e,
+  0x00, 0x78, 0x0c, 0x00, 0x8f, 0x01, 0xe0, 0x31, 0xf0, 0x03, 0xf8, 0x7f, 0x00, 0xff, 0x0f, 0xe0,
+  0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0x00, 0x70, 0x00, 0x00, 0x0e, 0x00,
+  0xc0, 0x01, 0x00, 0x38, 0x00, 0x00, 0x07, 0x00, 0xe0, 0x00, 0x00, 0x1c, 0x00, 0x80, 0x03, 0x00,
+  0x70, 0x00, 0x00, 0x0e, 0x00, 0xc0, 0x01, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x7f, 0x00, 0xc0, 0x01, 0x00, 0x38, 0x00, 0x00, 0x07, 0x80, 0x1f, 0x00, 0xf0, 0x03, 0x00, 0x7e,
+  0x00, 0x00, 0x70, 0x00, 0x00, 0x0e, 0x00, 0xc0, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x00, 0xc0, 0x01, 0x00, 0x38, 0x00, 0x00,
+  0x07, 0x00, 0x1c, 0x00, 0x80, 0x03, 0x00, 0x70, 0x00, 0xc0, 0x01, 0x00, 0x38, 0x00, 0x00, 0x07,
+  0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x07, 0xf8, 0xff, 0x03, 0xff, 0x7f, 0xe0, 0xff,
+  0x8f, 0x03, 0x00, 0x7e, 0x00, 0xc0, 0x0f, 0x00, 0xf8, 0x01, 0x00, 0x3f, 0x00, 0xe0, 0x07, 0x00,
+  0xfc, 0x00, 0x80, 0x1f, 0x00, 0xf0, 0x03, 0x00, 0x8e, 0xff, 0x3f, 0xf0, 0xff, 0x07, 0xfe, 0xff,
+  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x07, 0x0e, 0xe0, 0xc0, 0x01, 0x1c,
+  0x38, 0x80, 0x03, 0x07, 0x70, 0xe0, 0x00, 0x0e, 0x1c, 0xc0, 0x81, 0x03, 0x38, 0x70, 0x00, 0x07,
+  0x0e, 0x00, 0x3f, 0x00, 0xe0, 0x07, 0x00, 0xfc, 0x00, 0xf8, 0xff, 0x03, 0xff, 0x7f, 0xe0, 0xff,
+  0x8f, 0x03, 0x00, 0x7e, 0x00, 0xc0, 0x0f, 0x00, 0xf8, 0x0f, 0x00, 0xff, 0x01, 0xe0, 0x3f, 0x00,
+  0xfc, 0x00, 0x80, 0x1f, 0x00, 0xf0, 0x03, 0x00, 0x8e, 0xff, 0x3f, 0xf0, 0xff, 0x07, 0xfe, 0xff,
+  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xe0, 0x00, 0x0e, 0x1c, 0xc0, 0x81, 0x03,
+  0x38, 0x70, 0x00, 0x07, 0x0e, 0xe0, 0xc0, 0x01, 0x1c, 0x38, 0x80, 0x03, 0x07, 0x70, 0xe0, 0x00,
+  0xfe, 0xe3, 0x3f, 0x7e, 0xfc, 0xc7, 0x8f, 0xff, 0x00, 0x07, 0xf0, 0xe3, 0x00, 0x7e, 0x1c, 0xc0,
+  0x8f, 0x03, 0x07, 0x7e, 0xe0, 0xc0, 0x0f, 0x1c, 0xf8, 0x81, 0x03, 0x3f, 0x70, 0xe0, 0x07, 0x0e,
+  0xfc, 0xc0, 0x81, 0x1f, 0x38, 0xf0, 0x03, 0x07, 0x8e, 0x1f, 0xc0, 0xf1, 0x03, 0x38, 0x7e, 0x00,
+  0x07, 0x00, 0x00, 0x1c, 0x00, 0x80, 0x03, 0x00, 0x70, 0x00, 0x00, 0x0e, 0x00, 0xc0, 0x01, 0x00,
+  0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x80, 0x03, 0x00, 0x70, 0x00, 0x00,
+  0x0e, 0x00, 0xc0, 0x01, 0x00, 0x38, 0x00, 0x00, 0x07, 0xf8, 0xff, 0x1f, 0xff, 0xff, 0xe3, 0xff,
+  0xff, 0x03, 0x00, 0x70, 0x00, 0x00, 0x0e, 0x00, 0xc0, 0x01, 0x00, 0x38, 0x00, 0x00, 0x07, 0x00,
+  0xe0, 0x00, 0x00, 0x1c, 0x00, 0x80, 0x03, 0x00, 0x80, 0xff, 0xff, 0xf1, 0xff, 0x3f, 0xfe, 0xff,
+  0x07, 0xc0, 0xff, 0x1f, 0xf8, 0xff, 0x03, 0xff, 0x7f, 0x1c, 0x00, 0x80, 0x03, 0x00, 0x70, 0x00,
+  0xc0, 0x01, 0x00, 0x38, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0xe0, 0x00, 0x00, 0x1c, 0x00,
+  0x00, 0xfc, 0xff, 0x81, 0xff, 0x3f, 0xf0, 0xff, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x7f, 0x1c, 0x00, 0x80, 0x03, 0x00, 0x70, 0x00, 0x00, 0xf0, 0x03, 0x00, 0x7e, 0x00, 0xc0, 0x0f,
+  0x00, 0x07, 0x00, 0xe0, 0x00, 0x00, 0x1c, 0x00, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x07, 0x3f, 0x80, 0xff, 0x07, 0xf0, 0xff, 0x00, 0x7e, 0xc0, 0x31, 0x00, 0x38, 0x06, 0x00, 0xc7,
+  0x00, 0x00, 0x07, 0x00, 0xe0, 0x00, 0x00, 0x1c, 0x00, 0x70, 0x0c, 0x00, 0x8e, 0x01, 0xc0, 0x31,
+  0xf0, 0x03, 0xf8, 0x7f, 0x00, 0xff, 0x0f, 0xe0, 0x07, 0x00, 0xf0, 0x1f, 0x00, 0xfe, 0x03, 0xc0,
+  0x7f, 0x00, 0x07, 0x00, 0xe0, 0x00, 0x00, 0x1c, 0xc0, 0x7f, 0x00, 0xf8, 0x0f, 0x00, 0xff, 0x01,
+  0x00, 0xc0, 0x01, 0x00, 0x38, 0x00, 0x00, 0x07, 0x00, 0x00, 0xff, 0x01, 0xe0, 0x3f, 0x00, 0xfc,
+  0x07, 0x3f, 0x00, 0xfc, 0x07, 0x80, 0xff, 0x00, 0xf0, 0xe3, 0x00, 0x7e, 0x1c, 0xc0, 0x8f, 0x03,
+  0xf8, 0x81, 0x03, 0x3f, 0x70, 0xe0, 0x07, 0x0e, 0xfc, 0x00, 0x8e, 0x1f, 0xc0, 0xf1, 0x03, 0x38,
+  0x7e, 0x00, 0xf8, 0x0f, 0x00, 0xff, 0x01, 0xe0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x03, 0x00, 0x7e, 0x00, 0xc0, 0x0f, 0x00, 0xf8, 0x01, 0x00, 0x3f, 0x00, 0xe0, 0x07, 0x00,
+  0x1c, 0x00, 0x80, 0x1f, 0x00, 0xf0, 0x03, 0x00, 0x7e, 0x00, 0x38, 0x00, 0x00, 0x07, 0x00, 0xe0,
+  0x00, 0x80, 0x03, 0x00, 0x70, 0x00, 0x00, 0x0e, 0x00, 0x38, 0x00, 0x00, 0x07, 0x00, 0xe0, 0x00,
+  0xf0, 0x03, 0x00, 0x7e, 0x00, 0xc0, 0x0f, 0x00, 0x00, 0x07, 0x00, 0xfc, 0x00, 0x80, 0x1f, 0x00,
+  0xf0, 0x03, 0x00, 0x7e, 0x00, 0xc0, 0x0f, 0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x1f, 0x07, 0x0e, 0x1c, 0xc0, 0x81, 0x03, 0x07, 0x70, 0xe0, 0xc0, 0x71, 0xe0, 0xc0, 0x71, 0xe0,
+  0xc0, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x38, 0x8e, 0x1f, 0xc7, 0x01, 0x38, 0x70, 0x1c,
+  0x38, 0x0e, 0xfc, 0x38, 0x7e, 0x1c, 0x3f, 0x8e, 0x1f, 0xc7, 0x8f, 0xe3, 0xc7, 0xf1, 0xe3, 0xf8,
+  0x71, 0xfc, 0x38, 0xfe, 0xff, 0xf8, 0x7f, 0xfc, 0x3f, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x03, 0x38, 0x70, 0x00, 0x07, 0x0e, 0xe0, 0xc0, 0x01, 0x1c, 0x38, 0x80, 0x03, 0x07,
+  0x70, 0xe0, 0x00, 0x0e, 0x1c, 0xc0, 0x81, 0x03, 0x38, 0x80, 0xff, 0x00, 0xf0, 0x1f, 0x00, 0xfe,
+  0x03, 0x00, 0xf8, 0x0f, 0xfc, 0x07, 0xfe, 0xe3, 0x00, 0x7e, 0x00, 0x3f, 0x80, 0x1f, 0xc0, 0x0f,
+  0xe0, 0x07, 0xf0, 0x03, 0xf8, 0x01, 0xfc, 0x00, 0x7e, 0xe0, 0x38, 0x70, 0x1c, 0x38, 0x00, 0xf8,
+  0x0f, 0x00, 0xff, 0x01, 0xe0, 0x3f, 0x80, 0x03, 0x38, 0x70, 0x00, 0x07, 0x0e, 0xe0, 0xc0, 0x01,
+  0x1c, 0x38, 0x80, 0x03, 0x07, 0x70, 0xe0, 0x00, 0x0e, 0x1c, 0xc0, 0x81, 0x03, 0x38, 0xf0, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x07, 0xf8, 0x0f, 0xfc, 0x07, 0xfe, 0xe3, 0x38, 0x7e, 0x1c,
+  0x3f, 0x8e, 0x1f, 0xc7, 0x8f, 0xe3, 0xc7, 0xf1, 0xe3, 0xf8, 0x71, 0xfc, 0x38, 0x7e, 0xfc, 0x38,
+  0x7e, 0x1c, 0x3f, 0x00, 0x00, 0x0e, 0x00, 0xc0, 0x01, 0x00, 0x38, 0x80, 0xff, 0xff, 0xf1, 0xff,
+  0x3f, 0xfe, 0xff, 0x07, 0x80, 0x03, 0x07, 0x70, 0xe0, 0x00, 0x0e, 0x1c, 0xc0, 0x81, 0x03, 0x38,
+  0x70, 0x00, 0x07, 0x0e, 0x00, 0xc0, 0x01, 0x00, 0x38, 0x00, 0x00, 0x07, 0xf8, 0xf1, 0x03, 0x3f,
+  0x7e, 0xe0, 0xc7, 0x8f, 0x03, 0x3f, 0x7e, 0xe0, 0xc7, 0x0f, 0xfc, 0xf8, 0x71, 0x1c, 0x3f, 0x8e,
+  0xe3, 0xc7, 0x71, 0xfc, 0x38, 0xfe, 0x1f, 0xc7, 0xff, 0xe3, 0xf8, 0x8f, 0x1f, 0xc0, 0xf1, 0x03,
+  0x38, 0x7e, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x07, 0x00, 0xe0,
+  0x00, 0x00, 0x1c, 0x00, 0x00, 0x1c, 0x00, 0x80, 0x03, 0x00, 0x70, 0x00, 0x00, 0x0e, 0x00, 0xc0,
+  0x01, 0x00, 0x38, 0xf0, 0xff, 0x00, 0xfe, 0x1f, 0xc0, 0xff, 0x03, 0x00, 0x07, 0x70, 0xe0, 0x00,
+  0x0e, 0x1c, 0xc0, 0x81, 0xff, 0x3f, 0xfe, 0xff, 0xc7, 0xff, 0xff, 0xf8, 0x01, 0x00, 0x38, 0x00,
+  0x00, 0x07, 0x00, 0x00, 0x38, 0x00, 0x00, 0x07, 0x00, 0xe0, 0x00, 0x80, 0x03, 0x00, 0x70, 0x00,
+  0x00, 0x0e, 0x00, 0xc0, 0x01, 0x00, 0x38, 0x00, 0x00, 0x07, 0x00, 0x00, 0xff, 0x87, 0xe3, 0xff,
+  0x70, 0xfc, 0x1f, 0x0e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x07, 0x00, 0xe0,
+  0x00, 0x00, 0x1c, 0x00, 0x80, 0x03, 0x00, 0x70, 0x00, 0x00, 0x0e, 0x00, 0x38, 0x0e, 0x00, 0xc7,
+  0x01, 0xe0, 0x38, 0xf0, 0x03, 0x38, 0x7e, 0x00, 0xc7, 0x0f, 0xe0, 0x00, 0x07, 0x00, 0xfc, 0x00,
+  0x80, 0x1f, 0x00, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x38, 0x00,
+  0x00, 0x07, 0x00, 0x00, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0x0f, 0x00, 0x0e, 0x00, 0x07, 0x80, 0xff,
+  0x3f, 0xfe, 0x1f, 0xff, 0x0f, 0x00, 0x38, 0x00, 0x1c, 0x00, 0xfe, 0xff, 0xfb, 0xff, 0xfd, 0xff,
+  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xc0, 0x01, 0xe0, 0x00, 0x70, 0x00, 0xc0, 0x01, 0xe0,
+  0x00, 0x70, 0x00, 0x38, 0x00, 0x1c, 0x00, 0xfe, 0xff, 0xf8, 0x7f, 0xfc, 0x3f, 0x00, 0xf8, 0x0f,
+  0xfc, 0x07, 0xfe, 0xe3, 0x00, 0x7e, 0x00, 0x3f, 0x80, 0x1f, 0xc0, 0x0f, 0xe0, 0x07, 0xf0, 0x03,
+  0xf8, 0x01, 0xfc, 0x00, 0x8e, 0xff, 0xc0, 0x7f, 0xe0, 0x3f, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x71, 0xe0, 0xc7, 0x81, 0x1f, 0x07, 0x0e, 0x1c, 0x38, 0x70, 0xe0, 0xc0, 0x81, 0x03,
+  0x07, 0x0e, 0x1c, 0x38, 0x70, 0xe0, 0x00, 0x7e, 0x00, 0xf8, 0x01, 0xe0, 0x07, 0x00, 0x7e, 0x00,
+  0xf8, 0x01, 0xe0, 0x07, 0x70, 0xe0, 0xc0, 0x81, 0x03, 0x07, 0x0e, 0x1c, 0x38, 0x70, 0xe0, 0xc0,
+  0x81, 0x1f, 0x07, 0x7e, 0x1c, 0xf8, 0x71, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x07,
+  0x80, 0x03, 0xc0, 0x01, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x38, 0x0e, 0x1c, 0x07, 0x0e,
+  0x00, 0x38, 0x00, 0x1c, 0x00, 0x0e, 0xe0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x07, 0x8e, 0x03, 0xc7,
+  0x81, 0xe3, 0x38, 0x7e, 0x1c, 0x3f, 0x8e, 0x1f, 0xc7, 0x8f, 0xe3, 0xc7, 0xf1, 0xe3, 0xf8, 0x71,
+  0xfc, 0x38, 0x8e, 0x03, 0xc7, 0x81, 0xe3, 0xc0, 0x01, 0xf8, 0xff, 0x1f, 0xff, 0xff, 0xe3, 0xff,
+  0xff, 0x03, 0x38, 0x70, 0x00, 0x07, 0x0e, 0xe0, 0xc0, 0x01, 0x1c, 0x38, 0x80, 0x03, 0x07, 0x70,
+  0x00, 0x07, 0x00, 0xe0, 0x00, 0x00, 0x1c, 0x00, 0x00, 0xf8, 0x7f, 0xfc, 0x3f, 0xfe, 0xff, 0x00,
+  0x70, 0x00, 0x38, 0x00, 0x1c, 0x00, 0x0e, 0x00, 0x07, 0x00, 0x1c, 0x00, 0x0e, 0x00, 0x07, 0xf0,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xc0, 0x7f, 0xe0, 0x3f, 0xf0, 0x1f, 0x07, 0x80, 0x03, 0xc0,
+  0x01, 0x1c, 0x00, 0x0e, 0x00, 0x07, 0x00, 0x1c, 0x00, 0x0e, 0x00, 0x07, 0x00, 0xfc, 0x07, 0xfe,
+  0x03, 0xff, 0x01, 0xf8, 0x7f, 0xfc, 0x3f, 0xfe, 0xff, 0x00, 0x70, 0x00, 0x38, 0x00, 0xe0, 0x07,
+  0xf0, 0x03, 0xf8, 0x81, 0x03, 0xc0, 0x01, 0xe0, 0x00, 0x80, 0xff, 0xc7, 0xff, 0xe3, 0xff, 0x01,
+  0x07, 0xf0, 0x03, 0xf8, 0x01, 0x1c, 0xc7, 0x81, 0xe3, 0xc0, 0x71, 0x00, 0x07, 0x80, 0x03, 0xc0,
+  0x01, 0x1c, 0x07, 0x8e, 0x03, 0xc7, 0x71, 0x00, 0x3f, 0x80, 0x1f, 0xc0, 0x01, 0xc7, 0xff, 0x1f,
+  0xff, 0x7f, 0xfc, 0xff, 0x71, 0x00, 0xc7, 0x01, 0x1c, 0x07, 0x70, 0x1c, 0xc0, 0x71, 0x00, 0xc7,
+  0x01, 0x1c, 0x07, 0x70, 0x1c, 0xc0, 0x71, 0x00, 0xf8, 0xff, 0xe3, 0xff, 0x8f, 0xff, 0x3f, 0x07,
+  0xf0, 0x03, 0xf8, 0x01, 0xfc, 0x07, 0xfe, 0x03, 0xff, 0x81, 0x1f, 0xc7, 0x8f, 0xe3, 0xc7, 0xf1,
+  0x03, 0xff, 0x81, 0xff, 0xc0, 0x7f, 0x00, 0x3f, 0x80, 0x1f, 0xc0, 0x01, 0x00, 0x0e, 0x00, 0xc0,
+  0x01, 0x00, 0x38, 0x00, 0xfc, 0xf8, 0x81, 0x1f, 0x3f, 0xf0, 0xe3, 0xc7, 0x01, 0x00, 0x3f, 0x00,
+  0xe0, 0x07, 0x00, 0xfc, 0x00, 0x80, 0x1f, 0x00, 0xf0, 0x03, 0x00, 0x8e, 0x03, 0x38, 0x70, 0x00,
+  0x07, 0x0e, 0xe0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x38, 0x80, 0x03, 0x07,
+  0x70, 0xe0, 0x00, 0x8e, 0x03, 0x00, 0x7e, 0x00, 0xc0, 0x0f, 0x00, 0xf8, 0x01, 0x00, 0x3f, 0x00,
+  0xe0, 0x07, 0x00, 0x1c, 0x3f, 0x7e, 0xe0, 0xc7, 0x0f, 0xfc, 0xf8, 0x01, 0xe0, 0x00, 0x00, 0x1c,
+  0x00, 0x80, 0x03, 0x00, 0xc7, 0x71, 0xe0, 0x38, 0x7e, 0x1c, 0x07, 0x8e, 0xe3, 0x8c, 0x37, 0xcf,
+  0x1e, 0x03
+};
+
+const FontGlyph_TypeDef prop_15x21_glyphs[96] = {
+  {    0,  0,  0, 0,  0,  9}, // ' ' (32)
+  {    0,  3, 21, 0,  3,  6}, // '!' (33)
+  {    8,  9, 10, 0, 14, 12}, // '"' (34)
+  {   20, 15, 21, 0,  3, 18}, // '#' (35)
+  {   60, 15, 21, 0,  3, 18}, // '$' (36)
+  {  100, 15, 21, 0,  3, 18}, // '%' (37)
+  {  140, 15, 21, 0,  3, 18}, // '&' (38)
+  {  180,  3,  6, 0, 18,  6}, // "'" (39)
+  {  183,  6, 21, 0,  3,  9}, // '(' (40)
+  {  199,  6, 21, 0,  3,  9}, // ')' (41)
+  {  215,  9, 12, 0, 12, 12}, // '*' (42)
+  {  229, 15, 15, 0,  6, 18}, // '+' (43)
+  {  258,  6,  9, 0,  0,  9}, // ',' (44)
+  {  265, 12,  3, 0, 12, 15}, // '-' (45)
+  {  270,  3,  3, 0,  3,  6}, // '.' (46)
+  {  272, 15, 21, 0,  3, 18}, // '/' (47)
+  {  312, 15, 21, 0,  3, 18}, // '0' (48)
+  {  352,  9, 21, 0,  3, 12}, // '1' (49)
+  {  376, 15, 21, 0,  3, 18}, // '2' (50)
+  {  416, 15, 21, 0,  3, 18}, // '3' (51)
+  {  456, 15, 21, 0,  3, 18}, // '4' (52)
+  {  496, 15, 21, 0,  3, 18}, // '5' (53)
+  {  536, 15, 21, 0,  3, 18}, // '6' (54)
+  {  576, 15, 21, 0,  3, 18}, // '7' (55)
+  {  616, 15, 21, 0,  3, 18}, // '8' (56)
+  {  656, 15, 21, 0,  3, 18}, // '9' (57)
+  {  696,  3, 12, 0,  6,  6}, // ':' (58)
+  {  701,  6, 15, 0,  3,  9}, // ';' (59)
+  {  713,  9, 15, 0,  6, 12}, // '<' (60)
+  {  730, 12,  9, 0,  9, 15}, // '=' (61)
+  {  744,  9, 15, 0,  6, 12}, // '>' (62)
+  {  761, 15, 21, 0,  3, 18}, // '?' (63)
+  {  801, 15, 21, 0,  3, 18}, // '@' (64)
+  {  841, 15, 21, 0,  3, 18}, // 'A' (65)
+  {  881, 15, 21, 0,  3, 18}, // 'B' (66)
+  {  921, 15, 21, 0,  3, 18}, // 'C' (67)
+  {  961, 15, 21, 0,  3, 18}, // 'D' (68)
+  { 1001, 15, 21, 0,  3, 18}, // 'E' (69)
+  { 1041, 15, 21, 0,  3, 18}, // 'F' (70)
+  { 1081, 15, 21, 0,  3, 18}, // 'G' (71)
+  { 1121, 15, 21, 0,  3, 18}, // 'H' (72)
+  { 1161, 15, 21, 0,  3, 18}, // 'I' (73)
+  { 1201, 15, 21, 0,  3, 18}, // 'J' (74)
+  { 1241, 15, 21, 0,  3, 18}, // 'K' (75)
+  { 1281, 15, 21, 0,  3, 18}, // 'L' (76)
+  { 1321, 15, 21, 0,  3, 18}, // 'M' (77)
+  { 1361, 15, 21, 0,  3, 18}, // 'N' (78)
+  { 1401, 15, 21, 0,  3, 18}, // 'O' (79)
+  { 1441, 15, 21, 0,  3, 18}, // 'P' (80)
+  { 1481, 15, 21, 0,  3, 18}, // 'Q' (81)
+  { 1521, 15, 21, 0,  3, 18}, // 'R' (82)
+  { 1561, 15, 21, 0,  3, 18}, // 'S' (83)
+  { 1601, 15, 21, 0,  3, 18}, // 'T' (84)
+  { 1641, 15, 21, 0,  3, 18}, // 'U' (85)
+  { 1681, 15, 21, 0,  3, 18}, // 'V' (86)
+  { 1721, 15, 21, 0,  3, 18}, // 'W' (87)
+  { 1761, 15, 21, 0,  3, 18}, // 'X' (88)
+  { 1801, 15, 21, 0,  3, 18}, // 'Y' (89)
+  { 1841, 15, 21, 0,  3, 18}, // 'Z' (90)
+  { 1881,  9, 21, 0,  3, 12}, // '[' (91)
+  { 1905, 15, 21, 0,  3, 18}, // '\\' (92)
+  { 1945,  9, 21, 0,  3, 12}, // ']' (93)
+  { 1969, 15,  9, 0, 15, 18}, // '^' (94)
+  { 1986, 15,  3, 0,  3, 18}, // '_' (95)
+  { 1992,  6,  6, 0, 18,  9}, // '`' (96)
+  { 1997, 15, 15, 0,  3, 18}, // 'a' (97)
+  { 2026, 15, 21, 0,  3, 18}, // 'b' (98)
+  { 2066, 15, 15, 0,  3, 18}, // 'c' (99)
+  { 2095, 15, 21, 0,  3, 18}, // 'd' (100)
+  { 2135, 15, 15, 0,  3, 18}, // 'e' (101)
+  { 2164, 15, 21, 0,  3, 18}, // 'f' (102)
+  { 2204, 15, 21, 0,  3, 18}, // 'g' (103)
+  { 2244, 15, 21, 0,  3, 18}, // 'h' (104)
+  { 2284,  9, 21, 0,  3, 12}, // 'i' (105)
+  { 2308, 12, 21, 0,  3, 15}, // 'j' (106)
+  { 2340, 15, 21, 0,  3, 18}, // 'k' (107)
+  { 2380,  9, 21, 0,  3, 12}, // 'l' (108)
+  { 2404, 15, 15, 0,  3, 18}, // 'm' (109)
+  { 2433, 15, 15, 0,  3, 18}, // 'n' (110)
+  { 2462, 15, 15, 0,  3, 18}, // 'o' (111)
+  { 2491, 15, 18, 0,  3, 18}, // 'p' (112)
+  { 2525, 15, 18, 0,  3, 18}, // 'q' (113)
+  { 2559, 15, 15, 0,  3, 18}, // 'r' (114)
+  { 2588, 15, 15, 0,  3, 18}, // 's' (115)
+  { 2617, 12, 21, 0,  3, 15}, // 't' (116)
+  { 2649, 15, 15, 0,  3, 18}, // 'u' (117)
+  { 2678, 15, 15, 0,  3, 18}, // 'v' (118)
+  { 2707, 15, 15, 0,  3, 18}, // 'w' (119)
+  { 2736, 15, 15, 0,  3, 18}, // 'x' (120)
+  { 2765, 15, 18, 0,  3, 18}, // 'y' (121)
+  { 2799, 15, 15, 0,  3, 18}, // 'z' (122)
+  { 2828, 15, 21, 0,  3, 18}, // '{' (123)
+  { 2868,  3, 21, 0,  3,  6}, // '|' (124)
+  { 2876, 15, 21, 0,  3, 18}, // '}' (125)
+  { 2916, 12,  6, 0, 12, 15}, // '~' (126)
+  { 2925,  6,  6, 0, 17,  9}  // '°' (176)
+};
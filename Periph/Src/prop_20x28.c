@@ -0,0 +1,429 @@
+/*
+ * Filename: prop_20x28.c
+ * Description: font_dot_20x28 cut down to the inked glyph boxes, 5103 bytes.
+ *              Generated by Tools/propfont.py, do not edit.
+ */
+
+#include "propfont.h"
+
+
+const uint8_t prop_20x28_bitmap[5103] = {
+  0x0f, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x00, 0x0f, 0xf0, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x0f, 0xf0, 0x00, 0xf0, 0x00, 0x0f, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x0f, 0xf0, 0x00,
+  0xf0, 0x00, 0x0f, 0x00, 0x0f, 0xf0, 0x00, 0xf0, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x0f, 0xf0, 0x00, 0xf0, 0x00, 0x0f, 0x00,
+  0x0f, 0xf0, 0x00, 0xf0, 0x00, 0x0f, 0xf0, 0x00, 0x0f, 0x00, 0x0f, 0xf0, 0x00, 0xf0, 0x00, 0x0f,
+  0x00, 0x0f, 0xf0, 0x00, 0xf0, 0xf0, 0xf0, 0x00, 0x0f, 0x0f, 0x0f, 0xf0, 0xf0, 0xf0, 0x00, 0x0f,
+  0x0f, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xf0, 0xf0, 0xf0, 0x00, 0x0f, 0x0f, 0x0f, 0xf0, 0xf0, 0xf0, 0x00, 0x0f, 0x0f, 0x0f, 0x00, 0x0f,
+  0xf0, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x0f, 0xf0, 0x00, 0xf0, 0x00, 0x0f, 0xff, 0x00, 0xff, 0xff,
+  0x0f, 0xf0, 0xff, 0xff, 0x00, 0xff, 0xff, 0x0f, 0xf0, 0xff, 0x00, 0x0f, 0x0f, 0x0f, 0xf0, 0xf0,
+  0xf0, 0x00, 0x0f, 0x0f, 0x0f, 0xf0, 0xf0, 0xf0, 0xff, 0xf0, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff,
+  0xf0, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x0f, 0x0f, 0x0f, 0xf0, 0xf0, 0xf0, 0x00, 0x0f, 0x0f, 0x0f,
+  0xf0, 0xf0, 0xf0, 0x00, 0xff, 0x0f, 0xf0, 0xff, 0xff, 0x00, 0xff, 0xff, 0x0f, 0xf0, 0xff, 0xff,
+  0x00, 0xff, 0xf0, 0x0f, 0xff, 0x00, 0xff, 0xf0, 0x0f, 0xf0, 0x0f, 0xff, 0x00, 0xff, 0xf0, 0x0f,
+  0x0f, 0xf0, 0x00, 0xff, 0x00, 0x0f, 0xf0, 0x0f, 0xf0, 0x00, 0xff, 0x00, 0x0f, 0xf0, 0x0f, 0xf0,
+  0x00, 0xff, 0x00, 0x0f, 0xf0, 0x0f, 0xf0, 0x00, 0xff, 0x00, 0x0f, 0xf0, 0xf0, 0xff, 0xff, 0x00,
+  0xff, 0xff, 0x0f, 0xf0, 0xff, 0xff, 0x00, 0xff, 0xff, 0x0f, 0x0f, 0xf0, 0x00, 0xf0, 0x00, 0x0f,
+  0x00, 0x0f, 0xf0, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0x00,
+  0xff, 0xff, 0x0f, 0xf0, 0xff, 0xff, 0x00, 0xff, 0xff, 0x0f, 0x0f, 0x00, 0x00, 0xff, 0x00, 0x00,
+  0xf0, 0x0f, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf0, 0x0f,
+  0x00, 0x00, 0xff, 0x00, 0x00, 0xf0, 0xf0, 0xff, 0xff, 0x00, 0xff, 0xff, 0x0f, 0xf0, 0xff, 0xff,
+  0x00, 0xff, 0xff, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0xf0, 0xff, 0xf0, 0xff,
+  0xf0, 0xff, 0xf0, 0xff, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x0f, 0x00, 0xf0,
+  0x00, 0x00, 0x0f, 0x00, 0xf0, 0x00, 0x00, 0x0f, 0x00, 0xf0, 0x00, 0x00, 0x0f, 0x00, 0xf0, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x0f, 0x00, 0xf0, 0x00, 0x00,
+  0x0f, 0x00, 0xf0, 0x00, 0x00, 0x0f, 0x00, 0xf0, 0x00, 0x00, 0x0f, 0x00, 0xf0, 0x00, 0x0f, 0xff,
+  0xf0, 0x0f, 0xff, 0xf0, 0xf0, 0x0f, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00,
+  0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0xf0,
+  0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x00, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00,
+  0xff, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0xff, 0xf0, 0xff, 0xff, 0x00, 0xff, 0xff, 0x0f, 0xf0,
+  0xff, 0xff, 0x00, 0xff, 0xff, 0x0f, 0x0f, 0x0f, 0x00, 0xff, 0xf0, 0x00, 0xf0, 0x0f, 0x0f, 0x00,
+  0xff, 0xf0, 0x00, 0xf0, 0x0f, 0xf0, 0x00, 0xff, 0x00, 0x0f, 0xf0, 0x0f, 0xf0, 0x00, 0xff, 0x00,
+  0x0f, 0xf0, 0x0f, 0x00, 0x0f, 0xff, 0x00, 0xf0, 0xf0, 0x0f, 0x00, 0x0f, 0xff, 0x00, 0xf0, 0xf0,
+  0xf0, 0xff, 0xff, 0x00, 0xff, 0xff, 0x0f, 0xf0, 0xff, 0xff, 0x00, 0xff, 0xff, 0x0f, 0x0f, 0x00,
+  0x00, 0xff, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf0, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x00,
+  0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0xff, 0x0f, 0xf0, 0xf0, 0xff, 0x00, 0x0f, 0xff,
+  0x0f, 0xf0, 0xf0, 0xff, 0x00, 0x0f, 0x0f, 0xf0, 0x00, 0xff, 0x00, 0x0f, 0xf0, 0x0f, 0xf0, 0x00,
+  0xff, 0x00, 0x0f, 0xf0, 0x0f, 0xf0, 0x00, 0xff, 0x00, 0x0f, 0xf0, 0x0f, 0xf0, 0x00, 0xff, 0x00,
+  0x0f, 0xf0, 0x0f, 0xf0, 0x00, 0xff, 0x00, 0x0f, 0xf0, 0x0f, 0xf0, 0x00, 0xff, 0x00, 0x0f, 0xf0,
+  0x0f, 0x00, 0xff, 0xf0, 0x00, 0xf0, 0x0f, 0x0f, 0x00, 0xff, 0xf0, 0x00, 0xf0, 0x0f, 0xf0, 0x00,
+  0xf0, 0x00, 0x0f, 0x00, 0x0f, 0xf0, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x0f, 0x0f, 0x00, 0x00, 0xff,
+  0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf0, 0x0f, 0xf0, 0x00, 0xff, 0x00, 0x0f,
+  0xf0, 0x0f, 0xf0, 0x00, 0xff, 0x00, 0x0f, 0xf0, 0x0f, 0xf0, 0x00, 0xff, 0x00, 0x0f, 0xf0, 0x0f,
+  0xf0, 0x00, 0xff, 0x00, 0x0f, 0xf0, 0xf0, 0x0f, 0xff, 0x00, 0xff, 0xf0, 0x0f, 0xf0, 0x0f, 0xff,
+  0x00, 0xff, 0xf0, 0x0f, 0x00, 0xf0, 0xff, 0x0f, 0x00, 0xff, 0xff, 0x00, 0xf0, 0xff, 0x0f, 0x00,
+  0xff, 0xff, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x00, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x00, 0x00,
+  0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x0f, 0xf0, 0xff, 0xff, 0x00, 0xff,
+  0xff, 0x0f, 0xf0, 0xff, 0xff, 0x00, 0xff, 0xff, 0x0f, 0xf0, 0x00, 0xff, 0x00, 0x0f, 0xf0, 0x0f,
+  0xf0, 0x00, 0xff, 0x00, 0x0f, 0xf0, 0x0f, 0xf0, 0x00, 0xff, 0x00, 0x0f, 0xf0, 0x0f, 0xf0, 0x00,
+  0xff, 0x00, 0x0f, 0xf0, 0x0f, 0xf0, 0x00, 0xff, 0x00, 0x0f, 0xf0, 0x0f, 0xf0, 0x00, 0xff, 0x00,
+  0x0f, 0xf0, 0xf0, 0x0f, 0x00, 0x0f, 0xff, 0x00, 0xf0, 0xf0, 0x0f, 0x00, 0x0f, 0xff, 0x00, 0xf0,
+  0xf0, 0xff, 0xff, 0x00, 0xff, 0xff, 0x0f, 0xf0, 0xff, 0xff, 0x00, 0xff, 0xff, 0x0f, 0x0f, 0xf0,
+  0x00, 0xff, 0x00, 0x0f, 0xf0, 0x0f, 0xf0, 0x00, 0xff, 0x00, 0x0f, 0xf0, 0x0f, 0xf0, 0x00, 0xff,
+  0x00, 0x0f, 0xf0, 0x0f, 0xf0, 0x00, 0xff, 0x00, 0x0f, 0xf0, 0x0f, 0xf0, 0x00, 0xff, 0x00, 0x0f,
+  0xf0, 0x0f, 0xf0, 0x00, 0xff, 0x00, 0x0f, 0xf0, 0xf0, 0x0f, 0x00, 0x0f, 0xff, 0x00, 0xf0, 0xf0,
+  0x0f, 0x00, 0x0f, 0xff, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0xf0, 0xff, 0x0f, 0x00, 0xff, 0xff, 0x00, 0xf0, 0xff, 0x0f, 0x00, 0xff, 0xff,
+  0x00, 0xf0, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x0f, 0xf0, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x0f, 0xf0,
+  0x00, 0xf0, 0x00, 0x0f, 0x00, 0x0f, 0xf0, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x0f, 0xf0, 0x00, 0x00,
+  0xff, 0x0f, 0x00, 0xf0, 0xff, 0x00, 0x00, 0xff, 0x0f, 0x00, 0xf0, 0xff, 0xf0, 0x0f, 0xff, 0x00,
+  0xff, 0xf0, 0x0f, 0xf0, 0x0f, 0xff, 0x00, 0xff, 0xf0, 0x0f, 0x0f, 0xf0, 0x00, 0xff, 0x00, 0x0f,
+  0xf0, 0x0f, 0xf0, 0x00, 0xff, 0x00, 0x0f, 0xf0, 0x0f, 0xf0, 0x00, 0xff, 0x00, 0x0f, 0xf0, 0x0f,
+  0xf0, 0x00, 0xff, 0x00, 0x0f, 0xf0, 0x0f, 0xf0, 0x00, 0xff, 0x00, 0x0f, 0xf0, 0x0f, 0xf0, 0x00,
+  0xff, 0x00, 0x0f, 0xf0, 0xf0, 0x0f, 0xff, 0x00, 0xff, 0xf0, 0x0f, 0xf0, 0x0f, 0xff, 0x00, 0xff,
+  0xf0, 0x0f, 0xf0, 0x00, 0xff, 0x00, 0x0f, 0xf0, 0x0f, 0xf0, 0x00, 0xff, 0x00, 0x0f, 0xf0, 0x0f,
+  0x0f, 0xf0, 0x00, 0xff, 0x00, 0x0f, 0xf0, 0x0f, 0xf0, 0x00, 0xff, 0x00, 0x0f, 0xf0, 0x0f, 0xf0,
+  0x00, 0xff, 0x00, 0x0f, 0xf0, 0x0f, 0xf0, 0x00, 0xff, 0x00, 0x0f, 0xf0, 0x0f, 0xf0, 0x00, 0xff,
+  0x00, 0x0f, 0xf0, 0x0f, 0xf0, 0x00, 0xff, 0x00, 0x0f, 0xf0, 0xf0, 0xff, 0xff, 0x00, 0xff, 0xff,
+  0x0f, 0xf0, 0xff, 0xff, 0x00, 0xff, 0xff, 0x0f, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0,
+  0x0f, 0x00, 0xf0, 0x00, 0x00, 0x0f, 0x00, 0xf0, 0x00, 0x00, 0xff, 0x00, 0xff, 0x0f, 0xf0, 0xff,
+  0x00, 0xff, 0x0f, 0xf0, 0x00, 0x0f, 0x00, 0xf0, 0x00, 0x00, 0x0f, 0x00, 0xf0, 0x00, 0xf0, 0xf0,
+  0x00, 0x0f, 0x0f, 0xf0, 0xf0, 0x00, 0x0f, 0x0f, 0x0f, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0x00, 0xff,
+  0x00, 0xf0, 0x0f, 0xff, 0xf0, 0x0f, 0xff, 0xf0, 0x0f, 0xff, 0xf0, 0x0f, 0xff, 0xf0, 0x0f, 0xff,
+  0xf0, 0x0f, 0xff, 0xf0, 0x0f, 0xff, 0xf0, 0x0f, 0xff, 0xf0, 0x0f, 0x00, 0xff, 0x00, 0xf0, 0x0f,
+  0x00, 0xff, 0x00, 0xf0, 0xf0, 0xf0, 0x00, 0x0f, 0x0f, 0xf0, 0xf0, 0x00, 0x0f, 0x0f, 0x00, 0x0f,
+  0x00, 0xf0, 0x00, 0x00, 0x0f, 0x00, 0xf0, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x00, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0xf0, 0x0f, 0xff, 0x00, 0xff, 0xf0, 0x0f, 0xf0, 0x0f, 0xff, 0x00, 0xff, 0xf0,
+  0x0f, 0xf0, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x0f, 0xf0, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x0f, 0xf0,
+  0x00, 0x00, 0xff, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf0, 0x0f, 0xff, 0x00,
+  0xf0, 0xf0, 0x0f, 0x00, 0x0f, 0xff, 0x00, 0xf0, 0xf0, 0x0f, 0x00, 0x0f, 0x0f, 0xf0, 0x00, 0xff,
+  0x00, 0x0f, 0xf0, 0x0f, 0xf0, 0x00, 0xff, 0x00, 0x0f, 0xf0, 0x0f, 0x0f, 0x0f, 0xff, 0xf0, 0xf0,
+  0xf0, 0x0f, 0x0f, 0x0f, 0xff, 0xf0, 0xf0, 0xf0, 0x0f, 0x0f, 0x0f, 0xff, 0xf0, 0xf0, 0xf0, 0x0f,
+  0x0f, 0x0f, 0xff, 0xf0, 0xf0, 0xf0, 0xf0, 0xff, 0xff, 0x00, 0xff, 0xff, 0x0f, 0xf0, 0xff, 0xff,
+  0x00, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xf0, 0xff,
+  0xff, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0xf0, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x0f, 0xf0, 0x00, 0xf0,
+  0x00, 0x0f, 0x00, 0x0f, 0xf0, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x0f, 0xf0, 0x00, 0xf0, 0x00, 0x0f,
+  0x00, 0x0f, 0xf0, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x0f, 0xf0, 0x00, 0xf0, 0xff, 0xff, 0xff, 0xf0,
+  0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xf0, 0x00, 0xff, 0x00, 0x0f, 0xf0, 0x0f,
+  0xf0, 0x00, 0xff, 0x00, 0x0f, 0xf0, 0x0f, 0xf0, 0x00, 0xff, 0x00, 0x0f, 0xf0, 0x0f, 0xf0, 0x00,
+  0xff, 0x00, 0x0f, 0xf0, 0x0f, 0xf0, 0x00, 0xff, 0x00, 0x0f, 0xf0, 0x0f, 0xf0, 0x00, 0xff, 0x00,
+  0x0f, 0xf0, 0xf0, 0x0f, 0xff, 0x00, 0xff, 0xf0, 0x0f, 0xf0, 0x0f, 0xff, 0x00, 0xff, 0xf0, 0x0f,
+  0xf0, 0xff, 0xff, 0x00, 0xff, 0xff, 0x0f, 0xf0, 0xff, 0xff, 0x00, 0xff, 0xff, 0x0f, 0x0f, 0x00,
+  0x00, 0xff, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0xff,
+  0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0xff, 0x00, 0x00,
+  0xf0, 0x0f, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf0, 0xf0, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x0f, 0xf0,
+  0x00, 0xf0, 0x00, 0x0f, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0xff, 0x00,
+  0x00, 0xf0, 0x0f, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf0,
+  0x0f, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf0, 0xf0, 0xff,
+  0xff, 0x00, 0xff, 0xff, 0x0f, 0xf0, 0xff, 0xff, 0x00, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xf0, 0x00, 0xff, 0x00, 0x0f,
+  0xf0, 0x0f, 0xf0, 0x00, 0xff, 0x00, 0x0f, 0xf0, 0x0f, 0xf0, 0x00, 0xff, 0x00, 0x0f, 0xf0, 0x0f,
+  0xf0, 0x00, 0xff, 0x00, 0x0f, 0xf0, 0x0f, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00,
+  0xff, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0xff, 0x00,
+  0x00, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x00, 0xf0, 0x00, 0x0f, 0x00, 0x0f, 0xf0, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x0f, 0xf0, 0x00, 0xf0,
+  0x00, 0x0f, 0x00, 0x0f, 0xf0, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x00, 0x0f,
+  0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00,
+  0xf0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0xf0, 0xff, 0xff, 0x00, 0xff, 0xff, 0x0f, 0xf0,
+  0xff, 0xff, 0x00, 0xff, 0xff, 0x0f, 0x0f, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00,
+  0xff, 0x00, 0x00, 0xf0, 0x0f, 0xf0, 0x00, 0xff, 0x00, 0x0f, 0xf0, 0x0f, 0xf0, 0x00, 0xff, 0x00,
+  0x0f, 0xf0, 0x0f, 0xf0, 0x00, 0xff, 0x00, 0x0f, 0xf0, 0x0f, 0xf0, 0x00, 0xff, 0x00, 0x0f, 0xf0,
+  0xf0, 0xff, 0xf0, 0x00, 0xff, 0x0f, 0x0f, 0xf0, 0xff, 0xf0, 0x00, 0xff, 0x0f, 0x0f, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x00, 0x00,
+  0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x0f,
+  0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00,
+  0xf0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0xff, 0x00,
+  0x00, 0xf0, 0x0f, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf0,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x00,
+  0x00, 0xff, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0xff,
+  0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf0, 0xf0, 0x00, 0x00, 0x0f, 0x0f, 0x00,
+  0xf0, 0xf0, 0x00, 0x00, 0x0f, 0x0f, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf0, 0x0f,
+  0x00, 0x00, 0xff, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00,
+  0xff, 0x00, 0x00, 0xf0, 0xf0, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0x0f, 0xff,
+  0xff, 0xff, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xf0,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xf0,
+  0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x00,
+  0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x0f, 0x0f, 0x00, 0xf0, 0xf0,
+  0x00, 0x00, 0x0f, 0x0f, 0x00, 0xf0, 0xf0, 0x00, 0xff, 0x00, 0xf0, 0xff, 0x0f, 0x00, 0xff, 0xff,
+  0x00, 0xf0, 0xff, 0x0f, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x00, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0xff, 0x00, 0x00,
+  0xf0, 0x0f, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xf0,
+  0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00,
+  0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0x00, 0xff, 0xff, 0x0f, 0xf0,
+  0xff, 0xff, 0x00, 0xff, 0xff, 0x0f, 0x0f, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00,
+  0xff, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0xff, 0x00,
+  0x00, 0xf0, 0x0f, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf0,
+  0xf0, 0xff, 0xff, 0x00, 0xff, 0xff, 0x0f, 0xf0, 0xff, 0xff, 0x00, 0xff, 0xff, 0x0f, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x00, 0x0f,
+  0x00, 0x0f, 0xf0, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x0f, 0xf0, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x0f,
+  0xf0, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x0f, 0xf0, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x0f, 0xf0, 0x00,
+  0xf0, 0x00, 0x0f, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0xff,
+  0x00, 0x00, 0xf0, 0x0f, 0xf0, 0xff, 0xff, 0x00, 0xff, 0xff, 0x0f, 0xf0, 0xff, 0xff, 0x00, 0xff,
+  0xff, 0x0f, 0x0f, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf0,
+  0xff, 0x00, 0x00, 0xff, 0x0f, 0x00, 0xf0, 0xff, 0x00, 0x00, 0xff, 0x0f, 0x00, 0xf0, 0x0f, 0x00,
+  0x00, 0xff, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf0, 0xf0, 0xff, 0xff, 0x00,
+  0xff, 0xff, 0x0f, 0xf0, 0xff, 0xff, 0x00, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x0f, 0x00, 0x0f, 0xf0, 0x00, 0xf0, 0x00,
+  0x0f, 0x00, 0x0f, 0xf0, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x0f, 0xf0, 0x00, 0xf0, 0x00, 0x0f, 0x00,
+  0x0f, 0xf0, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x0f, 0xf0, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x0f, 0xf0,
+  0x00, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0x0f, 0xff, 0x0f, 0xff, 0xf0, 0xff, 0xf0, 0x0f, 0xff, 0x0f,
+  0x0f, 0x00, 0xff, 0xf0, 0x00, 0xf0, 0x0f, 0x0f, 0x00, 0xff, 0xf0, 0x00, 0xf0, 0x0f, 0x0f, 0xf0,
+  0x00, 0xff, 0x00, 0x0f, 0xf0, 0x0f, 0xf0, 0x00, 0xff, 0x00, 0x0f, 0xf0, 0x0f, 0xf0, 0x00, 0xff,
+  0x00, 0x0f, 0xf0, 0x0f, 0xf0, 0x00, 0xff, 0x00, 0x0f, 0xf0, 0x0f, 0xf0, 0x00, 0xff, 0x00, 0x0f,
+  0xf0, 0x0f, 0xf0, 0x00, 0xff, 0x00, 0x0f, 0xf0, 0xf0, 0x0f, 0x00, 0x0f, 0xff, 0x00, 0xf0, 0xf0,
+  0x0f, 0x00, 0x0f, 0xff, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x00, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x00,
+  0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0xf0, 0xff, 0xff, 0x0f,
+  0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x00,
+  0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x0f,
+  0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00,
+  0xf0, 0x00, 0x00, 0x00, 0xf0, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0x0f, 0xff,
+  0xff, 0xff, 0x00, 0xff, 0xff, 0x0f, 0xf0, 0xff, 0xff, 0x00, 0xff, 0xff, 0x0f, 0xf0, 0xff, 0xff,
+  0xf0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x0f, 0x00,
+  0x00, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0xff, 0xff, 0x0f, 0xf0, 0xff,
+  0xff, 0x00, 0xff, 0xff, 0x0f, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x00,
+  0x00, 0x0f, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf0,
+  0x0f, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,
+  0xf0, 0xff, 0x0f, 0x00, 0xff, 0xff, 0x00, 0xf0, 0xff, 0x0f, 0x00, 0xff, 0x00, 0x0f, 0x0f, 0x00,
+  0xf0, 0xf0, 0x00, 0x00, 0x0f, 0x0f, 0x00, 0xf0, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x0f,
+  0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x0f, 0x0f, 0x00, 0xf0, 0xf0, 0x00, 0x00,
+  0x0f, 0x0f, 0x00, 0xf0, 0xf0, 0x00, 0xff, 0x00, 0xf0, 0xff, 0x0f, 0x00, 0xff, 0xff, 0x00, 0xf0,
+  0xff, 0x0f, 0x00, 0xff, 0x00, 0x00, 0xff, 0x0f, 0x00, 0xf0, 0xff, 0x00, 0x00, 0xff, 0x0f, 0x00,
+  0xf0, 0xff, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0xff, 0x0f, 0x00, 0xf0, 0xff, 0x00, 0x00, 0xff, 0x0f, 0x00, 0xf0, 0xff, 0x00, 0x00, 0x00, 0xf0,
+  0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0xff, 0x0f,
+  0x00, 0xf0, 0xff, 0x00, 0x00, 0xff, 0x0f, 0x00, 0xf0, 0xff, 0xff, 0x00, 0x00, 0xff, 0x0f, 0x00,
+  0xf0, 0xff, 0x00, 0x00, 0xff, 0x0f, 0x00, 0xf0, 0x0f, 0x0f, 0x00, 0xff, 0xf0, 0x00, 0xf0, 0x0f,
+  0x0f, 0x00, 0xff, 0xf0, 0x00, 0xf0, 0x0f, 0xf0, 0x00, 0xff, 0x00, 0x0f, 0xf0, 0x0f, 0xf0, 0x00,
+  0xff, 0x00, 0x0f, 0xf0, 0x0f, 0x00, 0x0f, 0xff, 0x00, 0xf0, 0xf0, 0x0f, 0x00, 0x0f, 0xff, 0x00,
+  0xf0, 0xf0, 0x0f, 0x00, 0xf0, 0xff, 0x00, 0x00, 0xff, 0x0f, 0x00, 0xf0, 0xff, 0x00, 0x00, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x00,
+  0x00, 0xff, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0xff,
+  0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00,
+  0xff, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0xff, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x00,
+  0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xf0,
+  0x00, 0x00, 0xff, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf0, 0x0f, 0x00,
+  0x00, 0xff, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf0, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xf0, 0x00, 0x0f, 0xf0, 0x00,
+  0xf0, 0x00, 0x0f, 0xf0, 0x00, 0x0f, 0x00, 0x0f, 0xf0, 0x00, 0x0f, 0xf0, 0xf0, 0x00, 0x0f, 0xf0,
+  0x00, 0x0f, 0x0f, 0xf0, 0x00, 0x0f, 0xf0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xf0, 0xf0, 0xf0, 0xf0, 0x0f, 0x0f, 0x0f, 0x0f, 0xf0, 0x00, 0x0f, 0x0f, 0xf0, 0xf0,
+  0x00, 0x0f, 0x0f, 0xf0, 0x0f, 0x0f, 0xff, 0xf0, 0xf0, 0x0f, 0x0f, 0xff, 0xf0, 0xf0, 0x0f, 0x0f,
+  0xff, 0xf0, 0xf0, 0x0f, 0x0f, 0xff, 0xf0, 0xf0, 0x0f, 0x0f, 0xff, 0xf0, 0xf0, 0x0f, 0x0f, 0xff,
+  0xf0, 0xf0, 0xff, 0xff, 0xf0, 0xff, 0x0f, 0xff, 0xff, 0xf0, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x0f, 0xf0, 0x00, 0xf0,
+  0x00, 0x0f, 0x00, 0x0f, 0xf0, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x0f, 0xf0, 0x00, 0xf0, 0x00, 0x0f,
+  0x00, 0x0f, 0xf0, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x0f, 0xf0, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x0f,
+  0xf0, 0x00, 0xf0, 0x00, 0xf0, 0xff, 0x00, 0x00, 0xff, 0x0f, 0x00, 0xf0, 0xff, 0x00, 0x00, 0xff,
+  0x0f, 0x00, 0xf0, 0xff, 0x00, 0xff, 0x0f, 0xf0, 0xff, 0x00, 0xff, 0x0f, 0x0f, 0x00, 0xff, 0x00,
+  0xf0, 0x0f, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0x00, 0xff, 0x00, 0xf0,
+  0x0f, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0xf0, 0xf0, 0x00, 0x0f, 0x0f,
+  0xf0, 0xf0, 0x00, 0x0f, 0xf0, 0xff, 0x00, 0x00, 0xff, 0x0f, 0x00, 0xf0, 0xff, 0x00, 0x00, 0xff,
+  0x0f, 0x00, 0x0f, 0x00, 0x0f, 0xf0, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x0f, 0xf0, 0x00, 0xf0, 0x00,
+  0x0f, 0x00, 0x0f, 0xf0, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x0f, 0xf0, 0x00, 0xf0, 0x00, 0x0f, 0x00,
+  0x0f, 0xf0, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x0f, 0xf0, 0x00, 0xf0, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0x00, 0xff, 0x0f, 0xf0,
+  0xff, 0x00, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0xf0, 0xf0, 0x0f, 0x0f, 0xff, 0xf0, 0xf0, 0x0f, 0x0f,
+  0xff, 0xf0, 0xf0, 0x0f, 0x0f, 0xff, 0xf0, 0xf0, 0x0f, 0x0f, 0xff, 0xf0, 0xf0, 0x0f, 0x0f, 0xff,
+  0xf0, 0xf0, 0x0f, 0xff, 0xf0, 0xf0, 0x0f, 0x0f, 0xff, 0xf0, 0xf0, 0x0f, 0x00, 0xf0, 0x00, 0x00,
+  0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff,
+  0x0f, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0x0f, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x0f, 0xf0, 0x00,
+  0xf0, 0x00, 0x0f, 0x00, 0x0f, 0xf0, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x0f, 0xf0, 0x00, 0xf0, 0x00,
+  0x0f, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x00,
+  0x00, 0xf0, 0xf0, 0x0f, 0xff, 0x00, 0xff, 0xf0, 0x0f, 0xf0, 0x0f, 0xff, 0x00, 0xff, 0xf0, 0x0f,
+  0x0f, 0xf0, 0x0f, 0xff, 0x00, 0xff, 0xf0, 0x0f, 0xf0, 0x0f, 0xff, 0x00, 0xff, 0xf0, 0x0f, 0x0f,
+  0x0f, 0xff, 0xf0, 0xf0, 0xf0, 0x0f, 0x0f, 0x0f, 0xff, 0xf0, 0xf0, 0xf0, 0x0f, 0x0f, 0xff, 0xff,
+  0xf0, 0xf0, 0xff, 0x0f, 0x0f, 0xff, 0xff, 0xf0, 0xf0, 0xff, 0xf0, 0x0f, 0x00, 0x0f, 0xff, 0x00,
+  0xf0, 0xf0, 0x0f, 0x00, 0x0f, 0xff, 0x00, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00,
+  0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00,
+  0xf0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00,
+  0xff, 0xff, 0x00, 0xf0, 0xff, 0x0f, 0x00, 0xff, 0xff, 0x00, 0xf0, 0xff, 0x0f, 0x00, 0x0f, 0x00,
+  0x0f, 0xf0, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x0f, 0xf0, 0x00, 0xf0, 0x00, 0xff, 0xff, 0x0f, 0xff,
+  0xff, 0xff, 0xf0, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x00,
+  0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xf0,
+  0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00,
+  0xf0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00,
+  0x00, 0x00, 0xf0, 0xff, 0x0f, 0x0f, 0xff, 0xff, 0xf0, 0xf0, 0xff, 0x0f, 0x0f, 0xff, 0xff, 0xf0,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xf0,
+  0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x00,
+  0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x0f, 0x0f, 0x00, 0xf0, 0xf0,
+  0x00, 0x00, 0x0f, 0x0f, 0x00, 0xf0, 0xf0, 0x00, 0xff, 0x00, 0xf0, 0xf0, 0x0f, 0x00, 0x0f, 0xff,
+  0x00, 0xf0, 0xf0, 0x0f, 0x00, 0x0f, 0x0f, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00,
+  0xff, 0x00, 0x00, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x0f, 0x00, 0xf0, 0x00,
+  0x00, 0x0f, 0x00, 0xf0, 0xff, 0xff, 0xf0, 0xff, 0x0f, 0xff, 0xff, 0xf0, 0xff, 0x0f, 0x00, 0x00,
+  0x0f, 0x00, 0xf0, 0x00, 0x00, 0x0f, 0x00, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x00, 0x00,
+  0x0f, 0x00, 0xf0, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x0f, 0x00, 0xf0, 0x00, 0x00, 0x0f, 0x00, 0xf0,
+  0x00, 0x00, 0x0f, 0x00, 0xf0, 0x00, 0x00, 0x0f, 0x00, 0xf0, 0xff, 0xff, 0xf0, 0xff, 0x0f, 0xff,
+  0xff, 0xf0, 0xff, 0x0f, 0xf0, 0xff, 0x00, 0xff, 0x0f, 0xf0, 0xff, 0x00, 0xff, 0x0f, 0x0f, 0x00,
+  0xff, 0x00, 0xf0, 0x0f, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0x00, 0xff,
+  0x00, 0xf0, 0x0f, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0x00, 0xff, 0x00, 0xf0, 0xf0, 0xff, 0x00, 0xff,
+  0x0f, 0xf0, 0xff, 0x00, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x0f, 0x0f, 0xf0, 0x0f, 0x0f, 0xf0, 0x0f, 0x0f, 0xf0, 0x0f, 0x0f, 0xf0, 0x00, 0x0f,
+  0xf0, 0x00, 0x0f, 0xf0, 0x00, 0x0f, 0xf0, 0x00, 0x0f, 0xf0, 0x00, 0x0f, 0xf0, 0x00, 0x0f, 0xf0,
+  0x00, 0x0f, 0xf0, 0x00, 0x0f, 0xf0, 0x00, 0xf0, 0x0f, 0x00, 0xf0, 0x0f, 0x00, 0xf0, 0x0f, 0x00,
+  0xf0, 0x0f, 0x00, 0xf0, 0x0f, 0x00, 0xf0, 0x0f, 0x00, 0xf0, 0x0f, 0x00, 0xf0, 0x0f, 0x00, 0x0f,
+  0xf0, 0x00, 0x0f, 0xf0, 0x00, 0x0f, 0xf0, 0x00, 0x0f, 0xf0, 0x00, 0x0f, 0xf0, 0x00, 0x0f, 0xf0,
+  0x00, 0x0f, 0xf0, 0x00, 0x0f, 0xf0, 0x0f, 0x0f, 0xf0, 0x0f, 0x0f, 0xf0, 0x0f, 0x0f, 0xf0, 0x0f,
+  0x0f, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x00,
+  0xf0, 0x00, 0x00, 0x0f, 0x00, 0xf0, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x0f, 0xf0, 0xf0, 0x00, 0x0f, 0x0f, 0xf0, 0xf0, 0x00, 0x0f, 0x00, 0x00, 0x0f, 0x00,
+  0xf0, 0x00, 0x00, 0x0f, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0x00, 0x0f, 0x00, 0xf0, 0x00, 0x00, 0x0f,
+  0x0f, 0xf0, 0xf0, 0x00, 0x0f, 0x0f, 0xf0, 0xf0, 0x00, 0x0f, 0x0f, 0x0f, 0xff, 0xf0, 0xf0, 0x0f,
+  0x0f, 0xff, 0xf0, 0xf0, 0x0f, 0x0f, 0xff, 0xf0, 0xf0, 0x0f, 0x0f, 0xff, 0xf0, 0xf0, 0x0f, 0x0f,
+  0xff, 0xf0, 0xf0, 0x0f, 0x0f, 0xff, 0xf0, 0xf0, 0xf0, 0x00, 0x0f, 0x0f, 0xf0, 0xf0, 0x00, 0x0f,
+  0x0f, 0xf0, 0xf0, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff,
+  0x0f, 0x00, 0x0f, 0xf0, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x0f, 0xf0, 0x00, 0xf0, 0x00, 0x0f, 0x00,
+  0x0f, 0xf0, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x0f, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0xff, 0x0f, 0xff, 0xff, 0xf0,
+  0xff, 0x0f, 0xff, 0xff, 0x0f, 0x00, 0xf0, 0x00, 0x00, 0x0f, 0x00, 0xf0, 0x00, 0x00, 0x0f, 0x00,
+  0xf0, 0x00, 0x00, 0x0f, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x0f, 0x00, 0xf0, 0x00, 0x00,
+  0x0f, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0x0f, 0xf0,
+  0xff, 0x00, 0xff, 0x0f, 0xf0, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0x00, 0xf0, 0x00, 0x00, 0x0f, 0x00,
+  0x0f, 0x00, 0xf0, 0x00, 0x00, 0x0f, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x0f, 0x00, 0xf0,
+  0x00, 0x00, 0x0f, 0x00, 0x00, 0xff, 0x0f, 0xf0, 0xff, 0x00, 0xff, 0x0f, 0xf0, 0xff, 0xf0, 0xff,
+  0x0f, 0xff, 0xff, 0xf0, 0xff, 0x0f, 0xff, 0xff, 0x0f, 0x00, 0xf0, 0x00, 0x00, 0x0f, 0x00, 0xf0,
+  0x00, 0x00, 0xf0, 0x0f, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0x00, 0xff, 0x00, 0x0f, 0x00, 0xf0, 0x00,
+  0x00, 0x0f, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0xff, 0x0f, 0xff, 0xff, 0xf0, 0xff, 0x0f, 0xff, 0xff,
+  0x0f, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0x00, 0xff, 0x00, 0xf0, 0xf0, 0xf0, 0x00, 0x0f, 0x0f, 0xf0,
+  0xf0, 0x00, 0x0f, 0x0f, 0x00, 0x0f, 0x00, 0xf0, 0x00, 0x00, 0x0f, 0x00, 0xf0, 0x00, 0xf0, 0xf0,
+  0x00, 0x0f, 0x0f, 0xf0, 0xf0, 0x00, 0x0f, 0x0f, 0x0f, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0x00, 0xff,
+  0x00, 0xf0, 0x0f, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x0f, 0x0f,
+  0x00, 0x0f, 0x0f, 0x00, 0x0f, 0x0f, 0x00, 0x0f, 0x0f, 0x00, 0x0f, 0x0f, 0x00, 0x0f, 0x0f, 0x00,
+  0x0f, 0x0f, 0x00, 0x0f, 0x0f, 0x00, 0x0f, 0x0f, 0x00, 0x0f, 0x0f, 0x00, 0x0f, 0x0f, 0x00, 0x0f,
+  0x0f, 0x00, 0xf0, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xf0, 0xff, 0xff, 0x0f, 0x00,
+  0xff, 0x00, 0xf0, 0x0f, 0x00, 0xff, 0x00, 0xf0, 0xff, 0x00, 0xff, 0x0f, 0xf0, 0xff, 0x00, 0xff,
+  0x0f, 0xf0, 0x0f, 0x0f, 0xff, 0xf0, 0xf0, 0x0f, 0x0f, 0xff, 0xf0, 0xf0, 0x0f, 0xf0, 0xff, 0x00,
+  0xff, 0x0f, 0xf0, 0xff, 0x00, 0xff, 0x0f, 0x00, 0xff, 0x00, 0xf0, 0x0f, 0x00, 0xff, 0x00, 0xf0,
+  0x00, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0xf0, 0x0f,
+  0xff, 0x00, 0xff, 0xf0, 0x0f, 0xf0, 0x0f, 0xff, 0x00, 0xff, 0xf0, 0x0f, 0x0f, 0x00, 0x00, 0xff,
+  0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0xff, 0x00, 0x00,
+  0xf0, 0x0f, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf0, 0xf0, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x0f, 0xf0,
+  0x00, 0xf0, 0x00, 0x0f, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0x0f, 0xf0, 0x00, 0xf0, 0x00, 0x0f,
+  0x00, 0x0f, 0x0f, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf0,
+  0x0f, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf0, 0xf0, 0x0f,
+  0xff, 0x00, 0xff, 0xf0, 0x0f, 0xf0, 0x0f, 0xff, 0x00, 0xff, 0xf0, 0x0f, 0x00, 0xf0, 0x00, 0x00,
+  0x00, 0x0f, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x0f, 0x0f, 0x0f, 0x0f, 0xf0, 0xf0,
+  0xf0, 0xf0, 0x0f, 0x0f, 0x0f, 0x0f, 0xf0, 0xf0, 0xf0, 0xf0, 0x8c, 0x37, 0xcf, 0x1e, 0x03
+};
+
+const FontGlyph_TypeDef prop_20x28_glyphs[96] = {
+  {    0,  0,  0, 0,  0, 12}, // ' ' (32)
+  {    0,  4, 28, 0,  4,  8}, // '!' (33)
+  {   14, 12, 12, 0, 20, 16}, // '"' (34)
+  {   32, 20, 28, 0,  4, 24}, // '#' (35)
+  {  102, 20, 28, 0,  4, 24}, // '$' (36)
+  {  172, 20, 28, 0,  4, 24}, // '%' (37)
+  {  242, 20, 28, 0,  4, 24}, // '&' (38)
+  {  312,  4,  8, 0, 24,  8}, // "'" (39)
+  {  316,  8, 28, 0,  4, 12}, // '(' (40)
+  {  344,  8, 28, 0,  4, 12}, // ')' (41)
+  {  372, 12, 16, 0, 16, 16}, // '*' (42)
+  {  396, 20, 20, 0,  8, 24}, // '+' (43)
+  {  446,  8, 12, 0,  0, 12}, // ',' (44)
+  {  458, 12,  4, 0, 16, 16}, // '-' (45)
+  {  464,  4,  4, 0,  4,  8}, // '.' (46)
+  {  466, 20, 28, 0,  4, 24}, // '/' (47)
+  {  536, 20, 28, 0,  4, 24}, // '0' (48)
+  {  606, 12, 28, 0,  4, 16}, // '1' (49)
+  {  648, 20, 28, 0,  4, 24}, // '2' (50)
+  {  718, 20, 28, 0,  4, 24}, // '3' (51)
+  {  788, 20, 28, 0,  4, 24}, // '4' (52)
+  {  858, 20, 28, 0,  4, 24}, // '5' (53)
+  {  928, 20, 28, 0,  4, 24}, // '6' (54)
+  {  998, 20, 28, 0,  4, 24}, // '7' (55)
+  { 1068, 20, 28, 0,  4, 24}, // '8' (56)
+  { 1138, 20, 28, 0,  4, 24}, // '9' (57)
+  { 1208,  4, 16, 0,  8,  8}, // ':' (58)
+  { 1216,  8, 20, 0,  4, 12}, // ';' (59)
+  { 1236, 12, 20, 0,  8, 16}, // '<' (60)
+  { 1266, 16, 12, 0, 12, 20}, // '=' (61)
+  { 1290, 12, 20, 0,  8, 16}, // '>' (62)
+  { 1320, 20, 28, 0,  4, 24}, // '?' (63)
+  { 1390, 20, 28, 0,  4, 24}, // '@' (64)
+  { 1460, 20, 28, 0,  4, 24}, // 'A' (65)
+  { 1530, 20, 28, 0,  4, 24}, // 'B' (66)
+  { 1600, 20, 28, 0,  4, 24}, // 'C' (67)
+  { 1670, 20, 28, 0,  4, 24}, // 'D' (68)
+  { 1740, 20, 28, 0,  4, 24}, // 'E' (69)
+  { 1810, 20, 28, 0,  4, 24}, // 'F' (70)
+  { 1880, 20, 28, 0,  4, 24}, // 'G' (71)
+  { 1950, 20, 28, 0,  4, 24}, // 'H' (72)
+  { 2020, 20, 28, 0,  4, 24}, // 'I' (73)
+  { 2090, 20, 28, 0,  4, 24}, // 'J' (74)
+  { 2160, 20, 28, 0,  4, 24}, // 'K' (75)
+  { 2230, 20, 28, 0,  4, 24}, // 'L' (76)
+  { 2300, 20, 28, 0,  4, 24}, // 'M' (77)
+  { 2370, 20, 28, 0,  4, 24}, // 'N' (78)
+  { 2440, 20, 28, 0,  4, 24}, // 'O' (79)
+  { 2510, 20, 28, 0,  4, 24}, // 'P' (80)
+  { 2580, 20, 28, 0,  4, 24}, // 'Q' (81)
+  { 2650, 20, 28, 0,  4, 24}, // 'R' (82)
+  { 2720, 20, 28, 0,  4, 24}, // 'S' (83)
+  { 2790, 20, 28, 0,  4, 24}, // 'T' (84)
+  { 2860, 20, 28, 0,  4, 24}, // 'U' (85)
+  { 2930, 20, 28, 0,  4, 24}, // 'V' (86)
+  { 3000, 20, 28, 0,  4, 24}, // 'W' (87)
+  { 3070, 20, 28, 0,  4, 24}, // 'X' (88)
+  { 3140, 20, 28, 0,  4, 24}, // 'Y' (89)
+  { 3210, 20, 28, 0,  4, 24}, // 'Z' (90)
+  { 3280, 12, 28, 0,  4, 16}, // '[' (91)
+  { 3322, 20, 28, 0,  4, 24}, // '\\' (92)
+  { 3392, 12, 28, 0,  4, 16}, // ']' (93)
+  { 3434, 20, 12, 0, 20, 24}, // '^' (94)
+  { 3464, 20,  4, 0,  4, 24}, // '_' (95)
+  { 3474,  8,  8, 0, 24, 12}, // '`' (96)
+  { 3482, 20, 20, 0,  4, 24}, // 'a' (97)
+  { 3532, 20, 28, 0,  4, 24}, // 'b' (98)
+  { 3602, 20, 20, 0,  4, 24}, // 'c' (99)
+  { 3652, 20, 28, 0,  4, 24}, // 'd' (100)
+  { 3722, 20, 20, 0,  4, 24}, // 'e' (101)
+  { 3772, 20, 28, 0,  4, 24}, // 'f' (102)
+  { 3842, 20, 28, 0,  4, 24}, // 'g' (103)
+  { 3912, 20, 28, 0,  4, 24}, // 'h' (104)
+  { 3982, 12, 28, 0,  4, 16}, // 'i' (105)
+  { 4024, 16, 28, 0,  4, 20}, // 'j' (106)
+  { 4080, 20, 28, 0,  4, 24}, // 'k' (107)
+  { 4150, 12, 28, 0,  4, 16}, // 'l' (108)
+  { 4192, 20, 20, 0,  4, 24}, // 'm' (109)
+  { 4242, 20, 20, 0,  4, 24}, // 'n' (110)
+  { 4292, 20, 20, 0,  4, 24}, // 'o' (111)
+  { 4342, 20, 24, 0,  4, 24}, // 'p' (112)
+  { 4402, 20, 24, 0,  4, 24}, // 'q' (113)
+  { 4462, 20, 20, 0,  4, 24}, // 'r' (114)
+  { 4512, 20, 20, 0,  4, 24}, // 's' (115)
+  { 4562, 16, 28, 0,  4, 20}, // 't' (116)
+  { 4618, 20, 20, 0,  4, 24}, // 'u' (117)
+  { 4668, 20, 20, 0,  4, 24}, // 'v' (118)
+  { 4718, 20, 20, 0,  4, 24}, // 'w' (119)
+  { 4768, 20, 20, 0,  4, 24}, // 'x' (120)
+  { 4818, 20, 24, 0,  4, 24}, // 'y' (121)
+  { 4878, 20, 20, 0,  4, 24}, // 'z' (122)
+  { 4928, 20, 28, 0,  4, 24}, // '{' (123)
+  { 4998,  4, 28, 0,  4,  8}, // '|' (124)
+  { 5012, 20, 28, 0,  4, 24}, // '}' (125)
+  { 5082, 16,  8, 0, 16, 20}, // '~' (126)
+  { 5098,  6,  6, 0, 22, 10}  // '°' (176)
+};
@@ -0,0 +1,134 @@
+/*
+ * Filename: prop_5x7.c
+ * Description: font_dot_5x7 cut down to the inked glyph boxes, 375 bytes.
+ *              Generated by Tools/propfont.py, do not edit.
+ */
+
+#include "propfont.h"
+
+
+const uint8_t prop_5x7_bitmap[375] = {
+  0x7d, 0xc7, 0x01, 0xa4, 0x3f, 0xe9, 0x4f, 0x02, 0x12, 0xd5, 0x5f, 0x45, 0x02, 0x73, 0xea, 0xbe,
+  0x72, 0x06, 0xb6, 0x64, 0xd2, 0x97, 0x00, 0x03, 0xbe, 0x20, 0x41, 0x1f, 0xe5, 0x05, 0x84, 0x7c,
+  0x42, 0x00, 0x35, 0x07, 0x01, 0x03, 0x02, 0x02, 0x02, 0x06, 0xbe, 0x62, 0x32, 0xea, 0x03, 0xc1,
+  0x7f, 0x00, 0xa7, 0x64, 0x32, 0x19, 0x03, 0xa2, 0x60, 0x32, 0x69, 0x03, 0x78, 0x04, 0xe2, 0x8f,
+  0x00, 0xf9, 0x64, 0x32, 0x69, 0x04, 0xbe, 0x64, 0x32, 0x69, 0x04, 0xc0, 0x23, 0x12, 0x09, 0x07,
+  0xb6, 0x64, 0x32, 0x69, 0x03, 0xb2, 0x64, 0x32, 0xe9, 0x03, 0x09, 0x61, 0x02, 0x44, 0x45, 0x6d,
+  0x0b, 0x51, 0x11, 0x20, 0x60, 0x13, 0x09, 0x03, 0xa3, 0x64, 0xb5, 0xea, 0x03, 0x3f, 0x22, 0x91,
+  0xf8, 0x03, 0xff, 0x64, 0x32, 0x69, 0x03, 0xbe, 0x60, 0x30, 0x28, 0x02, 0xff, 0x60, 0x30, 0xe8,
+  0x03, 0xff, 0x64, 0x32, 0x18, 0x04, 0x7f, 0x24, 0x12, 0x08, 0x04, 0xbf, 0x60, 0x32, 0xe9, 0x02,
+  0x7f, 0x04, 0x02, 0xf1, 0x07, 0xc1, 0xe0, 0x3f, 0x18, 0x04, 0xc6, 0x60, 0xd0, 0x0f, 0x04, 0x7f,
+  0x04, 0x82, 0x32, 0x06, 0xff, 0x40, 0x20, 0x10, 0x00, 0x7f, 0x10, 0x06, 0xf4, 0x07, 0x7f, 0x10,
+  0x04, 0xf1, 0x07, 0xbe, 0x60, 0x30, 0xe8, 0x03, 0x7f, 0x24, 0x12, 0x09, 0x03, 0xbe, 0xe0, 0x30,
+  0xe8, 0x03, 0x7f, 0x22, 0x91, 0xb8, 0x03, 0xb1, 0x64, 0x32, 0x69, 0x04, 0x40, 0xe0, 0x1f, 0x08,
+  0x04, 0xfe, 0x40, 0x20, 0xe0, 0x07, 0x7c, 0x41, 0x40, 0xc0, 0x07, 0x7f, 0x01, 0x43, 0xf0, 0x07,
+  0x63, 0x0a, 0x82, 0x32, 0x06, 0x70, 0xc4, 0x01, 0x01, 0x07, 0xc3, 0x62, 0x32, 0x1a, 0x06, 0xff,
+  0x60, 0x10, 0x60, 0x08, 0x82, 0x30, 0x00, 0xc1, 0xe0, 0x1f, 0x11, 0x15, 0x1f, 0x06, 0xb2, 0xd6,
+  0xfa, 0x00, 0xff, 0x48, 0x24, 0xe2, 0x00, 0x2e, 0xc6, 0x98, 0x00, 0x8e, 0x48, 0x24, 0xf2, 0x07,
+  0xae, 0xd6, 0xda, 0x00, 0x88, 0x1f, 0x12, 0x09, 0x04, 0xb6, 0x6c, 0xb5, 0x6e, 0x04, 0x7f, 0x04,
+  0x04, 0xf2, 0x00, 0x91, 0x6f, 0x00, 0x82, 0x40, 0xc0, 0x0b, 0x7f, 0x04, 0x82, 0x32, 0x02, 0xc1,
+  0x7f, 0x00, 0x1f, 0x3a, 0xf8, 0x01, 0x1f, 0x41, 0xf8, 0x00, 0x2e, 0xc6, 0xe8, 0x00, 0x7f, 0x49,
+  0x92, 0x18, 0x18, 0x49, 0x96, 0x3f, 0xe1, 0x27, 0x88, 0x00, 0xa9, 0xd6, 0x2a, 0x01, 0xfe, 0x48,
+  0x44, 0x00, 0x3e, 0x04, 0xf1, 0x01, 0x5c, 0x04, 0xc1, 0x01, 0x3e, 0x98, 0xe0, 0x01, 0x51, 0x11,
+  0x15, 0x01, 0x7d, 0x51, 0x14, 0x3e, 0x71, 0x96, 0x1c, 0x01, 0x08, 0x5b, 0x30, 0x28, 0x02, 0xef,
+  0xa2, 0x60, 0xd0, 0x86, 0x00, 0x99, 0x01
+};
+
+const FontGlyph_TypeDef prop_5x7_glyphs[96] = {
+  {    0,  0,  0, 0,  0,  3}, // ' ' (32)
+  {    0,  1,  7, 0,  1,  2}, // '!' (33)
+  {    1,  3,  3, 0,  5,  4}, // '"' (34)
+  {    3,  5,  7, 0,  1,  6}, // '#' (35)
+  {    8,  5,  7, 0,  1,  6}, // '$' (36)
+  {   13,  5,  7, 0,  1,  6}, // '%' (37)
+  {   18,  5,  7, 0,  1,  6}, // '&' (38)
+  {   23,  1,  2, 0,  6,  2}, // "'" (39)
+  {   24,  2,  7, 0,  1,  3}, // '(' (40)
+  {   26,  2,  7, 0,  1,  3}, // ')' (41)
+  {   28,  3,  4, 0,  4,  4}, // '*' (42)
+  {   30,  5,  5, 0,  2,  6}, // '+' (43)
+  {   34,  2,  3, 0,  0,  3}, // ',' (44)
+  {   35,  3,  1, 0,  4,  4}, // '-' (45)
+  {   36,  1,  1, 0,  1,  2}, // '.' (46)
+  {   37,  5,  7, 0,  1,  6}, // '/' (47)
+  {   42,  5,  7, 0,  1,  6}, // '0' (48)
+  {   47,  3,  7, 0,  1,  4}, // '1' (49)
+  {   50,  5,  7, 0,  1,  6}, // '2' (50)
+  {   55,  5,  7, 0,  1,  6}, // '3' (51)
+  {   60,  5,  7, 0,  1,  6}, // '4' (52)
+  {   65,  5,  7, 0,  1,  6}, // '5' (53)
+  {   70,  5,  7, 0,  1,  6}, // '6' (54)
+  {   75,  5,  7, 0,  1,  6}, // '7' (55)
+  {   80,  5,  7, 0,  1,  6}, // '8' (56)
+  {   85,  5,  7, 0,  1,  6}, // '9' (57)
+  {   90,  1,  4, 0,  2,  2}, // ':' (58)
+  {   91,  2,  5, 0,  1,  3}, // ';' (59)
+  {   93,  3,  5, 0,  2,  4}, // '<' (60)
+  {   95,  4,  3, 0,  3,  5}, // '=' (61)
+  {   97,  3,  5, 0,  2,  4}, // '>' (62)
+  {   99,  5,  7, 0,  1,  6}, // '?' (63)
+  {  104,  5,  7, 0,  1,  6}, // '@' (64)
+  {  109,  5,  7, 0,  1,  6}, // 'A' (65)
+  {  114,  5,  7, 0,  1,  6}, // 'B' (66)
+  {  119,  5,  7, 0,  1,  6}, // 'C' (67)
+  {  124,  5,  7, 0,  1,  6}, // 'D' (68)
+  {  129,  5,  7, 0,  1,  6}, // 'E' (69)
+  {  134,  5,  7, 0,  1,  6}, // 'F' (70)
+  {  139,  5,  7, 0,  1,  6}, // 'G' (71)
+  {  144,  5,  7, 0,  1,  6}, // 'H' (72)
+  {  149,  5,  7, 0,  1,  6}, // 'I' (73)
+  {  154,  5,  7, 0,  1,  6}, // 'J' (74)
+  {  159,  5,  7, 0,  1,  6}, // 'K' (75)
+  {  164,  5,  7, 0,  1,  6}, // 'L' (76)
+  {  169,  5,  7, 0,  1,  6}, // 'M' (77)
+  {  174,  5,  7, 0,  1,  6}, // 'N' (78)
+  {  179,  5,  7, 0,  1,  6}, // 'O' (79)
+  {  184,  5,  7, 0,  1,  6}, // 'P' (80)
+  {  189,  5,  7, 0,  1,  6}, // 'Q' (81)
+  {  194,  5,  7, 0,  1,  6}, // 'R' (82)
+  {  199,  5,  7, 0,  1,  6}, // 'S' (83)
+  {  204,  5,  7, 0,  1,  6}, // 'T' (84)
+  {  209,  5,  7, 0,  1,  6}, // 'U' (85)
+  {  214,  5,  7, 0,  1,  6}, // 'V' (86)
+  {  219,  5,  7, 0,  1,  6}, // 'W' (87)
+  {  224,  5,  7, 0,  1,  6}, // 'X' (88)
+  {  229,  5,  7, 0,  1,  6}, // 'Y' (89)
+  {  234,  5,  7, 0,  1,  6}, // 'Z' (90)
+  {  239,  3,  7, 0,  1,  4}, // '[' (91)
+  {  242,  5,  7, 0,  1,  6}, // '\\' (92)
+  {  247,  3,  7, 0,  1,  4}, // ']' (93)
+  {  250,  5,  3, 0,  5,  6}, // '^' (94)
+  {  252,  5,  1, 0,  1,  6}, // '_' (95)
+  {  253,  2,  2, 0,  6,  3}, // '`' (96)
+  {  254,  5,  5, 0,  1,  6}, // 'a' (97)
+  {  258,  5,  7, 0,  1,  6}, // 'b' (98)
+  {  263,  5,  5, 0,  1,  6}, // 'c' (99)
+  {  267,  5,  7, 0,  1,  6}, // 'd' (100)
+  {  272,  5,  5, 0,  1,  6}, // 'e' (101)
+  {  276,  5,  7, 0,  1,  6}, // 'f' (102)
+  {  281,  5,  7, 0,  1,  6}, // 'g' (103)
+  {  286,  5,  7, 0,  1,  6}, // 'h' (104)
+  {  291,  3,  7, 0,  1,  4}, // 'i' (105)
+  {  294,  4,  7, 0,  1,  5}, // 'j' (106)
+  {  298,  5,  7, 0,  1,  6}, // 'k' (107)
+  {  303,  3,  7, 0,  1,  4}, // 'l' (108)
+  {  306,  5,  5, 0,  1,  6}, // 'm' (109)
+  {  310,  5,  5, 0,  1,  6}, // 'n' (110)
+  {  314,  5,  5, 0,  1,  6}, // 'o' (111)
+  {  318,  5,  6, 0,  1,  6}, // 'p' (112)
+  {  322,  5,  6, 0,  1,  6}, // 'q' (113)
+  {  326,  5,  5, 0,  1,  6}, // 'r' (114)
+  {  330,  5,  5, 0,  1,  6}, // 's' (115)
+  {  334,  4,  7, 0,  1,  5}, // 't' (116)
+  {  338,  5,  5, 0,  1,  6}, // 'u' (117)
+  {  342,  5,  5, 0,  1,  6}, // 'v' (118)
+  {  346,  5,  5, 0,  1,  6}, // 'w' (119)
+  {  350,  5,  5, 0,  1,  6}, // 'x' (120)
+  {  354,  5,  6, 0,  1,  6}, // 'y' (121)
+  {  358,  5,  5, 0,  1,  6}, // 'z' (122)
+  {  362,  5,  7, 0,  1,  6}, // '{' (123)
+  {  367,  1,  8, 0,  0,  2}, // '|' (124)
+  {  368,  5,  7, 0,  1,  6}, // '}' (125)
+  {  373,  4,  2, 0,  4,  5}, // '~' (126)
+  {  374,  1,  1, 0,  6,  2}  // '°' (176)
+};
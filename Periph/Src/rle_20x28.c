@@ -0,0 +1,523 @@
+/*
+ * Filename: rle_20x28.c
+ * Description: font_dot_20x28 x1 run-length encoded, 24x32 cells, 5886 bytes.
+ *              Generated by Tools/rlefont.py, do not edit.
+ */
+
+#include "rlefont.h"
+
+
+const uint8_t rle_20x28_runs[5692] = {
+  // ' ' (32)
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x06,
+  // '!' (33)
+  0x7f, 0x7f, 0x7f, 0x07, 0x84, 0x04, 0x94, 0x04, 0x84, 0x04, 0x94, 0x04, 0x84, 0x04, 0x94, 0x04,
+  0x84, 0x04, 0x94, 0x7f, 0x7f, 0x02,
+  // '"' (34)
+  0x7f, 0x7f, 0x16, 0x8c, 0x14, 0x8c, 0x14, 0x8c, 0x14, 0x8c, 0x7f, 0x15, 0x8c, 0x14, 0x8c, 0x14,
+  0x8c, 0x14, 0x8c, 0x7f, 0x01,
+  // '#' (35)
+  0x0c, 0x84, 0x08, 0x84, 0x10, 0x84, 0x08, 0x84, 0x10, 0x84, 0x08, 0x84, 0x10, 0x84, 0x08, 0x84,
+  0x08, 0x9c, 0x04, 0x9c, 0x04, 0x9c, 0x04, 0x9c, 0x0c, 0x84, 0x08, 0x84, 0x10, 0x84, 0x08, 0x84,
+  0x10, 0x84, 0x08, 0x84, 0x10, 0x84, 0x08, 0x84, 0x08, 0x9c, 0x04, 0x9c, 0x04, 0x9c, 0x04, 0x9c,
+  0x0c, 0x84, 0x08, 0x84, 0x10, 0x84, 0x08, 0x84, 0x10, 0x84, 0x08, 0x84, 0x10, 0x84, 0x08, 0x84,
+  0x7f, 0x05,
+  // '$' (36)
+  0x08, 0x84, 0x08, 0x84, 0x10, 0x84, 0x08, 0x84, 0x10, 0x84, 0x08, 0x84, 0x10, 0x84, 0x08, 0x84,
+  0x10, 0x84, 0x04, 0x84, 0x04, 0x84, 0x0c, 0x84, 0x04, 0x84, 0x04, 0x84, 0x0c, 0x84, 0x04, 0x84,
+  0x04, 0x84, 0x0c, 0x84, 0x04, 0x84, 0x04, 0x84, 0x08, 0x9c, 0x04, 0x9c, 0x04, 0x9c, 0x04, 0x9c,
+  0x08, 0x84, 0x04, 0x84, 0x04, 0x84, 0x0c, 0x84, 0x04, 0x84, 0x04, 0x84, 0x0c, 0x84, 0x04, 0x84,
+  0x04, 0x84, 0x0c, 0x84, 0x04, 0x84, 0x04, 0x84, 0x10, 0x84, 0x08, 0x84, 0x10, 0x84, 0x08, 0x84,
+  0x10, 0x84, 0x08, 0x84, 0x10, 0x84, 0x08, 0x84, 0x7f, 0x05,
+  // '%' (37)
+  0x04, 0x88, 0x08, 0x8c, 0x04, 0x88, 0x08, 0x8c, 0x04, 0x88, 0x08, 0x8c, 0x04, 0x88, 0x08, 0x8c,
+  0x0c, 0x84, 0x04, 0x84, 0x04, 0x84, 0x0c, 0x84, 0x04, 0x84, 0x04, 0x84, 0x0c, 0x84, 0x04, 0x84,
+  0x04, 0x84, 0x0c, 0x84, 0x04, 0x84, 0x04, 0x84, 0x04, 0x88, 0x04, 0x90, 0x04, 0x88, 0x04, 0x90,
+  0x04, 0x88, 0x04, 0x90, 0x04, 0x88, 0x04, 0x90, 0x04, 0x84, 0x04, 0x84, 0x04, 0x84, 0x0c, 0x84,
+  0x04, 0x84, 0x04, 0x84, 0x0c, 0x84, 0x04, 0x84, 0x04, 0x84, 0x0c, 0x84, 0x04, 0x84, 0x04, 0x84,
+  0x0c, 0x8c, 0x08, 0x88, 0x04, 0x8c, 0x08, 0x88, 0x04, 0x8c, 0x08, 0x88, 0x04, 0x8c, 0x08, 0x88,
+  0x7f, 0x01,
+  // '&' (38)
+  0x08, 0x88, 0x04, 0x88, 0x0c, 0x88, 0x04, 0x88, 0x0c, 0x88, 0x04, 0x88, 0x0c, 0x88, 0x04, 0x88,
+  0x08, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84,
+  0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84,
+  0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84,
+  0x08, 0x94, 0x0c, 0x94, 0x0c, 0x94, 0x0c, 0x94, 0x08, 0x84, 0x08, 0x84, 0x10, 0x84, 0x08, 0x84,
+  0x10, 0x84, 0x08, 0x84, 0x10, 0x84, 0x08, 0x84, 0x7f, 0x0d,
+  // "'" (39)
+  0x7f, 0x7f, 0x1a, 0x88, 0x18, 0x88, 0x18, 0x88, 0x18, 0x88, 0x7f, 0x7f, 0x7f, 0x03,
+  // '(' (40)
+  0x08, 0x94, 0x0c, 0x94, 0x0c, 0x94, 0x0c, 0x94, 0x08, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84,
+  0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x7f, 0x7f, 0x7f, 0x7f, 0x04,
+  // ')' (41)
+  0x7f, 0x7f, 0x7f, 0x07, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04,
+  0x84, 0x14, 0x84, 0x08, 0x94, 0x0c, 0x94, 0x0c, 0x94, 0x0c, 0x94, 0x7f, 0x05,
+  // '*' (42)
+  0x7f, 0x7f, 0x12, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84,
+  0x04, 0x84, 0x18, 0x8c, 0x14, 0x8c, 0x14, 0x8c, 0x14, 0x8c, 0x10, 0x84, 0x04, 0x84, 0x14, 0x84,
+  0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x7f, 0x05,
+  // '+' (43)
+  0x10, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84,
+  0x14, 0x94, 0x0c, 0x94, 0x0c, 0x94, 0x0c, 0x94, 0x14, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84,
+  0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x7f, 0x0d,
+  // ',' (44)
+  0x7f, 0x01, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04,
+  0x84, 0x18, 0x88, 0x18, 0x88, 0x18, 0x88, 0x18, 0x88, 0x7f, 0x7f, 0x7f, 0x17,
+  // '-' (45)
+  0x7f, 0x11, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c,
+  0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x7f, 0x7f, 0x0e,
+  // '.' (46)
+  0x7f, 0x05, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x7f, 0x7f, 0x7f, 0x7f, 0x1c,
+  // '/' (47)
+  0x04, 0x88, 0x18, 0x88, 0x18, 0x88, 0x18, 0x88, 0x20, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84,
+  0x20, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x20, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84,
+  0x20, 0x88, 0x18, 0x88, 0x18, 0x88, 0x18, 0x88, 0x7f, 0x01,
+  // '0' (48)
+  0x08, 0x94, 0x0c, 0x94, 0x0c, 0x94, 0x0c, 0x94, 0x08, 0x84, 0x04, 0x84, 0x0c, 0x84, 0x04, 0x84,
+  0x04, 0x84, 0x0c, 0x84, 0x04, 0x84, 0x04, 0x84, 0x0c, 0x84, 0x04, 0x84, 0x04, 0x84, 0x0c, 0x84,
+  0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84,
+  0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x0c, 0x84, 0x04, 0x84, 0x04, 0x84,
+  0x0c, 0x84, 0x04, 0x84, 0x04, 0x84, 0x0c, 0x84, 0x04, 0x84, 0x04, 0x84, 0x0c, 0x84, 0x04, 0x84,
+  0x08, 0x94, 0x0c, 0x94, 0x0c, 0x94, 0x0c, 0x94, 0x7f, 0x05,
+  // '1' (49)
+  0x7f, 0x7f, 0x06, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84,
+  0x14, 0x84, 0x04, 0x9c, 0x04, 0x9c, 0x04, 0x9c, 0x04, 0x9c, 0x04, 0x84, 0x1c, 0x84, 0x1c, 0x84,
+  0x1c, 0x84, 0x7f, 0x19,
+  // '2' (50)
+  0x04, 0x8c, 0x08, 0x84, 0x08, 0x8c, 0x08, 0x84, 0x08, 0x8c, 0x08, 0x84, 0x08, 0x8c, 0x08, 0x84,
+  0x08, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84,
+  0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84,
+  0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84,
+  0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84,
+  0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x0c, 0x88, 0x08, 0x84, 0x0c, 0x88,
+  0x08, 0x84, 0x0c, 0x88, 0x08, 0x84, 0x0c, 0x88, 0x7f, 0x05,
+  // '3' (51)
+  0x08, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84,
+  0x08, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84,
+  0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84,
+  0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84,
+  0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84,
+  0x08, 0x88, 0x04, 0x88, 0x0c, 0x88, 0x04, 0x88, 0x0c, 0x88, 0x04, 0x88, 0x0c, 0x88, 0x04, 0x88,
+  0x7f, 0x05,
+  // '4' (52)
+  0x10, 0x90, 0x10, 0x90, 0x10, 0x90, 0x10, 0x90, 0x10, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84,
+  0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x10, 0x9c, 0x04, 0x9c, 0x04, 0x9c, 0x04, 0x9c,
+  0x10, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x7f, 0x0d,
+  // '5' (53)
+  0x04, 0x84, 0x08, 0x90, 0x04, 0x84, 0x08, 0x90, 0x04, 0x84, 0x08, 0x90, 0x04, 0x84, 0x08, 0x90,
+  0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84,
+  0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84,
+  0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84,
+  0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84,
+  0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x08, 0x88, 0x0c, 0x84, 0x08, 0x88, 0x0c, 0x84,
+  0x08, 0x88, 0x0c, 0x84, 0x08, 0x88, 0x0c, 0x84, 0x7f, 0x01,
+  // '6' (54)
+  0x08, 0x94, 0x0c, 0x94, 0x0c, 0x94, 0x0c, 0x94, 0x08, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84,
+  0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84,
+  0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84,
+  0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84,
+  0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84,
+  0x08, 0x88, 0x0c, 0x84, 0x08, 0x88, 0x0c, 0x84, 0x08, 0x88, 0x0c, 0x84, 0x08, 0x88, 0x0c, 0x84,
+  0x7f, 0x01,
+  // '7' (55)
+  0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x04, 0x8c, 0x0c, 0x84, 0x04, 0x8c, 0x0c, 0x84,
+  0x04, 0x8c, 0x0c, 0x84, 0x04, 0x8c, 0x0c, 0x84, 0x10, 0x84, 0x08, 0x84, 0x10, 0x84, 0x08, 0x84,
+  0x10, 0x84, 0x08, 0x84, 0x10, 0x84, 0x08, 0x84, 0x10, 0x84, 0x08, 0x84, 0x10, 0x84, 0x08, 0x84,
+  0x10, 0x84, 0x08, 0x84, 0x10, 0x84, 0x08, 0x84, 0x14, 0x8c, 0x14, 0x8c, 0x14, 0x8c, 0x14, 0x8c,
+  0x7f, 0x01,
+  // '8' (56)
+  0x08, 0x88, 0x04, 0x88, 0x0c, 0x88, 0x04, 0x88, 0x0c, 0x88, 0x04, 0x88, 0x0c, 0x88, 0x04, 0x88,
+  0x08, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84,
+  0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84,
+  0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84,
+  0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84,
+  0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x08, 0x88, 0x04, 0x88, 0x0c, 0x88, 0x04, 0x88,
+  0x0c, 0x88, 0x04, 0x88, 0x0c, 0x88, 0x04, 0x88, 0x7f, 0x05,
+  // '9' (57)
+  0x08, 0x84, 0x08, 0x88, 0x0c, 0x84, 0x08, 0x88, 0x0c, 0x84, 0x08, 0x88, 0x0c, 0x84, 0x08, 0x88,
+  0x08, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84,
+  0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84,
+  0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84,
+  0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84,
+  0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x08, 0x94, 0x0c, 0x94, 0x0c, 0x94, 0x0c, 0x94,
+  0x7f, 0x05,
+  // ':' (58)
+  0x7f, 0x7f, 0x0a, 0x84, 0x08, 0x84, 0x10, 0x84, 0x08, 0x84, 0x10, 0x84, 0x08, 0x84, 0x10, 0x84,
+  0x08, 0x84, 0x7f, 0x7f, 0x7f, 0x0b,
+  // ';' (59)
+  0x7f, 0x05, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x88, 0x08, 0x84, 0x0c, 0x88, 0x08,
+  0x84, 0x0c, 0x88, 0x08, 0x84, 0x0c, 0x88, 0x08, 0x84, 0x7f, 0x7f, 0x7f, 0x0b,
+  // '<' (60)
+  0x7f, 0x11, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x18, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04,
+  0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x10, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c,
+  0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x7f, 0x7f, 0x06,
+  // '=' (61)
+  0x7f, 0x0d, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04,
+  0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04,
+  0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04,
+  0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04,
+  0x84, 0x7f, 0x09,
+  // '>' (62)
+  0x7f, 0x7f, 0x0a, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84,
+  0x0c, 0x84, 0x10, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84,
+  0x04, 0x84, 0x18, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x7f, 0x0d,
+  // '?' (63)
+  0x18, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x20, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84,
+  0x04, 0x84, 0x04, 0x88, 0x08, 0x84, 0x04, 0x84, 0x04, 0x88, 0x08, 0x84, 0x04, 0x84, 0x04, 0x88,
+  0x08, 0x84, 0x04, 0x84, 0x04, 0x88, 0x08, 0x84, 0x10, 0x84, 0x08, 0x84, 0x10, 0x84, 0x08, 0x84,
+  0x10, 0x84, 0x08, 0x84, 0x10, 0x84, 0x08, 0x84, 0x14, 0x88, 0x18, 0x88, 0x18, 0x88, 0x18, 0x88,
+  0x7f, 0x05,
+  // '@' (64)
+  0x04, 0x88, 0x0c, 0x84, 0x08, 0x88, 0x0c, 0x84, 0x08, 0x88, 0x0c, 0x84, 0x08, 0x88, 0x0c, 0x84,
+  0x08, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84,
+  0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x04, 0x84, 0x04, 0x84, 0x04, 0x84,
+  0x04, 0x84, 0x04, 0x84, 0x04, 0x84, 0x04, 0x84, 0x04, 0x84, 0x04, 0x84, 0x04, 0x84, 0x04, 0x84,
+  0x04, 0x84, 0x04, 0x84, 0x04, 0x84, 0x04, 0x84, 0x04, 0x84, 0x04, 0x84, 0x04, 0x84, 0x04, 0x84,
+  0x04, 0x84, 0x04, 0x84, 0x04, 0x84, 0x04, 0x84, 0x04, 0x84, 0x04, 0x84, 0x04, 0x84, 0x04, 0x84,
+  0x04, 0x84, 0x04, 0x84, 0x04, 0x84, 0x04, 0x84, 0x08, 0x94, 0x0c, 0x94, 0x0c, 0x94, 0x0c, 0x94,
+  0x7f, 0x05,
+  // 'A' (65)
+  0x04, 0x98, 0x08, 0x98, 0x08, 0x98, 0x08, 0x98, 0x10, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84,
+  0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84,
+  0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84,
+  0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x04, 0x98, 0x08, 0x98, 0x08, 0x98, 0x08, 0x98,
+  0x7f, 0x05,
+  // 'B' (66)
+  0x04, 0x9c, 0x04, 0x9c, 0x04, 0x9c, 0x04, 0x9c, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84,
+  0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84,
+  0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84,
+  0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84,
+  0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84,
+  0x08, 0x88, 0x04, 0x88, 0x0c, 0x88, 0x04, 0x88, 0x0c, 0x88, 0x04, 0x88, 0x0c, 0x88, 0x04, 0x88,
+  0x7f, 0x05,
+  // 'C' (67)
+  0x08, 0x94, 0x0c, 0x94, 0x0c, 0x94, 0x0c, 0x94, 0x08, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84,
+  0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84,
+  0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84,
+  0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x08, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84,
+  0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x7f, 0x05,
+  // 'D' (68)
+  0x04, 0x9c, 0x04, 0x9c, 0x04, 0x9c, 0x04, 0x9c, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84,
+  0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84,
+  0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84,
+  0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x08, 0x94, 0x0c, 0x94, 0x0c, 0x94, 0x0c, 0x94,
+  0x7f, 0x05,
+  // 'E' (69)
+  0x04, 0x9c, 0x04, 0x9c, 0x04, 0x9c, 0x04, 0x9c, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84,
+  0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84,
+  0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84,
+  0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84,
+  0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84,
+  0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x7f, 0x01,
+  // 'F' (70)
+  0x04, 0x9c, 0x04, 0x9c, 0x04, 0x9c, 0x04, 0x9c, 0x10, 0x84, 0x08, 0x84, 0x10, 0x84, 0x08, 0x84,
+  0x10, 0x84, 0x08, 0x84, 0x10, 0x84, 0x08, 0x84, 0x10, 0x84, 0x08, 0x84, 0x10, 0x84, 0x08, 0x84,
+  0x10, 0x84, 0x08, 0x84, 0x10, 0x84, 0x08, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84,
+  0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x7f, 0x01,
+  // 'G' (71)
+  0x08, 0x94, 0x0c, 0x94, 0x0c, 0x94, 0x0c, 0x94, 0x08, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84,
+  0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84,
+  0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84,
+  0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84,
+  0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x08, 0x8c, 0x04, 0x84, 0x0c, 0x8c, 0x04, 0x84,
+  0x0c, 0x8c, 0x04, 0x84, 0x0c, 0x8c, 0x04, 0x84, 0x7f, 0x05,
+  // 'H' (72)
+  0x04, 0x9c, 0x04, 0x9c, 0x04, 0x9c, 0x04, 0x9c, 0x10, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84,
+  0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84,
+  0x10, 0x9c, 0x04, 0x9c, 0x04, 0x9c, 0x04, 0x9c, 0x7f, 0x01,
+  // 'I' (73)
+  0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84,
+  0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84,
+  0x04, 0x9c, 0x04, 0x9c, 0x04, 0x9c, 0x04, 0x9c, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84,
+  0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84,
+  0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x7f, 0x01,
+  // 'J' (74)
+  0x08, 0x84, 0x10, 0x84, 0x08, 0x84, 0x10, 0x84, 0x08, 0x84, 0x10, 0x84, 0x08, 0x84, 0x10, 0x84,
+  0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84,
+  0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84,
+  0x08, 0x98, 0x08, 0x98, 0x08, 0x98, 0x08, 0x98, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84,
+  0x7f, 0x01,
+  // 'K' (75)
+  0x04, 0x9c, 0x04, 0x9c, 0x04, 0x9c, 0x04, 0x9c, 0x10, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84,
+  0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x18, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84,
+  0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x0c, 0x88, 0x0c, 0x88, 0x04, 0x88, 0x0c, 0x88,
+  0x04, 0x88, 0x0c, 0x88, 0x04, 0x88, 0x0c, 0x88, 0x7f, 0x01,
+  // 'L' (76)
+  0x04, 0x9c, 0x04, 0x9c, 0x04, 0x9c, 0x04, 0x9c, 0x04, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84,
+  0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84,
+  0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x7f, 0x19,
+  // 'M' (77)
+  0x04, 0x9c, 0x04, 0x9c, 0x04, 0x9c, 0x04, 0x9c, 0x18, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84,
+  0x14, 0x88, 0x18, 0x88, 0x18, 0x88, 0x18, 0x88, 0x20, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84,
+  0x08, 0x9c, 0x04, 0x9c, 0x04, 0x9c, 0x04, 0x9c, 0x7f, 0x01,
+  // 'N' (78)
+  0x04, 0x9c, 0x04, 0x9c, 0x04, 0x9c, 0x04, 0x9c, 0x18, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84,
+  0x18, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x18, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84,
+  0x10, 0x9c, 0x04, 0x9c, 0x04, 0x9c, 0x04, 0x9c, 0x7f, 0x01,
+  // 'O' (79)
+  0x08, 0x94, 0x0c, 0x94, 0x0c, 0x94, 0x0c, 0x94, 0x08, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84,
+  0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84,
+  0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84,
+  0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x08, 0x94, 0x0c, 0x94, 0x0c, 0x94, 0x0c, 0x94,
+  0x7f, 0x05,
+  // 'P' (80)
+  0x04, 0x9c, 0x04, 0x9c, 0x04, 0x9c, 0x04, 0x9c, 0x10, 0x84, 0x08, 0x84, 0x10, 0x84, 0x08, 0x84,
+  0x10, 0x84, 0x08, 0x84, 0x10, 0x84, 0x08, 0x84, 0x10, 0x84, 0x08, 0x84, 0x10, 0x84, 0x08, 0x84,
+  0x10, 0x84, 0x08, 0x84, 0x10, 0x84, 0x08, 0x84, 0x10, 0x84, 0x08, 0x84, 0x10, 0x84, 0x08, 0x84,
+  0x10, 0x84, 0x08, 0x84, 0x10, 0x84, 0x08, 0x84, 0x14, 0x88, 0x18, 0x88, 0x18, 0x88, 0x18, 0x88,
+  0x7f, 0x05,
+  // 'Q' (81)
+  0x08, 0x94, 0x0c, 0x94, 0x0c, 0x94, 0x0c, 0x94, 0x08, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84,
+  0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x88, 0x10, 0x84, 0x04, 0x88, 0x10, 0x84,
+  0x04, 0x88, 0x10, 0x84, 0x04, 0x88, 0x10, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84,
+  0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x08, 0x94, 0x0c, 0x94, 0x0c, 0x94, 0x0c, 0x94,
+  0x7f, 0x05,
+  // 'R' (82)
+  0x04, 0x9c, 0x04, 0x9c, 0x04, 0x9c, 0x04, 0x9c, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84,
+  0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84,
+  0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84,
+  0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x04, 0x88, 0x04, 0x8c, 0x08, 0x88, 0x04, 0x8c,
+  0x08, 0x88, 0x04, 0x8c, 0x08, 0x88, 0x04, 0x8c, 0x7f, 0x05,
+  // 'S' (83)
+  0x04, 0x84, 0x0c, 0x88, 0x08, 0x84, 0x0c, 0x88, 0x08, 0x84, 0x0c, 0x88, 0x08, 0x84, 0x0c, 0x88,
+  0x08, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84,
+  0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84,
+  0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84,
+  0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84,
+  0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x08, 0x88, 0x0c, 0x84, 0x08, 0x88, 0x0c, 0x84,
+  0x08, 0x88, 0x0c, 0x84, 0x08, 0x88, 0x0c, 0x84, 0x7f, 0x01,
+  // 'T' (84)
+  0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84,
+  0x04, 0x9c, 0x04, 0x9c, 0x04, 0x9c, 0x04, 0x9c, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84,
+  0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x7f, 0x01,
+  // 'U' (85)
+  0x08, 0x98, 0x08, 0x98, 0x08, 0x98, 0x08, 0x98, 0x04, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84,
+  0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84,
+  0x20, 0x98, 0x08, 0x98, 0x08, 0x98, 0x08, 0x98, 0x7f, 0x01,
+  // 'V' (86)
+  0x0c, 0x94, 0x0c, 0x94, 0x0c, 0x94, 0x0c, 0x94, 0x08, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84,
+  0x18, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x20, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84,
+  0x20, 0x94, 0x0c, 0x94, 0x0c, 0x94, 0x0c, 0x94, 0x7f, 0x01,
+  // 'W' (87)
+  0x04, 0x9c, 0x04, 0x9c, 0x04, 0x9c, 0x04, 0x9c, 0x08, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84,
+  0x20, 0x88, 0x18, 0x88, 0x18, 0x88, 0x18, 0x88, 0x14, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84,
+  0x18, 0x9c, 0x04, 0x9c, 0x04, 0x9c, 0x04, 0x9c, 0x7f, 0x01,
+  // 'X' (88)
+  0x04, 0x88, 0x0c, 0x88, 0x04, 0x88, 0x0c, 0x88, 0x04, 0x88, 0x0c, 0x88, 0x04, 0x88, 0x0c, 0x88,
+  0x0c, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84,
+  0x18, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x18, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84,
+  0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x0c, 0x88, 0x0c, 0x88, 0x04, 0x88, 0x0c, 0x88,
+  0x04, 0x88, 0x0c, 0x88, 0x04, 0x88, 0x0c, 0x88, 0x7f, 0x01,
+  // 'Y' (89)
+  0x14, 0x8c, 0x14, 0x8c, 0x14, 0x8c, 0x14, 0x8c, 0x10, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84,
+  0x10, 0x8c, 0x14, 0x8c, 0x14, 0x8c, 0x14, 0x8c, 0x20, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84,
+  0x20, 0x8c, 0x14, 0x8c, 0x14, 0x8c, 0x14, 0x8c, 0x7f, 0x01,
+  // 'Z' (90)
+  0x04, 0x88, 0x10, 0x84, 0x04, 0x88, 0x10, 0x84, 0x04, 0x88, 0x10, 0x84, 0x04, 0x88, 0x10, 0x84,
+  0x04, 0x84, 0x04, 0x84, 0x0c, 0x84, 0x04, 0x84, 0x04, 0x84, 0x0c, 0x84, 0x04, 0x84, 0x04, 0x84,
+  0x0c, 0x84, 0x04, 0x84, 0x04, 0x84, 0x0c, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84,
+  0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84,
+  0x04, 0x84, 0x0c, 0x84, 0x04, 0x84, 0x04, 0x84, 0x0c, 0x84, 0x04, 0x84, 0x04, 0x84, 0x0c, 0x84,
+  0x04, 0x84, 0x04, 0x84, 0x0c, 0x84, 0x04, 0x84, 0x04, 0x84, 0x10, 0x88, 0x04, 0x84, 0x10, 0x88,
+  0x04, 0x84, 0x10, 0x88, 0x04, 0x84, 0x10, 0x88, 0x7f, 0x01,
+  // '[' (91)
+  0x7f, 0x7f, 0x06, 0x9c, 0x04, 0x9c, 0x04, 0x9c, 0x04, 0x9c, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84,
+  0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84,
+  0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x7f, 0x01,
+  // '\\' (92)
+  0x18, 0x88, 0x18, 0x88, 0x18, 0x88, 0x18, 0x88, 0x14, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84,
+  0x18, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x18, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84,
+  0x14, 0x88, 0x18, 0x88, 0x18, 0x88, 0x18, 0x88, 0x7f, 0x15,
+  // ']' (93)
+  0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84,
+  0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84,
+  0x04, 0x9c, 0x04, 0x9c, 0x04, 0x9c, 0x04, 0x9c, 0x7f, 0x7f, 0x7f, 0x03,
+  // '^' (94)
+  0x14, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x20, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84,
+  0x20, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x18, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84,
+  0x18, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x7f, 0x09,
+  // '_' (95)
+  0x04, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84,
+  0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84,
+  0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x7f, 0x19,
+  // '`' (96)
+  0x7f, 0x1d, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x18, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c,
+  0x84, 0x7f, 0x7f, 0x7f, 0x07,
+  // 'a' (97)
+  0x08, 0x84, 0x08, 0x84, 0x10, 0x84, 0x08, 0x84, 0x10, 0x84, 0x08, 0x84, 0x10, 0x84, 0x08, 0x84,
+  0x0c, 0x84, 0x04, 0x84, 0x04, 0x84, 0x0c, 0x84, 0x04, 0x84, 0x04, 0x84, 0x0c, 0x84, 0x04, 0x84,
+  0x04, 0x84, 0x0c, 0x84, 0x04, 0x84, 0x04, 0x84, 0x0c, 0x84, 0x04, 0x84, 0x04, 0x84, 0x0c, 0x84,
+  0x04, 0x84, 0x04, 0x84, 0x0c, 0x84, 0x04, 0x84, 0x04, 0x84, 0x0c, 0x84, 0x04, 0x84, 0x04, 0x84,
+  0x0c, 0x84, 0x04, 0x84, 0x04, 0x84, 0x0c, 0x84, 0x04, 0x84, 0x04, 0x84, 0x0c, 0x84, 0x04, 0x84,
+  0x04, 0x84, 0x0c, 0x84, 0x04, 0x84, 0x04, 0x84, 0x0c, 0x90, 0x10, 0x90, 0x10, 0x90, 0x10, 0x90,
+  0x7f, 0x0d,
+  // 'b' (98)
+  0x04, 0x9c, 0x04, 0x9c, 0x04, 0x9c, 0x04, 0x9c, 0x04, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84,
+  0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84,
+  0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84,
+  0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x10, 0x8c, 0x14, 0x8c, 0x14, 0x8c, 0x14, 0x8c,
+  0x7f, 0x0d,
+  // 'c' (99)
+  0x08, 0x8c, 0x14, 0x8c, 0x14, 0x8c, 0x14, 0x8c, 0x10, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84,
+  0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84,
+  0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84,
+  0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x08, 0x84, 0x10, 0x84, 0x08, 0x84,
+  0x10, 0x84, 0x08, 0x84, 0x10, 0x84, 0x08, 0x84, 0x7f, 0x0d,
+  // 'd' (100)
+  0x08, 0x8c, 0x14, 0x8c, 0x14, 0x8c, 0x14, 0x8c, 0x10, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84,
+  0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84,
+  0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84,
+  0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x9c, 0x04, 0x9c, 0x04, 0x9c, 0x04, 0x9c,
+  0x7f, 0x01,
+  // 'e' (101)
+  0x08, 0x8c, 0x14, 0x8c, 0x14, 0x8c, 0x14, 0x8c, 0x10, 0x84, 0x04, 0x84, 0x04, 0x84, 0x0c, 0x84,
+  0x04, 0x84, 0x04, 0x84, 0x0c, 0x84, 0x04, 0x84, 0x04, 0x84, 0x0c, 0x84, 0x04, 0x84, 0x04, 0x84,
+  0x0c, 0x84, 0x04, 0x84, 0x04, 0x84, 0x0c, 0x84, 0x04, 0x84, 0x04, 0x84, 0x0c, 0x84, 0x04, 0x84,
+  0x04, 0x84, 0x0c, 0x84, 0x04, 0x84, 0x04, 0x84, 0x0c, 0x84, 0x04, 0x84, 0x04, 0x84, 0x0c, 0x84,
+  0x04, 0x84, 0x04, 0x84, 0x0c, 0x84, 0x04, 0x84, 0x04, 0x84, 0x0c, 0x84, 0x04, 0x84, 0x04, 0x84,
+  0x0c, 0x84, 0x04, 0x88, 0x10, 0x84, 0x04, 0x88, 0x10, 0x84, 0x04, 0x88, 0x10, 0x84, 0x04, 0x88,
+  0x7f, 0x0d,
+  // 'f' (102)
+  0x10, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x10, 0x98, 0x08, 0x98, 0x08, 0x98, 0x08, 0x98,
+  0x14, 0x84, 0x08, 0x84, 0x10, 0x84, 0x08, 0x84, 0x10, 0x84, 0x08, 0x84, 0x10, 0x84, 0x08, 0x84,
+  0x10, 0x84, 0x08, 0x84, 0x10, 0x84, 0x08, 0x84, 0x10, 0x84, 0x08, 0x84, 0x10, 0x84, 0x08, 0x84,
+  0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x7f, 0x01,
+  // 'g' (103)
+  0x08, 0x88, 0x04, 0x88, 0x0c, 0x88, 0x04, 0x88, 0x0c, 0x88, 0x04, 0x88, 0x0c, 0x88, 0x04, 0x88,
+  0x08, 0x84, 0x08, 0x88, 0x04, 0x84, 0x04, 0x84, 0x08, 0x88, 0x04, 0x84, 0x04, 0x84, 0x08, 0x88,
+  0x04, 0x84, 0x04, 0x84, 0x08, 0x88, 0x04, 0x84, 0x04, 0x84, 0x04, 0x84, 0x04, 0x84, 0x04, 0x84,
+  0x04, 0x84, 0x04, 0x84, 0x04, 0x84, 0x04, 0x84, 0x04, 0x84, 0x04, 0x84, 0x04, 0x84, 0x04, 0x84,
+  0x04, 0x84, 0x04, 0x84, 0x04, 0x84, 0x04, 0x84, 0x04, 0x84, 0x04, 0x84, 0x04, 0x8c, 0x04, 0x84,
+  0x04, 0x84, 0x04, 0x8c, 0x04, 0x84, 0x04, 0x84, 0x04, 0x8c, 0x04, 0x84, 0x04, 0x84, 0x04, 0x8c,
+  0x08, 0x88, 0x0c, 0x84, 0x08, 0x88, 0x0c, 0x84, 0x08, 0x88, 0x0c, 0x84, 0x08, 0x88, 0x0c, 0x84,
+  0x7f, 0x01,
+  // 'h' (104)
+  0x04, 0x9c, 0x04, 0x9c, 0x04, 0x9c, 0x04, 0x9c, 0x10, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84,
+  0x20, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84,
+  0x0c, 0x90, 0x10, 0x90, 0x10, 0x90, 0x10, 0x90, 0x7f, 0x0d,
+  // 'i' (105)
+  0x7f, 0x05, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c,
+  0x84, 0x0c, 0x94, 0x04, 0x84, 0x04, 0x94, 0x04, 0x84, 0x04, 0x94, 0x04, 0x84, 0x04, 0x94, 0x04,
+  0x84, 0x04, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x7f, 0x7f, 0x1a,
+  // 'j' (106)
+  0x08, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x18, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84,
+  0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x20, 0x90, 0x04, 0x84, 0x08, 0x90, 0x04, 0x84,
+  0x08, 0x90, 0x04, 0x84, 0x08, 0x90, 0x04, 0x84, 0x7f, 0x7f, 0x02,
+  // 'k' (107)
+  0x04, 0x9c, 0x04, 0x9c, 0x04, 0x9c, 0x04, 0x9c, 0x10, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84,
+  0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x18, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84,
+  0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x0c, 0x88, 0x0c, 0x84, 0x08, 0x88, 0x0c, 0x84,
+  0x08, 0x88, 0x0c, 0x84, 0x08, 0x88, 0x0c, 0x84, 0x7f, 0x05,
+  // 'l' (108)
+  0x7f, 0x05, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14,
+  0x84, 0x04, 0x9c, 0x04, 0x9c, 0x04, 0x9c, 0x04, 0x9c, 0x04, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c,
+  0x84, 0x7f, 0x7f, 0x1a,
+  // 'm' (109)
+  0x04, 0x94, 0x0c, 0x94, 0x0c, 0x94, 0x0c, 0x94, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84,
+  0x0c, 0x90, 0x10, 0x90, 0x10, 0x90, 0x10, 0x90, 0x20, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84,
+  0x0c, 0x94, 0x0c, 0x94, 0x0c, 0x94, 0x0c, 0x94, 0x7f, 0x09,
+  // 'n' (110)
+  0x04, 0x94, 0x0c, 0x94, 0x0c, 0x94, 0x0c, 0x94, 0x18, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84,
+  0x20, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84,
+  0x0c, 0x90, 0x10, 0x90, 0x10, 0x90, 0x10, 0x90, 0x7f, 0x0d,
+  // 'o' (111)
+  0x08, 0x8c, 0x14, 0x8c, 0x14, 0x8c, 0x14, 0x8c, 0x10, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84,
+  0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84,
+  0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84,
+  0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x10, 0x8c, 0x14, 0x8c, 0x14, 0x8c, 0x14, 0x8c,
+  0x7f, 0x0d,
+  // 'p' (112)
+  0x04, 0x98, 0x08, 0x98, 0x08, 0x98, 0x08, 0x98, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84,
+  0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84,
+  0x10, 0x84, 0x08, 0x84, 0x10, 0x84, 0x08, 0x84, 0x10, 0x84, 0x08, 0x84, 0x10, 0x84, 0x08, 0x84,
+  0x10, 0x84, 0x08, 0x84, 0x10, 0x84, 0x08, 0x84, 0x10, 0x84, 0x08, 0x84, 0x10, 0x84, 0x08, 0x84,
+  0x14, 0x88, 0x18, 0x88, 0x18, 0x88, 0x18, 0x88, 0x7f, 0x09,
+  // 'q' (113)
+  0x10, 0x88, 0x18, 0x88, 0x18, 0x88, 0x18, 0x88, 0x14, 0x84, 0x08, 0x84, 0x10, 0x84, 0x08, 0x84,
+  0x10, 0x84, 0x08, 0x84, 0x10, 0x84, 0x08, 0x84, 0x10, 0x84, 0x08, 0x84, 0x10, 0x84, 0x08, 0x84,
+  0x10, 0x84, 0x08, 0x84, 0x10, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84,
+  0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84, 0x08, 0x84, 0x04, 0x84, 0x08, 0x84,
+  0x08, 0x98, 0x08, 0x98, 0x08, 0x98, 0x08, 0x98, 0x7f, 0x05,
+  // 'r' (114)
+  0x04, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x94, 0x0c, 0x94, 0x0c, 0x94, 0x0c, 0x94,
+  0x0c, 0x84, 0x08, 0x84, 0x10, 0x84, 0x08, 0x84, 0x10, 0x84, 0x08, 0x84, 0x10, 0x84, 0x08, 0x84,
+  0x20, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x18, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84,
+  0x7f, 0x0d,
+  // 's' (115)
+  0x04, 0x84, 0x08, 0x84, 0x10, 0x84, 0x08, 0x84, 0x10, 0x84, 0x08, 0x84, 0x10, 0x84, 0x08, 0x84,
+  0x10, 0x84, 0x04, 0x84, 0x04, 0x84, 0x0c, 0x84, 0x04, 0x84, 0x04, 0x84, 0x0c, 0x84, 0x04, 0x84,
+  0x04, 0x84, 0x0c, 0x84, 0x04, 0x84, 0x04, 0x84, 0x0c, 0x84, 0x04, 0x84, 0x04, 0x84, 0x0c, 0x84,
+  0x04, 0x84, 0x04, 0x84, 0x0c, 0x84, 0x04, 0x84, 0x04, 0x84, 0x0c, 0x84, 0x04, 0x84, 0x04, 0x84,
+  0x0c, 0x84, 0x04, 0x84, 0x04, 0x84, 0x0c, 0x84, 0x04, 0x84, 0x04, 0x84, 0x0c, 0x84, 0x04, 0x84,
+  0x04, 0x84, 0x0c, 0x84, 0x04, 0x84, 0x04, 0x84, 0x10, 0x84, 0x08, 0x84, 0x10, 0x84, 0x08, 0x84,
+  0x10, 0x84, 0x08, 0x84, 0x10, 0x84, 0x08, 0x84, 0x7f, 0x09,
+  // 't' (116)
+  0x7f, 0x09, 0x98, 0x08, 0x98, 0x08, 0x98, 0x08, 0x98, 0x04, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c,
+  0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c,
+  0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x10, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c,
+  0x84, 0x7f, 0x15,
+  // 'u' (117)
+  0x08, 0x90, 0x10, 0x90, 0x10, 0x90, 0x10, 0x90, 0x0c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84,
+  0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x20, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84,
+  0x18, 0x94, 0x0c, 0x94, 0x0c, 0x94, 0x0c, 0x94, 0x7f, 0x09,
+  // 'v' (118)
+  0x0c, 0x8c, 0x14, 0x8c, 0x14, 0x8c, 0x14, 0x8c, 0x10, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84,
+  0x18, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x20, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84,
+  0x20, 0x8c, 0x14, 0x8c, 0x14, 0x8c, 0x14, 0x8c, 0x7f, 0x09,
+  // 'w' (119)
+  0x08, 0x90, 0x10, 0x90, 0x10, 0x90, 0x10, 0x90, 0x0c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84,
+  0x20, 0x88, 0x18, 0x88, 0x18, 0x88, 0x18, 0x88, 0x14, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84,
+  0x20, 0x90, 0x10, 0x90, 0x10, 0x90, 0x10, 0x90, 0x7f, 0x09,
+  // 'x' (120)
+  0x04, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84,
+  0x10, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84,
+  0x18, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x18, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84,
+  0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x10, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84,
+  0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x7f, 0x09,
+  // 'y' (121)
+  0x04, 0x84, 0x04, 0x90, 0x08, 0x84, 0x04, 0x90, 0x08, 0x84, 0x04, 0x90, 0x08, 0x84, 0x04, 0x90,
+  0x08, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84,
+  0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84,
+  0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84,
+  0x18, 0x94, 0x0c, 0x94, 0x0c, 0x94, 0x0c, 0x94, 0x7f, 0x05,
+  // 'z' (122)
+  0x04, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84,
+  0x0c, 0x88, 0x08, 0x84, 0x0c, 0x88, 0x08, 0x84, 0x0c, 0x88, 0x08, 0x84, 0x0c, 0x88, 0x08, 0x84,
+  0x0c, 0x84, 0x04, 0x84, 0x04, 0x84, 0x0c, 0x84, 0x04, 0x84, 0x04, 0x84, 0x0c, 0x84, 0x04, 0x84,
+  0x04, 0x84, 0x0c, 0x84, 0x04, 0x84, 0x04, 0x84, 0x0c, 0x84, 0x08, 0x88, 0x0c, 0x84, 0x08, 0x88,
+  0x0c, 0x84, 0x08, 0x88, 0x0c, 0x84, 0x08, 0x88, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84,
+  0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x7f, 0x09,
+  // '{' (123)
+  0x10, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x14, 0x88, 0x04, 0x88, 0x0c, 0x88, 0x04, 0x88,
+  0x0c, 0x88, 0x04, 0x88, 0x0c, 0x88, 0x04, 0x88, 0x08, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84,
+  0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84,
+  0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x08, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84,
+  0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x7f, 0x05,
+  // '|' (124)
+  0x7f, 0x7f, 0x7f, 0x07, 0x9c, 0x04, 0x9c, 0x04, 0x9c, 0x04, 0x9c, 0x7f, 0x7f, 0x02,
+  // '}' (125)
+  0x08, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84, 0x0c, 0x84,
+  0x08, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84,
+  0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84, 0x04, 0x84, 0x14, 0x84,
+  0x08, 0x88, 0x04, 0x88, 0x0c, 0x88, 0x04, 0x88, 0x0c, 0x88, 0x04, 0x88, 0x0c, 0x88, 0x04, 0x88,
+  0x14, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x7f, 0x0d,
+  // '~' (126)
+  0x7f, 0x11, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x20, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c,
+  0x84, 0x18, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x20, 0x84, 0x1c, 0x84, 0x1c, 0x84, 0x1c,
+  0x84, 0x7f, 0x09,
+  // '°' (176)
+  0x7f, 0x7f, 0x7f, 0x5b, 0x82, 0x1d, 0x84, 0x1b, 0x82, 0x02, 0x82, 0x1a, 0x82, 0x02, 0x82, 0x1b,
+  0x84, 0x1d, 0x82, 0x7f, 0x07
+};
+
+const uint16_t rle_20x28_offset[97] = {
+      0,     7,    29,    50,   116,   206,   304,   394,   408,   437,   466,   510,
+    552,   581,   609,   623,   665,   755,   791,   897,   995,  1037,  1143,  1241,
+   1307,  1413,  1511,  1533,  1562,  1606,  1673,  1717,  1783,  1897,  1963,  2061,
+   2135,  2201,  2291,  2349,  2439,  2481,  2555,  2621,  2679,  2721,  2763,  2805,
+   2871,  2937,  3003,  3077,  3183,  3225,  3267,  3309,  3351,  3425,  3467,  3573,
+   3617,  3659,  3703,  3745,  3787,  3808,  3906,  3972,  4046,  4112,  4210,  4268,
+   4382,  4424,  4468,  4511,  4569,  4605,  4647,  4689,  4755,  4829,  4903,  4953,
+   5059,  5110,  5152,  5194,  5236,  5310,  5384,  5474,  5548,  5562,  5636,  5671,
+   5692
+};
@@ -0,0 +1,696 @@
+/*
+ * Filename: rle_30x42.c
+ * Description: font_dot_15x21 x2 run-length encoded, 36x48 cells, 8788 bytes.
+ *              Generated by Tools/rlefont.py, do not edit.
+ */
+
+#include "rlefont.h"
+
+
+const uint8_t rle_30x42_runs[8594] = {
+  // ' ' (32)
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x4d,
+  // '!' (33)
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x6c, 0x86, 0x06, 0x9e, 0x06, 0x86, 0x06, 0x9e, 0x06, 0x86,
+  0x06, 0x9e, 0x06, 0x86, 0x06, 0x9e, 0x06, 0x86, 0x06, 0x9e, 0x06, 0x86, 0x06, 0x9e, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x44,
+  // '"' (34)
+  0x7f, 0x7f, 0x7f, 0x7f, 0x60, 0x94, 0x1c, 0x94, 0x1c, 0x94, 0x1c, 0x94, 0x1c, 0x94, 0x1c, 0x94,
+  0x7f, 0x7f, 0x3e, 0x94, 0x1c, 0x94, 0x1c, 0x94, 0x1c, 0x94, 0x1c, 0x94, 0x1c, 0x94, 0x7f, 0x7f,
+  0x22,
+  // '#' (35)
+  0x12, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86,
+  0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86, 0x0c, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa,
+  0x06, 0xaa, 0x06, 0xaa, 0x12, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86,
+  0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86, 0x0c, 0xaa, 0x06, 0xaa,
+  0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x12, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86,
+  0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86,
+  0x7f, 0x7f, 0x28,
+  // '$' (36)
+  0x0c, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86,
+  0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x06, 0x86, 0x06, 0x86, 0x12, 0x86,
+  0x06, 0x86, 0x06, 0x86, 0x12, 0x86, 0x06, 0x86, 0x06, 0x86, 0x12, 0x86, 0x06, 0x86, 0x06, 0x86,
+  0x12, 0x86, 0x06, 0x86, 0x06, 0x86, 0x12, 0x86, 0x06, 0x86, 0x06, 0x86, 0x0c, 0xaa, 0x06, 0xaa,
+  0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x0c, 0x86, 0x06, 0x86, 0x06, 0x86, 0x12, 0x86,
+  0x06, 0x86, 0x06, 0x86, 0x12, 0x86, 0x06, 0x86, 0x06, 0x86, 0x12, 0x86, 0x06, 0x86, 0x06, 0x86,
+  0x12, 0x86, 0x06, 0x86, 0x06, 0x86, 0x12, 0x86, 0x06, 0x86, 0x06, 0x86, 0x18, 0x86, 0x0c, 0x86,
+  0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86,
+  0x18, 0x86, 0x0c, 0x86, 0x7f, 0x7f, 0x28,
+  // '%' (37)
+  0x06, 0x8c, 0x0c, 0x92, 0x06, 0x8c, 0x0c, 0x92, 0x06, 0x8c, 0x0c, 0x92, 0x06, 0x8c, 0x0c, 0x92,
+  0x06, 0x8c, 0x0c, 0x92, 0x06, 0x8c, 0x0c, 0x92, 0x12, 0x88, 0x04, 0x86, 0x06, 0x86, 0x12, 0x88,
+  0x04, 0x86, 0x06, 0x86, 0x12, 0x88, 0x04, 0x86, 0x06, 0x86, 0x12, 0x88, 0x04, 0x86, 0x06, 0x86,
+  0x12, 0x88, 0x04, 0x86, 0x06, 0x86, 0x12, 0x88, 0x04, 0x86, 0x06, 0x86, 0x06, 0x8c, 0x06, 0x98,
+  0x06, 0x8c, 0x06, 0x98, 0x06, 0x8c, 0x06, 0x98, 0x06, 0x8c, 0x06, 0x98, 0x06, 0x8c, 0x06, 0x98,
+  0x06, 0x8c, 0x06, 0x98, 0x06, 0x86, 0x06, 0x86, 0x06, 0x86, 0x12, 0x86, 0x06, 0x86, 0x06, 0x86,
+  0x12, 0x86, 0x06, 0x86, 0x06, 0x86, 0x12, 0x86, 0x06, 0x86, 0x06, 0x86, 0x12, 0x86, 0x06, 0x86,
+  0x06, 0x86, 0x12, 0x86, 0x06, 0x86, 0x06, 0x86, 0x12, 0x92, 0x0c, 0x8c, 0x06, 0x92, 0x0c, 0x8c,
+  0x06, 0x92, 0x0c, 0x8c, 0x06, 0x92, 0x0c, 0x8c, 0x06, 0x92, 0x0c, 0x8c, 0x06, 0x92, 0x0c, 0x8c,
+  0x7f, 0x7f, 0x22,
+  // '&' (38)
+  0x0c, 0x8c, 0x06, 0x8c, 0x12, 0x8c, 0x06, 0x8c, 0x12, 0x8c, 0x06, 0x8c, 0x12, 0x8c, 0x06, 0x8c,
+  0x12, 0x8c, 0x06, 0x8c, 0x12, 0x8c, 0x06, 0x8c, 0x0c, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86,
+  0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86,
+  0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86,
+  0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86,
+  0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86,
+  0x0c, 0x9e, 0x12, 0x9e, 0x12, 0x9e, 0x12, 0x9e, 0x12, 0x9e, 0x12, 0x9e, 0x0c, 0x86, 0x0c, 0x86,
+  0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86,
+  0x18, 0x86, 0x0c, 0x86, 0x7f, 0x7f, 0x34,
+  // "'" (39)
+  0x7f, 0x7f, 0x7f, 0x7f, 0x68, 0x8c, 0x24, 0x8c, 0x24, 0x8c, 0x24, 0x8c, 0x24, 0x8c, 0x24, 0x8c,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x66,
+  // '(' (40)
+  0x7f, 0x7f, 0x7f, 0x7f, 0x50, 0x9e, 0x12, 0x9e, 0x12, 0x9e, 0x12, 0x9e, 0x12, 0x9e, 0x12, 0x9e,
+  0x0c, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86,
+  0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x7f, 0x7f, 0x7f, 0x7f, 0x44,
+  // ')' (41)
+  0x7f, 0x7f, 0x28, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86,
+  0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x0c, 0x9e, 0x12, 0x9e, 0x12, 0x9e,
+  0x12, 0x9e, 0x12, 0x9e, 0x12, 0x9e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x6c,
+  // '*' (42)
+  0x7f, 0x7f, 0x7f, 0x7f, 0x5c, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86,
+  0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x24, 0x92, 0x1e, 0x92,
+  0x1e, 0x92, 0x1e, 0x92, 0x1e, 0x92, 0x1e, 0x92, 0x18, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86,
+  0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86,
+  0x7f, 0x7f, 0x28,
+  // '+' (43)
+  0x18, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86,
+  0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x1e, 0x9e, 0x12, 0x9e, 0x12, 0x9e, 0x12, 0x9e,
+  0x12, 0x9e, 0x12, 0x9e, 0x1e, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86,
+  0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x7f, 0x7f, 0x34,
+  // ',' (44)
+  0x7f, 0x7f, 0x22, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86,
+  0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x24, 0x8c, 0x24, 0x8c, 0x24, 0x8c,
+  0x24, 0x8c, 0x24, 0x8c, 0x24, 0x8c, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x05,
+  // '-' (45)
+  0x7f, 0x7f, 0x3a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86,
+  0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86,
+  0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86,
+  0x2a, 0x86, 0x7f, 0x7f, 0x34,
+  // '.' (46)
+  0x7f, 0x7f, 0x28, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x2d,
+  // '/' (47)
+  0x06, 0x8c, 0x24, 0x8c, 0x24, 0x8c, 0x24, 0x8c, 0x24, 0x8c, 0x24, 0x8c, 0x30, 0x86, 0x2a, 0x86,
+  0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x30, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86,
+  0x2a, 0x86, 0x2a, 0x86, 0x30, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86,
+  0x30, 0x8c, 0x24, 0x8c, 0x24, 0x8c, 0x24, 0x8c, 0x24, 0x8c, 0x24, 0x8c, 0x7f, 0x7f, 0x22,
+  // '0' (48)
+  0x0c, 0x9e, 0x12, 0x9e, 0x12, 0x9e, 0x12, 0x9e, 0x12, 0x9e, 0x12, 0x9e, 0x0c, 0x86, 0x06, 0x86,
+  0x12, 0x86, 0x06, 0x86, 0x06, 0x86, 0x12, 0x86, 0x06, 0x86, 0x06, 0x86, 0x12, 0x86, 0x06, 0x86,
+  0x06, 0x86, 0x12, 0x86, 0x06, 0x86, 0x06, 0x86, 0x12, 0x86, 0x06, 0x86, 0x06, 0x86, 0x12, 0x86,
+  0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86,
+  0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86,
+  0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x12, 0x86, 0x06, 0x86, 0x06, 0x86, 0x12, 0x86, 0x06, 0x86,
+  0x06, 0x86, 0x12, 0x86, 0x06, 0x86, 0x06, 0x86, 0x12, 0x86, 0x06, 0x86, 0x06, 0x86, 0x12, 0x86,
+  0x06, 0x86, 0x06, 0x86, 0x12, 0x86, 0x06, 0x86, 0x0c, 0x9e, 0x12, 0x9e, 0x12, 0x9e, 0x12, 0x9e,
+  0x12, 0x9e, 0x12, 0x9e, 0x7f, 0x7f, 0x28,
+  // '1' (49)
+  0x7f, 0x7f, 0x7f, 0x7f, 0x4a, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86,
+  0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0xaa, 0x06, 0xaa,
+  0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86,
+  0x2a, 0x86, 0x2a, 0x86, 0x7f, 0x7f, 0x46,
+  // '2' (50)
+  0x06, 0x92, 0x0c, 0x86, 0x0c, 0x92, 0x0c, 0x86, 0x0c, 0x92, 0x0c, 0x86, 0x0c, 0x92, 0x0c, 0x86,
+  0x0c, 0x92, 0x0c, 0x86, 0x0c, 0x92, 0x0c, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86,
+  0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86,
+  0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86,
+  0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86,
+  0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86,
+  0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86,
+  0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86,
+  0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x12, 0x8c, 0x0c, 0x86, 0x12, 0x8c, 0x0c, 0x86, 0x12, 0x8c,
+  0x0c, 0x86, 0x12, 0x8c, 0x0c, 0x86, 0x12, 0x8c, 0x0c, 0x86, 0x12, 0x8c, 0x7f, 0x7f, 0x28,
+  // '3' (51)
+  0x0c, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86,
+  0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x0c, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86,
+  0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86,
+  0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86,
+  0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86,
+  0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86,
+  0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86,
+  0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x0c, 0x8c, 0x06, 0x8c, 0x12, 0x8c, 0x06, 0x8c,
+  0x12, 0x8c, 0x06, 0x8c, 0x12, 0x8c, 0x06, 0x8c, 0x12, 0x8c, 0x06, 0x8c, 0x12, 0x8c, 0x06, 0x8c,
+  0x7f, 0x7f, 0x28,
+  // '4' (52)
+  0x18, 0x98, 0x18, 0x98, 0x18, 0x98, 0x18, 0x98, 0x18, 0x98, 0x18, 0x98, 0x18, 0x86, 0x2a, 0x86,
+  0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86,
+  0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86,
+  0x18, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x7f, 0x7f, 0x22,
+  // '5' (53)
+  0x06, 0x86, 0x0c, 0x98, 0x06, 0x86, 0x0c, 0x98, 0x06, 0x86, 0x0c, 0x98, 0x06, 0x86, 0x0c, 0x98,
+  0x06, 0x86, 0x0c, 0x98, 0x06, 0x86, 0x0c, 0x98, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86,
+  0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86,
+  0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86,
+  0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86,
+  0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86,
+  0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86,
+  0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86,
+  0x0c, 0x86, 0x0c, 0x86, 0x0c, 0x8c, 0x12, 0x86, 0x0c, 0x8c, 0x12, 0x86, 0x0c, 0x8c, 0x12, 0x86,
+  0x0c, 0x8c, 0x12, 0x86, 0x0c, 0x8c, 0x12, 0x86, 0x0c, 0x8c, 0x12, 0x86, 0x7f, 0x7f, 0x22,
+  // '6' (54)
+  0x0c, 0x9e, 0x12, 0x9e, 0x12, 0x9e, 0x12, 0x9e, 0x12, 0x9e, 0x12, 0x9e, 0x0c, 0x86, 0x0c, 0x86,
+  0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86,
+  0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86,
+  0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86,
+  0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86,
+  0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86,
+  0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86,
+  0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x0c, 0x8c, 0x12, 0x86, 0x0c, 0x8c, 0x12, 0x86,
+  0x0c, 0x8c, 0x12, 0x86, 0x0c, 0x8c, 0x12, 0x86, 0x0c, 0x8c, 0x12, 0x86, 0x0c, 0x8c, 0x12, 0x86,
+  0x7f, 0x7f, 0x22,
+  // '7' (55)
+  0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x06, 0x92, 0x12, 0x86,
+  0x06, 0x92, 0x12, 0x86, 0x06, 0x92, 0x12, 0x86, 0x06, 0x92, 0x12, 0x86, 0x06, 0x92, 0x12, 0x86,
+  0x06, 0x92, 0x12, 0x86, 0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86,
+  0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86,
+  0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86,
+  0x18, 0x86, 0x0c, 0x86, 0x1e, 0x92, 0x1e, 0x92, 0x1e, 0x92, 0x1e, 0x92, 0x1e, 0x92, 0x1e, 0x92,
+  0x7f, 0x7f, 0x22,
+  // '8' (56)
+  0x0c, 0x8c, 0x06, 0x8c, 0x12, 0x8c, 0x06, 0x8c, 0x12, 0x8c, 0x06, 0x8c, 0x12, 0x8c, 0x06, 0x8c,
+  0x12, 0x8c, 0x06, 0x8c, 0x12, 0x8c, 0x06, 0x8c, 0x0c, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86,
+  0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86,
+  0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86,
+  0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86,
+  0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86,
+  0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86,
+  0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86,
+  0x0c, 0x86, 0x0c, 0x86, 0x0c, 0x8c, 0x06, 0x8c, 0x12, 0x8c, 0x06, 0x8c, 0x12, 0x8c, 0x06, 0x8c,
+  0x12, 0x8c, 0x06, 0x8c, 0x12, 0x8c, 0x06, 0x8c, 0x12, 0x8c, 0x06, 0x8c, 0x7f, 0x7f, 0x28,
+  // '9' (57)
+  0x0c, 0x86, 0x0c, 0x8c, 0x12, 0x86, 0x0c, 0x8c, 0x12, 0x86, 0x0c, 0x8c, 0x12, 0x86, 0x0c, 0x8c,
+  0x12, 0x86, 0x0c, 0x8c, 0x12, 0x86, 0x0c, 0x8c, 0x0c, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86,
+  0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86,
+  0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86,
+  0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86,
+  0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86,
+  0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86,
+  0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86,
+  0x0c, 0x86, 0x0c, 0x86, 0x0c, 0x9e, 0x12, 0x9e, 0x12, 0x9e, 0x12, 0x9e, 0x12, 0x9e, 0x12, 0x9e,
+  0x7f, 0x7f, 0x28,
+  // ':' (58)
+  0x7f, 0x7f, 0x7f, 0x7f, 0x50, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86,
+  0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x72,
+  // ';' (59)
+  0x7f, 0x7f, 0x28, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x8c,
+  0x0c, 0x86, 0x12, 0x8c, 0x0c, 0x86, 0x12, 0x8c, 0x0c, 0x86, 0x12, 0x8c, 0x0c, 0x86, 0x12, 0x8c,
+  0x0c, 0x86, 0x12, 0x8c, 0x0c, 0x86, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x72,
+  // '<' (60)
+  0x7f, 0x7f, 0x3a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x24, 0x86,
+  0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86,
+  0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x18, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86,
+  0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x4a,
+  // '=' (61)
+  0x7f, 0x7f, 0x34, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86,
+  0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86,
+  0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86,
+  0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86,
+  0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86,
+  0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86,
+  0x06, 0x86, 0x7f, 0x7f, 0x2e,
+  // '>' (62)
+  0x7f, 0x7f, 0x7f, 0x7f, 0x50, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86,
+  0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x18, 0x86, 0x06, 0x86,
+  0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86,
+  0x1e, 0x86, 0x06, 0x86, 0x24, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86,
+  0x7f, 0x7f, 0x34,
+  // '?' (63)
+  0x24, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x30, 0x86, 0x2a, 0x86,
+  0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x06, 0x86, 0x06, 0x8c, 0x0c, 0x86, 0x06, 0x86,
+  0x06, 0x8c, 0x0c, 0x86, 0x06, 0x86, 0x06, 0x8c, 0x0c, 0x86, 0x06, 0x86, 0x06, 0x8c, 0x0c, 0x86,
+  0x06, 0x86, 0x06, 0x8c, 0x0c, 0x86, 0x06, 0x86, 0x06, 0x8c, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86,
+  0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86,
+  0x18, 0x86, 0x0c, 0x86, 0x1e, 0x8c, 0x24, 0x8c, 0x24, 0x8c, 0x24, 0x8c, 0x24, 0x8c, 0x24, 0x8c,
+  0x7f, 0x7f, 0x28,
+  // '@' (64)
+  0x06, 0x8c, 0x12, 0x86, 0x0c, 0x8c, 0x12, 0x86, 0x0c, 0x8c, 0x12, 0x86, 0x0c, 0x8c, 0x12, 0x86,
+  0x0c, 0x8c, 0x12, 0x86, 0x0c, 0x8c, 0x12, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86,
+  0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86,
+  0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x06, 0x86,
+  0x06, 0x86, 0x06, 0x86, 0x06, 0x86, 0x06, 0x86, 0x06, 0x86, 0x06, 0x86, 0x06, 0x86, 0x06, 0x86,
+  0x06, 0x86, 0x06, 0x86, 0x06, 0x86, 0x06, 0x86, 0x06, 0x86, 0x06, 0x86, 0x06, 0x86, 0x06, 0x86,
+  0x06, 0x86, 0x06, 0x86, 0x06, 0x86, 0x06, 0x86, 0x06, 0x86, 0x06, 0x86, 0x06, 0x86, 0x06, 0x86,
+  0x06, 0x86, 0x06, 0x86, 0x06, 0x86, 0x06, 0x86, 0x06, 0x86, 0x06, 0x86, 0x06, 0x86, 0x06, 0x86,
+  0x06, 0x86, 0x06, 0x86, 0x06, 0x86, 0x06, 0x86, 0x06, 0x86, 0x06, 0x86, 0x06, 0x86, 0x06, 0x86,
+  0x06, 0x86, 0x06, 0x86, 0x06, 0x86, 0x06, 0x86, 0x06, 0x86, 0x06, 0x86, 0x0c, 0x9e, 0x12, 0x9e,
+  0x12, 0x9e, 0x12, 0x9e, 0x12, 0x9e, 0x12, 0x9e, 0x7f, 0x7f, 0x28,
+  // 'A' (65)
+  0x06, 0xa4, 0x0c, 0xa4, 0x0c, 0xa4, 0x0c, 0xa4, 0x0c, 0xa4, 0x0c, 0xa4, 0x18, 0x84, 0x14, 0x86,
+  0x12, 0x84, 0x14, 0x86, 0x12, 0x84, 0x14, 0x86, 0x12, 0x84, 0x14, 0x86, 0x12, 0x84, 0x14, 0x86,
+  0x12, 0x84, 0x14, 0x86, 0x12, 0x84, 0x14, 0x86, 0x12, 0x84, 0x14, 0x86, 0x12, 0x84, 0x14, 0x86,
+  0x12, 0x84, 0x14, 0x86, 0x12, 0x84, 0x14, 0x86, 0x12, 0x84, 0x14, 0x86, 0x12, 0x84, 0x14, 0x86,
+  0x12, 0x84, 0x14, 0x86, 0x12, 0x84, 0x14, 0x86, 0x12, 0x84, 0x14, 0x86, 0x12, 0x84, 0x14, 0x86,
+  0x12, 0x84, 0x14, 0x86, 0x06, 0xa4, 0x0c, 0xa4, 0x0c, 0xa4, 0x0c, 0xa4, 0x0c, 0xa4, 0x0c, 0xa4,
+  0x7f, 0x7f, 0x28,
+  // 'B' (66)
+  0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0x86, 0x0c, 0x86,
+  0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86,
+  0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86,
+  0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86,
+  0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86,
+  0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86,
+  0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86,
+  0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x0c, 0x8c, 0x06, 0x8c, 0x12, 0x8c, 0x06, 0x8c,
+  0x12, 0x8c, 0x06, 0x8c, 0x12, 0x8c, 0x06, 0x8c, 0x12, 0x8c, 0x06, 0x8c, 0x12, 0x8c, 0x06, 0x8c,
+  0x7f, 0x7f, 0x28,
+  // 'C' (67)
+  0x0c, 0x9e, 0x12, 0x9e, 0x12, 0x9e, 0x12, 0x9e, 0x12, 0x9e, 0x12, 0x9e, 0x0c, 0x86, 0x1e, 0x86,
+  0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86,
+  0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86,
+  0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86,
+  0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86,
+  0x06, 0x86, 0x1e, 0x86, 0x0c, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86,
+  0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x7f, 0x7f, 0x28,
+  // 'D' (68)
+  0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0x86, 0x1e, 0x86,
+  0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86,
+  0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86,
+  0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86,
+  0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86,
+  0x06, 0x86, 0x1e, 0x86, 0x0c, 0x9e, 0x12, 0x9e, 0x12, 0x9e, 0x12, 0x9e, 0x12, 0x9e, 0x12, 0x9e,
+  0x7f, 0x7f, 0x28,
+  // 'E' (69)
+  0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0x86, 0x0c, 0x86,
+  0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86,
+  0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86,
+  0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86,
+  0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86,
+  0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86,
+  0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86,
+  0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86,
+  0x06, 0x86, 0x1e, 0x86, 0x7f, 0x7f, 0x22,
+  // 'F' (70)
+  0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x18, 0x86, 0x0c, 0x86,
+  0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86,
+  0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86,
+  0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86, 0x2a, 0x86, 0x2a, 0x86,
+  0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86,
+  0x2a, 0x86, 0x2a, 0x86, 0x7f, 0x7f, 0x22,
+  // 'G' (71)
+  0x0c, 0xa4, 0x0c, 0xa4, 0x0c, 0xa4, 0x0c, 0xa4, 0x0c, 0xa4, 0x0c, 0xa4, 0x06, 0x86, 0x1e, 0x86,
+  0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86,
+  0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86,
+  0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86,
+  0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86,
+  0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86,
+  0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x0c, 0x92, 0x06, 0x86,
+  0x12, 0x92, 0x06, 0x86, 0x12, 0x92, 0x06, 0x86, 0x12, 0x92, 0x06, 0x86, 0x12, 0x92, 0x06, 0x86,
+  0x12, 0x92, 0x06, 0x86, 0x7f, 0x7f, 0x28,
+  // 'H' (72)
+  0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x18, 0x86, 0x2a, 0x86,
+  0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86,
+  0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86,
+  0x18, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x7f, 0x7f, 0x22,
+  // 'I' (73)
+  0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86,
+  0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86,
+  0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86,
+  0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0x86, 0x1e, 0x86,
+  0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86,
+  0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86,
+  0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x7f, 0x7f, 0x22,
+  // 'J' (74)
+  0x0c, 0x8c, 0x12, 0x86, 0x0c, 0x8c, 0x12, 0x86, 0x0c, 0x8c, 0x12, 0x86, 0x0c, 0x8c, 0x12, 0x86,
+  0x0c, 0x8c, 0x12, 0x86, 0x0c, 0x8c, 0x12, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86,
+  0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86,
+  0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86,
+  0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x0c, 0xa4, 0x0c, 0xa4, 0x0c, 0xa4, 0x0c, 0xa4,
+  0x0c, 0xa4, 0x0c, 0xa4, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86,
+  0x7f, 0x7f, 0x22,
+  // 'K' (75)
+  0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x18, 0x86, 0x2a, 0x86,
+  0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86,
+  0x2a, 0x86, 0x2a, 0x86, 0x24, 0x88, 0x06, 0x84, 0x1e, 0x88, 0x06, 0x84, 0x1e, 0x88, 0x06, 0x84,
+  0x1e, 0x88, 0x06, 0x84, 0x1e, 0x88, 0x06, 0x84, 0x1e, 0x88, 0x06, 0x84, 0x12, 0x8c, 0x12, 0x8c,
+  0x06, 0x8c, 0x12, 0x8c, 0x06, 0x8c, 0x12, 0x8c, 0x06, 0x8c, 0x12, 0x8c, 0x06, 0x8c, 0x12, 0x8c,
+  0x06, 0x8c, 0x12, 0x8c, 0x7f, 0x7f, 0x22,
+  // 'L' (76)
+  0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0x86, 0x2a, 0x86,
+  0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86,
+  0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86,
+  0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x7f, 0x7f, 0x46,
+  // 'M' (77)
+  0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x24, 0x86, 0x2a, 0x86,
+  0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x1e, 0x8c, 0x24, 0x8c, 0x24, 0x8c, 0x24, 0x8c,
+  0x24, 0x8c, 0x24, 0x8c, 0x30, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86,
+  0x0c, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x7f, 0x7f, 0x22,
+  // 'N' (78)
+  0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x24, 0x86, 0x2a, 0x86,
+  0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x24, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86,
+  0x2a, 0x86, 0x2a, 0x86, 0x24, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86,
+  0x18, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x7f, 0x7f, 0x22,
+  // 'O' (79)
+  0x0c, 0x9e, 0x12, 0x9e, 0x12, 0x9e, 0x12, 0x9e, 0x12, 0x9e, 0x12, 0x9e, 0x0c, 0x86, 0x1e, 0x86,
+  0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86,
+  0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86,
+  0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86,
+  0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86,
+  0x06, 0x86, 0x1e, 0x86, 0x0c, 0x9e, 0x12, 0x9e, 0x12, 0x9e, 0x12, 0x9e, 0x12, 0x9e, 0x12, 0x9e,
+  0x7f, 0x7f, 0x28,
+  // 'P' (80)
+  0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x18, 0x86, 0x0c, 0x86,
+  0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86,
+  0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86,
+  0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86,
+  0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86,
+  0x18, 0x86, 0x0c, 0x86, 0x1e, 0x8c, 0x24, 0x8c, 0x24, 0x8c, 0x24, 0x8c, 0x24, 0x8c, 0x24, 0x8c,
+  0x7f, 0x7f, 0x28,
+  // 'Q' (81)
+  0x0c, 0x9e, 0x12, 0x9e, 0x12, 0x9e, 0x12, 0x9e, 0x12, 0x9e, 0x12, 0x9e, 0x0c, 0x86, 0x1e, 0x86,
+  0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86,
+  0x06, 0x86, 0x1e, 0x86, 0x06, 0x8c, 0x18, 0x86, 0x06, 0x8c, 0x18, 0x86, 0x06, 0x8c, 0x18, 0x86,
+  0x06, 0x8c, 0x18, 0x86, 0x06, 0x8c, 0x18, 0x86, 0x06, 0x8c, 0x18, 0x86, 0x06, 0x86, 0x1e, 0x86,
+  0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86,
+  0x06, 0x86, 0x1e, 0x86, 0x0c, 0x9e, 0x12, 0x9e, 0x12, 0x9e, 0x12, 0x9e, 0x12, 0x9e, 0x12, 0x9e,
+  0x7f, 0x7f, 0x28,
+  // 'R' (82)
+  0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x12, 0x86, 0x12, 0x86,
+  0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86,
+  0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86,
+  0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86,
+  0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86,
+  0x12, 0x86, 0x12, 0x86, 0x06, 0x8c, 0x06, 0x92, 0x0c, 0x8c, 0x06, 0x92, 0x0c, 0x8c, 0x06, 0x92,
+  0x0c, 0x8c, 0x06, 0x92, 0x0c, 0x8c, 0x06, 0x92, 0x0c, 0x8c, 0x06, 0x92, 0x7f, 0x7f, 0x28,
+  // 'S' (83)
+  0x06, 0x86, 0x12, 0x8c, 0x0c, 0x86, 0x12, 0x8c, 0x0c, 0x86, 0x12, 0x8c, 0x0c, 0x86, 0x12, 0x8c,
+  0x0c, 0x86, 0x12, 0x8c, 0x0c, 0x86, 0x12, 0x8c, 0x0c, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86,
+  0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86,
+  0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86,
+  0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86,
+  0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86,
+  0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86,
+  0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86,
+  0x0c, 0x86, 0x0c, 0x86, 0x0c, 0x8c, 0x12, 0x86, 0x0c, 0x8c, 0x12, 0x86, 0x0c, 0x8c, 0x12, 0x86,
+  0x0c, 0x8c, 0x12, 0x86, 0x0c, 0x8c, 0x12, 0x86, 0x0c, 0x8c, 0x12, 0x86, 0x7f, 0x7f, 0x22,
+  // 'T' (84)
+  0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86,
+  0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa,
+  0x06, 0xaa, 0x06, 0xaa, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86,
+  0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x7f, 0x7f, 0x22,
+  // 'U' (85)
+  0x0c, 0xa4, 0x0c, 0xa4, 0x0c, 0xa4, 0x0c, 0xa4, 0x0c, 0xa4, 0x0c, 0xa4, 0x06, 0x86, 0x2a, 0x86,
+  0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86,
+  0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86,
+  0x30, 0xa4, 0x0c, 0xa4, 0x0c, 0xa4, 0x0c, 0xa4, 0x0c, 0xa4, 0x0c, 0xa4, 0x7f, 0x7f, 0x22,
+  // 'V' (86)
+  0x12, 0x9e, 0x12, 0x9e, 0x12, 0x9e, 0x12, 0x9e, 0x12, 0x9e, 0x12, 0x9e, 0x0c, 0x86, 0x2a, 0x86,
+  0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x24, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86,
+  0x2a, 0x86, 0x2a, 0x86, 0x30, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86,
+  0x30, 0x9e, 0x12, 0x9e, 0x12, 0x9e, 0x12, 0x9e, 0x12, 0x9e, 0x12, 0x9e, 0x7f, 0x7f, 0x22,
+  // 'W' (87)
+  0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x0c, 0x86, 0x2a, 0x86,
+  0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x30, 0x8c, 0x24, 0x8c, 0x24, 0x8c, 0x24, 0x8c,
+  0x24, 0x8c, 0x24, 0x8c, 0x1e, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86,
+  0x24, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x7f, 0x7f, 0x22,
+  // 'X' (88)
+  0x06, 0x8c, 0x12, 0x8c, 0x06, 0x8c, 0x12, 0x8c, 0x06, 0x8c, 0x12, 0x8c, 0x06, 0x8c, 0x12, 0x8c,
+  0x06, 0x8c, 0x12, 0x8c, 0x06, 0x8c, 0x12, 0x8c, 0x14, 0x86, 0x06, 0x84, 0x20, 0x86, 0x06, 0x84,
+  0x20, 0x86, 0x06, 0x84, 0x20, 0x86, 0x06, 0x84, 0x20, 0x86, 0x06, 0x84, 0x20, 0x86, 0x06, 0x84,
+  0x26, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x24, 0x86, 0x06, 0x84,
+  0x20, 0x86, 0x06, 0x84, 0x20, 0x86, 0x06, 0x84, 0x20, 0x86, 0x06, 0x84, 0x20, 0x86, 0x06, 0x84,
+  0x20, 0x86, 0x06, 0x84, 0x12, 0x8c, 0x12, 0x8c, 0x06, 0x8c, 0x12, 0x8c, 0x06, 0x8c, 0x12, 0x8c,
+  0x06, 0x8c, 0x12, 0x8c, 0x06, 0x8c, 0x12, 0x8c, 0x06, 0x8c, 0x12, 0x8c, 0x7f, 0x7f, 0x22,
+  // 'Y' (89)
+  0x1e, 0x92, 0x1e, 0x92, 0x1e, 0x92, 0x1e, 0x92, 0x1e, 0x92, 0x1e, 0x92, 0x18, 0x86, 0x2a, 0x86,
+  0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x18, 0x92, 0x1e, 0x92, 0x1e, 0x92, 0x1e, 0x92,
+  0x1e, 0x92, 0x1e, 0x92, 0x30, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86,
+  0x30, 0x92, 0x1e, 0x92, 0x1e, 0x92, 0x1e, 0x92, 0x1e, 0x92, 0x1e, 0x92, 0x7f, 0x7f, 0x22,
+  // 'Z' (90)
+  0x06, 0x8c, 0x18, 0x86, 0x06, 0x8c, 0x18, 0x86, 0x06, 0x8c, 0x18, 0x86, 0x06, 0x8c, 0x18, 0x86,
+  0x06, 0x8c, 0x18, 0x86, 0x06, 0x8c, 0x18, 0x86, 0x06, 0x86, 0x06, 0x86, 0x12, 0x86, 0x06, 0x86,
+  0x06, 0x86, 0x12, 0x86, 0x06, 0x86, 0x06, 0x86, 0x12, 0x86, 0x06, 0x86, 0x06, 0x86, 0x12, 0x86,
+  0x06, 0x86, 0x06, 0x86, 0x12, 0x86, 0x06, 0x86, 0x06, 0x86, 0x12, 0x86, 0x06, 0x86, 0x0c, 0x86,
+  0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86,
+  0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86,
+  0x06, 0x86, 0x12, 0x86, 0x06, 0x86, 0x06, 0x86, 0x12, 0x86, 0x06, 0x86, 0x06, 0x86, 0x12, 0x86,
+  0x06, 0x86, 0x06, 0x86, 0x12, 0x86, 0x06, 0x86, 0x06, 0x86, 0x12, 0x86, 0x06, 0x86, 0x06, 0x86,
+  0x12, 0x86, 0x06, 0x86, 0x06, 0x86, 0x18, 0x8c, 0x06, 0x86, 0x18, 0x8c, 0x06, 0x86, 0x18, 0x8c,
+  0x06, 0x86, 0x18, 0x8c, 0x06, 0x86, 0x18, 0x8c, 0x06, 0x86, 0x18, 0x8c, 0x7f, 0x7f, 0x22,
+  // '[' (91)
+  0x7f, 0x7f, 0x7f, 0x7f, 0x4a, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa,
+  0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86,
+  0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86,
+  0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86,
+  0x7f, 0x7f, 0x22,
+  // '\\' (92)
+  0x24, 0x8c, 0x24, 0x8c, 0x24, 0x8c, 0x24, 0x8c, 0x24, 0x8c, 0x24, 0x8c, 0x1e, 0x86, 0x2a, 0x86,
+  0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x24, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86,
+  0x2a, 0x86, 0x2a, 0x86, 0x24, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86,
+  0x1e, 0x8c, 0x24, 0x8c, 0x24, 0x8c, 0x24, 0x8c, 0x24, 0x8c, 0x24, 0x8c, 0x7f, 0x7f, 0x40,
+  // ']' (93)
+  0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86,
+  0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86,
+  0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86,
+  0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x66,
+  // '^' (94)
+  0x1e, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x30, 0x86, 0x2a, 0x86,
+  0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x30, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86,
+  0x2a, 0x86, 0x2a, 0x86, 0x24, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86,
+  0x24, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x7f, 0x7f, 0x2e,
+  // '_' (95)
+  0x06, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86,
+  0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86,
+  0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86,
+  0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x7f, 0x7f, 0x46,
+  // '`' (96)
+  0x7f, 0x7f, 0x4c, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x24, 0x86,
+  0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x6c,
+  // 'a' (97)
+  0x0c, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86,
+  0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86, 0x12, 0x86, 0x06, 0x86, 0x06, 0x86, 0x12, 0x86,
+  0x06, 0x86, 0x06, 0x86, 0x12, 0x86, 0x06, 0x86, 0x06, 0x86, 0x12, 0x86, 0x06, 0x86, 0x06, 0x86,
+  0x12, 0x86, 0x06, 0x86, 0x06, 0x86, 0x12, 0x86, 0x06, 0x86, 0x06, 0x86, 0x12, 0x86, 0x06, 0x86,
+  0x06, 0x86, 0x12, 0x86, 0x06, 0x86, 0x06, 0x86, 0x12, 0x86, 0x06, 0x86, 0x06, 0x86, 0x12, 0x86,
+  0x06, 0x86, 0x06, 0x86, 0x12, 0x86, 0x06, 0x86, 0x06, 0x86, 0x12, 0x86, 0x06, 0x86, 0x06, 0x86,
+  0x12, 0x86, 0x06, 0x86, 0x06, 0x86, 0x12, 0x86, 0x06, 0x86, 0x06, 0x86, 0x12, 0x86, 0x06, 0x86,
+  0x06, 0x86, 0x12, 0x86, 0x06, 0x86, 0x06, 0x86, 0x12, 0x86, 0x06, 0x86, 0x06, 0x86, 0x12, 0x86,
+  0x06, 0x86, 0x06, 0x86, 0x12, 0x98, 0x18, 0x98, 0x18, 0x98, 0x18, 0x98, 0x18, 0x98, 0x18, 0x98,
+  0x7f, 0x7f, 0x34,
+  // 'b' (98)
+  0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0x86, 0x12, 0x86,
+  0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86,
+  0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86,
+  0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86,
+  0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86,
+  0x12, 0x86, 0x12, 0x86, 0x18, 0x92, 0x1e, 0x92, 0x1e, 0x92, 0x1e, 0x92, 0x1e, 0x92, 0x1e, 0x92,
+  0x7f, 0x7f, 0x34,
+  // 'c' (99)
+  0x0c, 0x92, 0x1e, 0x92, 0x1e, 0x92, 0x1e, 0x92, 0x1e, 0x92, 0x1e, 0x92, 0x18, 0x86, 0x12, 0x86,
+  0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86,
+  0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86,
+  0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86,
+  0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86,
+  0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86,
+  0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86, 0x7f, 0x7f, 0x34,
+  // 'd' (100)
+  0x0c, 0x92, 0x1e, 0x92, 0x1e, 0x92, 0x1e, 0x92, 0x1e, 0x92, 0x1e, 0x92, 0x18, 0x86, 0x12, 0x86,
+  0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86,
+  0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86,
+  0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86,
+  0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86,
+  0x12, 0x86, 0x12, 0x86, 0x12, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa,
+  0x7f, 0x7f, 0x22,
+  // 'e' (101)
+  0x0c, 0x92, 0x1e, 0x92, 0x1e, 0x92, 0x1e, 0x92, 0x1e, 0x92, 0x1e, 0x92, 0x18, 0x86, 0x06, 0x86,
+  0x06, 0x86, 0x12, 0x86, 0x06, 0x86, 0x06, 0x86, 0x12, 0x86, 0x06, 0x86, 0x06, 0x86, 0x12, 0x86,
+  0x06, 0x86, 0x06, 0x86, 0x12, 0x86, 0x06, 0x86, 0x06, 0x86, 0x12, 0x86, 0x06, 0x86, 0x06, 0x86,
+  0x12, 0x86, 0x06, 0x86, 0x06, 0x86, 0x12, 0x86, 0x06, 0x86, 0x06, 0x86, 0x12, 0x86, 0x06, 0x86,
+  0x06, 0x86, 0x12, 0x86, 0x06, 0x86, 0x06, 0x86, 0x12, 0x86, 0x06, 0x86, 0x06, 0x86, 0x12, 0x86,
+  0x06, 0x86, 0x06, 0x86, 0x12, 0x86, 0x06, 0x86, 0x06, 0x86, 0x12, 0x86, 0x06, 0x86, 0x06, 0x86,
+  0x12, 0x86, 0x06, 0x86, 0x06, 0x86, 0x12, 0x86, 0x06, 0x86, 0x06, 0x86, 0x12, 0x86, 0x06, 0x86,
+  0x06, 0x86, 0x12, 0x86, 0x06, 0x86, 0x06, 0x86, 0x12, 0x86, 0x06, 0x8c, 0x18, 0x86, 0x06, 0x8c,
+  0x18, 0x86, 0x06, 0x8c, 0x18, 0x86, 0x06, 0x8c, 0x18, 0x86, 0x06, 0x8c, 0x18, 0x86, 0x06, 0x8c,
+  0x7f, 0x7f, 0x34,
+  // 'f' (102)
+  0x18, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x18, 0xa4, 0x0c, 0xa4,
+  0x0c, 0xa4, 0x0c, 0xa4, 0x0c, 0xa4, 0x0c, 0xa4, 0x1e, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86,
+  0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86,
+  0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86,
+  0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86,
+  0x2a, 0x86, 0x2a, 0x86, 0x7f, 0x7f, 0x22,
+  // 'g' (103)
+  0x0c, 0x8c, 0x06, 0x8c, 0x12, 0x8c, 0x06, 0x8c, 0x12, 0x8c, 0x06, 0x8c, 0x12, 0x8c, 0x06, 0x8c,
+  0x12, 0x8c, 0x06, 0x8c, 0x12, 0x8c, 0x06, 0x8c, 0x0c, 0x86, 0x0c, 0x8c, 0x06, 0x86, 0x06, 0x86,
+  0x0c, 0x8c, 0x06, 0x86, 0x06, 0x86, 0x0c, 0x8c, 0x06, 0x86, 0x06, 0x86, 0x0c, 0x8c, 0x06, 0x86,
+  0x06, 0x86, 0x0c, 0x8c, 0x06, 0x86, 0x06, 0x86, 0x0c, 0x8c, 0x06, 0x86, 0x06, 0x86, 0x06, 0x86,
+  0x06, 0x86, 0x06, 0x86, 0x06, 0x86, 0x06, 0x86, 0x06, 0x86, 0x06, 0x86, 0x06, 0x86, 0x06, 0x86,
+  0x06, 0x86, 0x06, 0x86, 0x06, 0x86, 0x06, 0x86, 0x06, 0x86, 0x06, 0x86, 0x06, 0x86, 0x06, 0x86,
+  0x06, 0x86, 0x06, 0x86, 0x06, 0x86, 0x06, 0x86, 0x06, 0x86, 0x06, 0x86, 0x06, 0x86, 0x06, 0x86,
+  0x06, 0x92, 0x06, 0x86, 0x06, 0x86, 0x06, 0x92, 0x06, 0x86, 0x06, 0x86, 0x06, 0x92, 0x06, 0x86,
+  0x06, 0x86, 0x06, 0x92, 0x06, 0x86, 0x06, 0x86, 0x06, 0x92, 0x06, 0x86, 0x06, 0x86, 0x06, 0x92,
+  0x0c, 0x8c, 0x12, 0x86, 0x0c, 0x8c, 0x12, 0x86, 0x0c, 0x8c, 0x12, 0x86, 0x0c, 0x8c, 0x12, 0x86,
+  0x0c, 0x8c, 0x12, 0x86, 0x0c, 0x8c, 0x12, 0x86, 0x7f, 0x7f, 0x22,
+  // 'h' (104)
+  0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x18, 0x86, 0x2a, 0x86,
+  0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x30, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86,
+  0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86,
+  0x12, 0x98, 0x18, 0x98, 0x18, 0x98, 0x18, 0x98, 0x18, 0x98, 0x18, 0x98, 0x7f, 0x7f, 0x34,
+  // 'i' (105)
+  0x7f, 0x7f, 0x28, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86,
+  0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x9e, 0x06, 0x86, 0x06, 0x9e,
+  0x06, 0x86, 0x06, 0x9e, 0x06, 0x86, 0x06, 0x9e, 0x06, 0x86, 0x06, 0x9e, 0x06, 0x86, 0x06, 0x9e,
+  0x06, 0x86, 0x06, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x7f, 0x7f,
+  0x7f, 0x7f, 0x68,
+  // 'j' (106)
+  0x0c, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x24, 0x86, 0x2a, 0x86,
+  0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86,
+  0x2a, 0x86, 0x2a, 0x86, 0x30, 0x96, 0x08, 0x86, 0x0c, 0x96, 0x08, 0x86, 0x0c, 0x96, 0x08, 0x86,
+  0x0c, 0x96, 0x08, 0x86, 0x0c, 0x96, 0x08, 0x86, 0x0c, 0x96, 0x08, 0x86, 0x7f, 0x7f, 0x7f, 0x7f,
+  0x44,
+  // 'k' (107)
+  0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x18, 0x86, 0x2a, 0x86,
+  0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86,
+  0x2a, 0x86, 0x2a, 0x86, 0x24, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86,
+  0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x12, 0x8c, 0x12, 0x86,
+  0x0c, 0x8c, 0x12, 0x86, 0x0c, 0x8c, 0x12, 0x86, 0x0c, 0x8c, 0x12, 0x86, 0x0c, 0x8c, 0x12, 0x86,
+  0x0c, 0x8c, 0x12, 0x86, 0x7f, 0x7f, 0x28,
+  // 'l' (108)
+  0x7f, 0x7f, 0x28, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86,
+  0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa,
+  0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86,
+  0x2a, 0x86, 0x7f, 0x7f, 0x7f, 0x7f, 0x68,
+  // 'm' (109)
+  0x06, 0x9c, 0x14, 0x9c, 0x14, 0x9c, 0x14, 0x9c, 0x14, 0x9c, 0x14, 0x9c, 0x2c, 0x86, 0x2a, 0x86,
+  0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x12, 0x98, 0x18, 0x98, 0x18, 0x98, 0x18, 0x98,
+  0x18, 0x98, 0x18, 0x98, 0x30, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86,
+  0x12, 0x9c, 0x14, 0x9c, 0x14, 0x9c, 0x14, 0x9c, 0x14, 0x9c, 0x14, 0x9c, 0x7f, 0x7f, 0x30,
+  // 'n' (110)
+  0x06, 0x9e, 0x12, 0x9e, 0x12, 0x9e, 0x12, 0x9e, 0x12, 0x9e, 0x12, 0x9e, 0x24, 0x86, 0x2a, 0x86,
+  0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x30, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86,
+  0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86,
+  0x12, 0x98, 0x18, 0x98, 0x18, 0x98, 0x18, 0x98, 0x18, 0x98, 0x18, 0x98, 0x7f, 0x7f, 0x34,
+  // 'o' (111)
+  0x0c, 0x92, 0x1e, 0x92, 0x1e, 0x92, 0x1e, 0x92, 0x1e, 0x92, 0x1e, 0x92, 0x18, 0x86, 0x12, 0x86,
+  0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86,
+  0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86,
+  0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86,
+  0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86,
+  0x12, 0x86, 0x12, 0x86, 0x18, 0x92, 0x1e, 0x92, 0x1e, 0x92, 0x1e, 0x92, 0x1e, 0x92, 0x1e, 0x92,
+  0x7f, 0x7f, 0x34,
+  // 'p' (112)
+  0x06, 0xa4, 0x0c, 0xa4, 0x0c, 0xa4, 0x0c, 0xa4, 0x0c, 0xa4, 0x0c, 0xa4, 0x0c, 0x86, 0x06, 0x86,
+  0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86,
+  0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86,
+  0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86,
+  0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86,
+  0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86,
+  0x1e, 0x8c, 0x24, 0x8c, 0x24, 0x8c, 0x24, 0x8c, 0x24, 0x8c, 0x24, 0x8c, 0x7f, 0x7f, 0x2e,
+  // 'q' (113)
+  0x18, 0x8c, 0x24, 0x8c, 0x24, 0x8c, 0x24, 0x8c, 0x24, 0x8c, 0x24, 0x8c, 0x1e, 0x86, 0x0c, 0x86,
+  0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86,
+  0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86,
+  0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86,
+  0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86,
+  0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86, 0x0c, 0x86, 0x06, 0x86, 0x0c, 0x86,
+  0x0c, 0xa4, 0x0c, 0xa4, 0x0c, 0xa4, 0x0c, 0xa4, 0x0c, 0xa4, 0x0c, 0xa4, 0x7f, 0x7f, 0x28,
+  // 'r' (114)
+  0x06, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x9e, 0x12, 0x9e,
+  0x12, 0x9e, 0x12, 0x9e, 0x12, 0x9e, 0x12, 0x9e, 0x12, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86,
+  0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86,
+  0x30, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x24, 0x86, 0x2a, 0x86,
+  0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x7f, 0x7f, 0x34,
+  // 's' (115)
+  0x06, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86,
+  0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x06, 0x86, 0x06, 0x86, 0x12, 0x86,
+  0x06, 0x86, 0x06, 0x86, 0x12, 0x86, 0x06, 0x86, 0x06, 0x86, 0x12, 0x86, 0x06, 0x86, 0x06, 0x86,
+  0x12, 0x86, 0x06, 0x86, 0x06, 0x86, 0x12, 0x86, 0x06, 0x86, 0x06, 0x86, 0x12, 0x86, 0x06, 0x86,
+  0x06, 0x86, 0x12, 0x86, 0x06, 0x86, 0x06, 0x86, 0x12, 0x86, 0x06, 0x86, 0x06, 0x86, 0x12, 0x86,
+  0x06, 0x86, 0x06, 0x86, 0x12, 0x86, 0x06, 0x86, 0x06, 0x86, 0x12, 0x86, 0x06, 0x86, 0x06, 0x86,
+  0x12, 0x86, 0x06, 0x86, 0x06, 0x86, 0x12, 0x86, 0x06, 0x86, 0x06, 0x86, 0x12, 0x86, 0x06, 0x86,
+  0x06, 0x86, 0x12, 0x86, 0x06, 0x86, 0x06, 0x86, 0x12, 0x86, 0x06, 0x86, 0x06, 0x86, 0x12, 0x86,
+  0x06, 0x86, 0x06, 0x86, 0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86,
+  0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86, 0x18, 0x86, 0x0c, 0x86, 0x7f, 0x7f, 0x2e,
+  // 't' (116)
+  0x7f, 0x7f, 0x2e, 0xa4, 0x0c, 0xa4, 0x0c, 0xa4, 0x0c, 0xa4, 0x0c, 0xa4, 0x0c, 0xa4, 0x06, 0x86,
+  0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86,
+  0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86,
+  0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x18, 0x86,
+  0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x7f, 0x7f, 0x40,
+  // 'u' (117)
+  0x0c, 0x98, 0x18, 0x98, 0x18, 0x98, 0x18, 0x98, 0x18, 0x98, 0x18, 0x98, 0x12, 0x86, 0x2a, 0x86,
+  0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86,
+  0x2a, 0x86, 0x2a, 0x86, 0x30, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86,
+  0x24, 0x9e, 0x12, 0x9e, 0x12, 0x9e, 0x12, 0x9e, 0x12, 0x9e, 0x12, 0x9e, 0x7f, 0x7f, 0x2e,
+  // 'v' (118)
+  0x12, 0x92, 0x1e, 0x92, 0x1e, 0x92, 0x1e, 0x92, 0x1e, 0x92, 0x1e, 0x92, 0x18, 0x86, 0x2a, 0x86,
+  0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x24, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86,
+  0x2a, 0x86, 0x2a, 0x86, 0x30, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86,
+  0x30, 0x92, 0x1e, 0x92, 0x1e, 0x92, 0x1e, 0x92, 0x1e, 0x92, 0x1e, 0x92, 0x7f, 0x7f, 0x2e,
+  // 'w' (119)
+  0x0c, 0x98, 0x18, 0x98, 0x18, 0x98, 0x18, 0x98, 0x18, 0x98, 0x18, 0x98, 0x12, 0x86, 0x2a, 0x86,
+  0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x30, 0x8c, 0x24, 0x8c, 0x24, 0x8c, 0x24, 0x8c,
+  0x24, 0x8c, 0x24, 0x8c, 0x1e, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86,
+  0x30, 0x98, 0x18, 0x98, 0x18, 0x98, 0x18, 0x98, 0x18, 0x98, 0x18, 0x98, 0x7f, 0x7f, 0x2e,
+  // 'x' (120)
+  0x06, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86,
+  0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x18, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86,
+  0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86,
+  0x24, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x24, 0x86, 0x06, 0x86,
+  0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86,
+  0x1e, 0x86, 0x06, 0x86, 0x18, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86,
+  0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x7f, 0x7f, 0x2e,
+  // 'y' (121)
+  0x06, 0x86, 0x06, 0x98, 0x0c, 0x86, 0x06, 0x98, 0x0c, 0x86, 0x06, 0x98, 0x0c, 0x86, 0x06, 0x98,
+  0x0c, 0x86, 0x06, 0x98, 0x0c, 0x86, 0x06, 0x98, 0x0c, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86,
+  0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86,
+  0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86,
+  0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86,
+  0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86,
+  0x24, 0x9e, 0x12, 0x9e, 0x12, 0x9e, 0x12, 0x9e, 0x12, 0x9e, 0x12, 0x9e, 0x7f, 0x7f, 0x28,
+  // 'z' (122)
+  0x06, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86,
+  0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x8c, 0x0c, 0x86, 0x12, 0x8c, 0x0c, 0x86,
+  0x12, 0x8c, 0x0c, 0x86, 0x12, 0x8c, 0x0c, 0x86, 0x12, 0x8c, 0x0c, 0x86, 0x12, 0x8c, 0x0c, 0x86,
+  0x12, 0x86, 0x06, 0x86, 0x06, 0x86, 0x12, 0x86, 0x06, 0x86, 0x06, 0x86, 0x12, 0x86, 0x06, 0x86,
+  0x06, 0x86, 0x12, 0x86, 0x06, 0x86, 0x06, 0x86, 0x12, 0x86, 0x06, 0x86, 0x06, 0x86, 0x12, 0x86,
+  0x06, 0x86, 0x06, 0x86, 0x12, 0x86, 0x0c, 0x8c, 0x12, 0x86, 0x0c, 0x8c, 0x12, 0x86, 0x0c, 0x8c,
+  0x12, 0x86, 0x0c, 0x8c, 0x12, 0x86, 0x0c, 0x8c, 0x12, 0x86, 0x0c, 0x8c, 0x12, 0x86, 0x12, 0x86,
+  0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86,
+  0x12, 0x86, 0x12, 0x86, 0x7f, 0x7f, 0x2e,
+  // '{' (123)
+  0x18, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x1e, 0x8c, 0x06, 0x8c,
+  0x12, 0x8c, 0x06, 0x8c, 0x12, 0x8c, 0x06, 0x8c, 0x12, 0x8c, 0x06, 0x8c, 0x12, 0x8c, 0x06, 0x8c,
+  0x12, 0x8c, 0x06, 0x8c, 0x0c, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86,
+  0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86,
+  0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86,
+  0x06, 0x86, 0x1e, 0x86, 0x0c, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86,
+  0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x7f, 0x7f, 0x28,
+  // '|' (124)
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x6c, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa, 0x06, 0xaa,
+  0x06, 0xaa, 0x7f, 0x7f, 0x7f, 0x7f, 0x44,
+  // '}' (125)
+  0x0c, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86,
+  0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x12, 0x86, 0x0c, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86,
+  0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86,
+  0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86,
+  0x06, 0x86, 0x1e, 0x86, 0x06, 0x86, 0x1e, 0x86, 0x0c, 0x8c, 0x06, 0x8c, 0x12, 0x8c, 0x06, 0x8c,
+  0x12, 0x8c, 0x06, 0x8c, 0x12, 0x8c, 0x06, 0x8c, 0x12, 0x8c, 0x06, 0x8c, 0x12, 0x8c, 0x06, 0x8c,
+  0x1e, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x7f, 0x7f, 0x34,
+  // '~' (126)
+  0x7f, 0x7f, 0x3a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x30, 0x86,
+  0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x24, 0x86, 0x2a, 0x86, 0x2a, 0x86,
+  0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x30, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86, 0x2a, 0x86,
+  0x2a, 0x86, 0x7f, 0x7f, 0x2e,
+  // '°' (176)
+  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x0d, 0x84, 0x2c, 0x84, 0x2a, 0x88, 0x28, 0x88, 0x26,
+  0x84, 0x04, 0x84, 0x24, 0x84, 0x04, 0x84, 0x24, 0x84, 0x04, 0x84, 0x24, 0x84, 0x04, 0x84, 0x26,
+  0x88, 0x28, 0x88, 0x2a, 0x84, 0x2c, 0x84, 0x7f, 0x7f, 0x28
+};
+
+const uint16_t rle_30x42_offset[97] = {
+      0,    14,    49,    82,   181,   316,   463,   598,   621,   666,   711,   778,
+    841,   887,   940,   964,  1027,  1162,  1217,  1376,  1523,  1586,  1745,  1892,
+   1991,  2150,  2297,  2332,  2377,  2444,  2545,  2612,  2711,  2882,  2981,  3128,
+   3239,  3338,  3473,  3560,  3695,  3758,  3869,  3968,  4055,  4118,  4181,  4244,
+   4343,  4442,  4541,  4652,  4811,  4874,  4937,  5000,  5063,  5174,  5237,  5396,
+   5463,  5526,  5593,  5656,  5719,  5752,  5899,  5998,  6109,  6208,  6355,  6442,
+   6613,  6676,  6743,  6808,  6895,  6950,  7013,  7076,  7175,  7286,  7397,  7472,
+   7631,  7708,  7771,  7834,  7897,  8008,  8119,  8254,  8365,  8388,  8499,  8552,
+   8594
+};
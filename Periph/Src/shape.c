@@ -0,0 +1,182 @@
+/**
+  ******************************************************************************
+  * @file           : shape.c
+  * @brief          : This file contain the filled shape rasterizer code. A
+  *                   shape is walked column by column, each column is one
+  *                   vertical span in the panel stream order.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2017-2026 Askug Ltd.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#include "shape.h"
+#include <math.h>
+
+
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Tests the pixel centre (d, hy) against the ellipse of radii
+ *          rx + 1/2 and ry + 1/2, all in integers. For a circle this is the
+ *          usual d^2 + hy^2 <= r^2 + r.
+ */
+__STATIC_INLINE bool shape_inside(Shape_TypeDef* s, uint32_t d, uint32_t hy) {
+  uint64_t a = (uint64_t)(2 * s->Rx + 1) * (2 * s->Rx + 1);
+  uint64_t b = (uint64_t)(2 * s->Ry + 1) * (2 * s->Ry + 1);
+
+  return ((4 * (uint64_t)d * d * b) + (4 * (uint64_t)hy * hy * a)) <= (a * b);
+}
+
+
+// --------------------------------------------------------------------------
+
+void Shape_RoundRect(Shape_TypeDef* s, int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t r) {
+  s->X  = x;
+  s->Y  = y;
+  s->W  = w;
+  s->H  = h;
+  s->Rx = (w && (r > ((w - 1) / 2))) ? ((w - 1) / 2) : r;
+  s->Ry = (h && (r > ((h - 1) / 2))) ? ((h - 1) / 2) : r;
+  s->Hy = 0;
+}
+
+
+// --------------------------------------------------------------------------
+
+void Shape_Ellipse(Shape_TypeDef* s, int16_t x0, int16_t y0, uint16_t rx, uint16_t ry) {
+  s->X  = x0 - rx;
+  s->Y  = y0 - ry;
+  s->W  = 2 * rx + 1;
+  s->H  = 2 * ry + 1;
+  s->Rx = rx;
+  s->Ry = ry;
+  s->Hy = 0;
+}
+
+
+// --------------------------------------------------------------------------
+
+void Shape_Circle(Shape_TypeDef* s, int16_t x0, int16_t y0, uint16_t r) {
+  Shape_Ellipse(s, x0, y0, r, r);
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Returns the rows top..bottom (inclusive) covered in the column x.
+ *          The corner half height is carried over from the previous call, so
+ *          walking the columns in order costs a step or two per column.
+ */
+void Shape_Span(Shape_TypeDef* s, int16_t x, int16_t* top, int16_t* bottom) {
+  int32_t cx0 = s->X + s->Rx;
+  int32_t cx1 = s->X + s->W - 1 - s->Rx;
+  uint32_t d = (x < cx0) ? (cx0 - x) : ((x > cx1) ? (x - cx1) : 0);
+
+  while ((s->Hy < s->Ry) && shape_inside(s, d, (s->Hy + 1))) s->Hy++;
+  while (s->Hy && !shape_inside(s, d, s->Hy)) s->Hy--;
+
+  *top = s->Y + s->Ry - s->Hy;
+  *bottom = s->Y + s->H - 1 - s->Ry + s->Hy;
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   A ring of outer radius r and thickness b, b >= r gives a disk.
+ */
+void Shape_Ring(Ring_TypeDef* s, int16_t x0, int16_t y0, uint16_t r, uint16_t b) {
+  if (!b) b = 1;
+
+  Shape_Circle(&s->Outer, x0, y0, r);
+  if (b <= r) {
+    Shape_Circle(&s->Inner, x0, y0, (r - b));
+  } else {
+    Shape_Circle(&s->Inner, x0, y0, 0);
+    s->Inner.W = 0;
+  }
+
+  s->X0    = x0;
+  s->Y0    = y0;
+  s->Sweep = 360;
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   A piece of a ring from the angle start to end, in degrees. 0 is
+ *          3 o'clock and angles grow clockwise on the screen. The sine and
+ *          cosine are worked out here once, pixels are then tested against
+ *          the two edges with cross products.
+ */
+void Shape_Arc(Ring_TypeDef* s, int16_t x0, int16_t y0, uint16_t r, uint16_t b, int16_t start, int16_t end) {
+  Shape_Ring(s, x0, y0, r, b);
+
+  int32_t sweep = end - start;
+  if ((sweep <= 0) || (sweep >= 360)) {
+    sweep %= 360;
+    if (sweep <= 0) sweep += 360;
+  }
+  s->Sweep = sweep;
+
+  float a0 = (float)start * ((float)M_PI / 180.0f);
+  float a1 = (float)end * ((float)M_PI / 180.0f);
+
+  s->Sx = (int32_t)(cosf(a0) * 4096.0f);
+  s->Sy = (int32_t)(sinf(a0) * 4096.0f);
+  s->Ex = (int32_t)(cosf(a1) * 4096.0f);
+  s->Ey = (int32_t)(sinf(a1) * 4096.0f);
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Returns the rows of the column x in the ring, as the spans
+ *          t0..b0 and t1..b1. The second one is empty (t1 > b1) when the
+ *          column misses the hole.
+ */
+void Shape_RingSpan(Ring_TypeDef* s, int16_t x, int16_t* t0, int16_t* b0, int16_t* t1, int16_t* b1) {
+  Shape_Span(&s->Outer, x, t0, b1);
+
+  if (!s->Inner.W || (x < s->Inner.X) || (x >= (s->Inner.X + s->Inner.W))) {
+    *b0 = *b1;
+    *t1 = *b1 + 1;
+    return;
+  }
+
+  Shape_Span(&s->Inner, x, b0, t1);
+  (*b0)--;
+  (*t1)++;
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Tests a ring pixel against the arc, the screen y grows down, so
+ *          a positive cross product turns clockwise.
+ */
+bool Shape_ArcInside(Ring_TypeDef* s, int16_t x, int16_t y) {
+  if (s->Sweep >= 360) return true;
+
+  int32_t dx = x - s->X0;
+  int32_t dy = y - s->Y0;
+  bool after_start = ((s->Sx * dy) - (s->Sy * dx)) >= 0;
+  bool before_end = ((dx * s->Ey) - (dy * s->Ex)) >= 0;
+
+  if (s->Sweep <= 180) return (after_start && before_end);
+  return (after_start || before_end);
+}
@@ -16,26 +16,29 @@
   */
 
 #include "st7796.h"
+#include <string.h>
 
 
 __IO bool st7796_dma_busy = false;
 
 extern SPI_HandleTypeDef hspi1;
-extern DMA_HandleTypeDef hdma_spi1_tx;
+
+/* --- device served by the SPI1 DMA callbacks --- */
+static Display_TypeDef* st7796_dev = NULL;
 
 
 
 // --------------------------------------------------------------------------
 
 __STATIC_INLINE void dc_cmd(void) {
-  HAL_GPIO_WritePin(TFT_DC_GPIO_Port, TFT_DC_Pin, GPIO_PIN_RESET);
+  WRITE_REG(TFT_DC_GPIO_Port->BSRR, ((uint32_t)TFT_DC_Pin << 16));
 }
 
 
 // --------------------------------------------------------------------------
 
 __STATIC_INLINE void dc_data(void) {
-  HAL_GPIO_WritePin(TFT_DC_GPIO_Port, TFT_DC_Pin, GPIO_PIN_SET);
+  WRITE_REG(TFT_DC_GPIO_Port->BSRR, TFT_DC_Pin);
 }
 
 
@@ -65,11 +68,318 @@ __STATIC_INLINE void display_reset(void) {
 }
 
 
+// --------------------------------------------------------------------------
+
+__STATIC_INLINE void spi_put(SPI_TypeDef* spi, uint8_t data) {
+  while (!READ_BIT(spi->SR, SPI_SR_TXE));
+  *(__IO uint8_t*)&spi->DR = data;
+}
+
+
+// --------------------------------------------------------------------------
+
+__STATIC_INLINE void spi_drain(SPI_TypeDef* spi) {
+  while (!READ_BIT(spi->SR, SPI_SR_TXE));
+  while (READ_BIT(spi->SR, SPI_SR_BSY));
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Sends a command with an optional 4-byte parameter straight through
+ *          the SPI registers. DC may only change once the shift register is
+ *          empty.
+ */
+__STATIC_INLINE void spi_burst(SPI_TypeDef* spi, uint8_t cmd, const uint32_t* param) {
+  dc_cmd();
+  spi_put(spi, cmd);
+  spi_drain(spi);
+
+  if (param) {
+    dc_data();
+    spi_put(spi, (uint8_t)(*param >> 24));
+    spi_put(spi, (uint8_t)(*param >> 16));
+    spi_put(spi, (uint8_t)(*param >> 8));
+    spi_put(spi, (uint8_t)(*param));
+    spi_drain(spi);
+  }
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Sends a command with a parameter of 16-bit big-endian words.
+ */
+__STATIC_INLINE void spi_words(SPI_TypeDef* spi, uint8_t cmd, const uint16_t* param, uint32_t n) {
+  dc_cmd();
+  spi_put(spi, cmd);
+  spi_drain(spi);
+
+  dc_data();
+  for (uint32_t i = 0; i < n; i++) {
+    spi_put(spi, (uint8_t)(param[i] >> 8));
+    spi_put(spi, (uint8_t)param[i]);
+  }
+  spi_drain(spi);
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Sets the address window. CASET and RASET are skipped when they
+ *          are the same as last time, RAMWR/RAMRD always goes out since it
+ *          resets the panel's write pointer.
+ */
+__STATIC_INLINE void display_set_window(Display_TypeDef* dev, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, TrasmissionDirection_t dir) {
+
+  SPI_HandleTypeDef* bus = (SPI_HandleTypeDef*)dev->Bus;
+  uint32_t caset, raset;
+
+  #if (DISPLAY_POSITION)
+    // vertical
+    caset = ((uint32_t)x0 << 16) | x1;
+    raset = ((uint32_t)y0 << 16) | y1;
+  #else
+    // horizontal
+    caset = ((uint32_t)y0 << 16) | y1;
+    raset = ((uint32_t)x0 << 16) | x1;
+  #endif
+
+  __HAL_SPI_ENABLE(bus);
+
+  if (caset != dev->Caset) {
+    spi_burst(bus->Instance, 0x2a, &caset);
+    dev->Caset = caset;
+  }
+
+  if (raset != dev->Raset) {
+    spi_burst(bus->Instance, 0x2b, &raset);
+    dev->Raset = raset;
+  }
+
+  switch (dir) {
+    case READ:
+      spi_burst(bus->Instance, 0x2e, NULL);
+    break;
+
+    case WRITE:
+      spi_burst(bus->Instance, 0x2c, NULL);
+    break;
+  
+    default:
+      Error_Handler();
+    break;
+  }
+
+  // nobody reads the RX side in 2-lines mode
+  __HAL_SPI_CLEAR_OVRFLAG(bus);
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Switches SPI1 and its TX stream between 8-bit and 16-bit frames.
+ *          Both are touched only when the size really changes.
+ */
+static void spi_frame(Display_TypeDef* dev, uint32_t size) {
+  SPI_HandleTypeDef* bus = (SPI_HandleTypeDef*)dev->Bus;
+  DMA_HandleTypeDef* dma = bus->hdmatx;
+
+  if (bus->Init.DataSize == size) return;
+
+  // the last frame has to leave the shift register first
+  while (!READ_BIT(bus->Instance->SR, SPI_SR_TXE));
+  while (READ_BIT(bus->Instance->SR, SPI_SR_BSY));
+
+  __HAL_SPI_DISABLE(bus);
+  MODIFY_REG(bus->Instance->CR1, SPI_CR1_DFF, size);
+  bus->Init.DataSize = size;
+
+  if (size == SPI_DATASIZE_16BIT) {
+    dma->Init.PeriphDataAlignment = DMA_PDATAALIGN_HALFWORD;
+    dma->Init.MemDataAlignment = DMA_MDATAALIGN_HALFWORD;
+  } else {
+    dma->Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+    dma->Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;
+  }
+  MODIFY_REG(dma->Instance->CR, (DMA_SxCR_PSIZE | DMA_SxCR_MSIZE), (dma->Init.PeriphDataAlignment | dma->Init.MemDataAlignment));
+  __HAL_SPI_ENABLE(bus);
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Turns the memory increment of the TX stream on or off. The stream
+ *          is idle here, so there is no need for a full HAL_DMA_Init().
+ */
+__STATIC_INLINE void dma_tx_meminc(Display_TypeDef* dev, uint32_t minc) {
+  DMA_HandleTypeDef* dma = ((SPI_HandleTypeDef*)dev->Bus)->hdmatx;
+
+  if (dma->Init.MemInc == minc) return;
+
+  MODIFY_REG(dma->Instance->CR, DMA_SxCR_MINC, minc);
+  dma->Init.MemInc = minc;
+}
+
+
+// --------------------------------------------------------------------------
+
+__STATIC_INLINE void queue_release(Display_TypeDef* dev) {
+  DisplayJob_TypeDef* job = &dev->Queue[dev->QueueTail];
+
+  if (job->Lock) (*job->Lock)--;
+  dev->QueueTail = (dev->QueueTail + 1) % dev->QueueSize;
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Starts the oldest queued job. Runs either from the thread when the
+ *          bus is idle or from the TX complete callback, st7796_dma_busy is
+ *          already set by the caller.
+ */
+static void queue_run(Display_TypeDef* dev) {
+
+  while (dev->QueueTail != dev->QueueHead) {
+    DisplayJob_TypeDef* job = &dev->Queue[dev->QueueTail];
+
+    HAL_StatusTypeDef status;
+
+    if (job->Dir != NOOP) {
+      spi_frame(dev, SPI_DATASIZE_8BIT);
+      display_set_window(dev, job->X0, job->Y0, job->X1, job->Y1, job->Dir);
+    }
+
+    // pixels go out as native RGB565 half-words, MSB first
+    dc_data();
+    spi_frame(dev, SPI_DATASIZE_16BIT);
+    if (job->Data) {
+      dma_tx_meminc(dev, DMA_MINC_ENABLE);
+      status = HAL_SPI_Transmit_DMA((SPI_HandleTypeDef*)dev->Bus, (uint8_t*)job->Data, job->Size);
+    } else {
+      // one source word, the stream does not move over the memory
+      dma_tx_meminc(dev, DMA_MINC_DISABLE);
+      status = HAL_SPI_Transmit_DMA((SPI_HandleTypeDef*)dev->Bus, (uint8_t*)&job->Color, job->Size);
+    }
+    if (status == HAL_OK) return;
+
+    // drop the failed job and go on with the next one
+    queue_release(dev);
+  }
+
+  st7796_dma_busy = false;
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Takes the next free job slot with the pending window, if any,
+ *          attached to it. Blocks only while the queue is full.
+ */
+static DisplayJob_TypeDef* queue_slot(Display_TypeDef* dev) {
+
+  while (((dev->QueueHead + 1) % dev->QueueSize) == dev->QueueTail);
+
+  DisplayJob_TypeDef* job = &dev->Queue[dev->QueueHead];
+
+  *job = dev->Window;
+  dev->Window.Dir = NOOP;
+
+  return job;
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Publishes the job taken by queue_slot() and starts the bus if it
+ *          is idle.
+ */
+static void queue_commit(Display_TypeDef* dev, DisplayJob_TypeDef* job) {
+
+  uint32_t primask = __get_PRIMASK();
+  __disable_irq();
+  if (job->Lock) (*job->Lock)++;
+  dev->QueueHead = (dev->QueueHead + 1) % dev->QueueSize;
+  bool idle = !st7796_dma_busy;
+  if (idle) st7796_dma_busy = true;
+  __set_PRIMASK(primask);
+
+  if (idle) queue_run(dev);
+}
+
+
+// --------------------------------------------------------------------------
+
+__STATIC_INLINE void queue_push(Display_TypeDef* dev, uint16_t* data, uint32_t size, __IO uint32_t* lock) {
+  DisplayJob_TypeDef* job = queue_slot(dev);
+
+  job->Data = data;
+  job->Size = size;
+  job->Lock = lock;
+  queue_commit(dev, job);
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Queues a solid run of any length, split into 65535-item jobs.
+ */
+__STATIC_INLINE void queue_color(Display_TypeDef* dev, uint16_t c, uint32_t total) {
+
+  while (total) {
+    DisplayJob_TypeDef* job = queue_slot(dev);
+
+    job->Color = c;
+    job->Data  = NULL;
+    job->Size  = (total > 0xffff) ? 0xffff : total;
+    job->Lock  = NULL;
+    total -= job->Size;
+    queue_commit(dev, job);
+  }
+}
+
+
+// --------------------------------------------------------------------------
+
+__STATIC_INLINE void queue_window(Display_TypeDef* dev, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1) {
+  dev->Window.X0  = x0;
+  dev->Window.Y0  = y0;
+  dev->Window.X1  = x1;
+  dev->Window.Y1  = y1;
+  dev->Window.Dir = WRITE;
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Queues the window of a logical rectangle, the stream order is
+ *          y first in both positions.
+ */
+__STATIC_INLINE void queue_rect(Display_TypeDef* dev, uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+  #if DISPLAY_POSITION
+    queue_window(dev, y, x, (y + h - 1), (x + w - 1));
+  #else
+    queue_window(dev, x, y, (x + w - 1), (y + h - 1));
+  #endif
+}
+
+
 // --------------------------------------------------------------------------
 
 void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef *hspi) {
   if (hspi->Instance == SPI1) {
-    st7796_dma_busy = false;
+    queue_release(st7796_dev);
+    queue_run(st7796_dev);
   }
 }
 
@@ -85,44 +395,92 @@ void HAL_SPI_RxCpltCallback(SPI_HandleTypeDef *hspi) {
 
 // --------------------------------------------------------------------------
 
-void HAL_SPI_ErrorCallback(SPI_HandleTypeDef *hspi) {
+void HAL_SPI_TxRxCpltCallback(SPI_HandleTypeDef *hspi) {
   if (hspi->Instance == SPI1) {
     st7796_dma_busy = false;
   }
 }
 
 
+// --------------------------------------------------------------------------
+
+void HAL_SPI_ErrorCallback(SPI_HandleTypeDef *hspi) {
+  if (hspi->Instance == SPI1) {
+    if (st7796_dev->QueueTail != st7796_dev->QueueHead) {
+      queue_release(st7796_dev);
+      queue_run(st7796_dev);
+    } else {
+      st7796_dma_busy = false;
+    }
+  }
+}
+
+
+// --------------------------------------------------------------------------
+
+__STATIC_INLINE void pixbuf_acquire(Display_TypeDef* dev) {
+  while (dev->PixBufLock[dev->PixBufIndex]);
+}
+
+
 // --------------------------------------------------------------------------
 
 __STATIC_INLINE void write_data_dma(Display_TypeDef* dev) {
-  
-  while (st7796_dma_busy);
-  
-  dc_data();
-  st7796_dma_busy = true;
-  
-  if (HAL_SPI_Transmit_DMA((SPI_HandleTypeDef*)dev->Bus, (uint8_t*)dev->PixBuf, (dev->PixBufActiveSize * 2)) != HAL_OK) {
-    st7796_dma_busy = false; // important safety
-    return;
+  queue_push(dev, dev->PixBuf, dev->PixBufActiveSize, &dev->PixBufLock[dev->PixBufIndex]);
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Switches the generator to the next part of the write area. The
+ *          part left behind is given back by the TX complete callback when
+ *          its last job is done.
+ */
+__STATIC_INLINE void pixbuf_next(Display_TypeDef* dev) {
+  dev->PixBufIndex = (dev->PixBufIndex + 1) % dev->PixBufNum;
+  dev->PixBuf = dev->PixBufPool + (dev->PixBufIndex * dev->PixBufSize);
+  dev->PixBufActiveSize = 0;
+}
+
+
+// --------------------------------------------------------------------------
+
+__STATIC_INLINE void pixbuf_flush(Display_TypeDef* dev) {
+  if (dev->PixBufActiveSize) {
+    write_data_dma(dev);
+    pixbuf_next(dev);
   }
-  while (st7796_dma_busy);
+  pixbuf_acquire(dev);
 }
 
 
 // --------------------------------------------------------------------------
 
 __STATIC_INLINE void write_backgoung_data_dma(Display_TypeDef* dev) {
-  
-  while (st7796_dma_busy);
-  
-  dc_data();
-  st7796_dma_busy = true;
-  
-  if (HAL_SPI_Transmit_DMA((SPI_HandleTypeDef*)dev->Bus, (uint8_t*)dev->PixBufBg, (dev->PixBufBgActiveSize * 2)) != HAL_OK) {
-    st7796_dma_busy = false; // important safety
-    return;
-  }
-  while (st7796_dma_busy);
+  queue_push(dev, dev->PixBufBg, dev->PixBufBgActiveSize, &dev->PixBufBgLock);
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Cuts a rectangle down to the clip region.
+ * @retval  false when nothing is left to draw
+ */
+__STATIC_INLINE bool display_clip(Display_TypeDef* dev, uint16_t* x, uint16_t* y, uint16_t* w, uint16_t* h) {
+  uint32_t x0 = (*x > dev->Clip.X) ? *x : dev->Clip.X;
+  uint32_t y0 = (*y > dev->Clip.Y) ? *y : dev->Clip.Y;
+  uint32_t x1 = ((uint32_t)*x + *w < (uint32_t)dev->Clip.X + dev->Clip.W) ? ((uint32_t)*x + *w) : ((uint32_t)dev->Clip.X + dev->Clip.W);
+  uint32_t y1 = ((uint32_t)*y + *h < (uint32_t)dev->Clip.Y + dev->Clip.H) ? ((uint32_t)*y + *h) : ((uint32_t)dev->Clip.Y + dev->Clip.H);
+
+  if ((x1 <= x0) || (y1 <= y0)) return false;
+
+  *x = x0;
+  *y = y0;
+  *w = x1 - x0;
+  *h = y1 - y0;
+  return true;
 }
 
 
@@ -135,9 +493,7 @@ __STATIC_INLINE void read_data_dma(Display_TypeDef* dev) {
   uint8_t dummy = 0;
   SPI_HandleTypeDef* bus = (SPI_HandleTypeDef*)dev->Bus;
 
-  hdma_spi1_tx.Init.MemInc = DMA_MINC_DISABLE;
-  if (HAL_DMA_Init(&hdma_spi1_tx) != HAL_OK) Error_Handler();
-
+  dma_tx_meminc(dev, DMA_MINC_DISABLE);
   
   dc_data();
   st7796_dma_busy = true;
@@ -147,54 +503,181 @@ __STATIC_INLINE void read_data_dma(Display_TypeDef* dev) {
     return;
   }
   while (st7796_dma_busy);
-  hdma_spi1_tx.Init.MemInc = DMA_MINC_ENABLE;
-  if (HAL_DMA_Init(&hdma_spi1_tx) != HAL_OK) Error_Handler();
+  dma_tx_meminc(dev, DMA_MINC_ENABLE);
+
+  // bytes came in wire order, keep the buffer in native RGB565
+  uint32_t* word = (uint32_t*)dev->PixBufBg;
+  for (uint32_t i = 0; i < ((dev->PixBufBgActiveSize + 1) / 2); i++) {
+    word[i] = __REV16(word[i]);
+  }
 }
 
 
+
+
 // --------------------------------------------------------------------------
 
-__STATIC_INLINE void display_set_window(Display_TypeDef* dev, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, TrasmissionDirection_t dir) {
+__STATIC_INLINE void pixbuf_run(uint16_t* px, uint16_t c, uint32_t n) {
+  while (n--) *px++ = c;
+}
 
-  uint8_t data[4];
 
-  write_cmd(dev, 0x2a);
-  #if (DISPLAY_POSITION)
-    // vertical
-    data[0] = x0 >> 8; data[1] = x0 & 0xff;
-    data[2] = x1 >> 8; data[3] = x1 & 0xff;
-  #else
-    // horizontal
-    data[0] = y0 >> 8; data[1] = y0 & 0xff;
-    data[2] = y1 >> 8; data[3] = y1 & 0xff;
-  #endif
-  write_data(dev, data, 4);
+// --------------------------------------------------------------------------
 
-  write_cmd(dev, 0x2b);
-  #if (DISPLAY_POSITION)
-    // vertical
-    data[0] = y0 >> 8; data[1] = y0 & 0xff;
-    data[2] = y1 >> 8; data[3] = y1 & 0xff;
-  #else
-    // horizontal
-    data[0] = x0 >> 8; data[1] = x0 & 0xff;
-    data[2] = x1 >> 8; data[3] = x1 & 0xff;
-  #endif
-  write_data(dev, data, 4);
+/**
+ * @brief   Sends a filled shape as its clipped bounding box under a single
+ *          window. Pixels around the shape take dev->Bgcolor, the known
+ *          background. Columns covered top to bottom are merged into solid
+ *          runs that need no buffer at all.
+ */
+static HAL_StatusTypeDef display_fill_shape(Display_TypeDef* dev, Shape_TypeDef* s, uint16_t c, ImageLayer_t l) {
+
+  int32_t x0 = (s->X > dev->Clip.X) ? s->X : dev->Clip.X;
+  int32_t y0 = (s->Y > dev->Clip.Y) ? s->Y : dev->Clip.Y;
+  int32_t x1 = ((s->X + s->W) < (dev->Clip.X + dev->Clip.W)) ? (s->X + s->W) : (dev->Clip.X + dev->Clip.W);
+  int32_t y1 = ((s->Y + s->H) < (dev->Clip.Y + dev->Clip.H)) ? (s->Y + s->H) : (dev->Clip.Y + dev->Clip.H);
+
+  if ((x1 <= x0) || (y1 <= y0)) return HAL_OK;
+
+  uint32_t h = y1 - y0;
+  int16_t top, bottom;
+
+  if (l != FRONT) {
+    // the back layer keeps its own pixels around the shape, span by span
+    for (int32_t x = x0; x < x1; x++) {
+      Shape_Span(s, x, &top, &bottom);
+      if (top < y0) top = y0;
+      if (bottom >= y1) bottom = y1 - 1;
+      if (bottom < top) continue;
+      if (Display_FillRectangle(dev, x, top, 1, (bottom - top + 1), c, l) != HAL_OK) return HAL_ERROR;
+    }
+    return HAL_OK;
+  }
 
-  switch (dir) {
-    case READ:
-      write_cmd(dev, 0x2e);
-    break;
+  if (h > dev->PixBufSize) return HAL_ERROR;
 
-    case WRITE:
-      write_cmd(dev, 0x2c);
-    break;
-  
-    default:
-      Error_Handler();
-    break;
+  queue_rect(dev, x0, y0, (x1 - x0), h);
+  pixbuf_acquire(dev);
+  dev->PixBufActiveSize = 0;
+
+  uint32_t solid = 0;
+
+  for (int32_t x = x0; x < x1; x++) {
+    Shape_Span(s, x, &top, &bottom);
+
+    if ((top <= y0) && (bottom >= (y1 - 1))) {
+      solid++;
+      continue;
+    }
+
+    if (solid) {
+      // buffered columns go out first, the stream order must hold
+      pixbuf_flush(dev);
+      queue_color(dev, c, (solid * h));
+      solid = 0;
+    }
+
+    if ((dev->PixBufActiveSize + h) > dev->PixBufSize) pixbuf_flush(dev);
+
+    uint32_t t = (top > y0) ? (uint32_t)(top - y0) : 0;
+    uint32_t b = (bottom >= y1) ? h : (uint32_t)(bottom + 1 - y0);
+    if ((top >= y1) || (bottom < y0)) t = b = 0;
+
+    uint16_t* px = &dev->PixBuf[dev->PixBufActiveSize];
+    pixbuf_run(px, dev->Bgcolor, t);
+    pixbuf_run((px + t), c, (b - t));
+    pixbuf_run((px + b), dev->Bgcolor, (h - b));
+    dev->PixBufActiveSize += h;
   }
+
+  pixbuf_flush(dev);
+  if (solid) queue_color(dev, c, (solid * h));
+
+  return HAL_OK;
+}
+
+
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Sends run slot k when the column x does not carry it on, a run
+ *          with the same rows as the one in the previous column only widens
+ *          it. run[k] is {x, w, top, bottom}.
+ */
+__STATIC_INLINE void ring_run(Display_TypeDef* dev, int32_t (*run)[4], uint32_t k, int32_t x, int32_t t, int32_t b, uint16_t c) {
+
+  if (run[k][1] && ((run[k][0] + run[k][1]) == x) && (run[k][2] == t) && (run[k][3] == b)) {
+    run[k][1]++;
+    return;
+  }
+
+  if (run[k][1]) {
+    uint32_t h = run[k][3] - run[k][2] + 1;
+    queue_rect(dev, run[k][0], run[k][2], run[k][1], h);
+    queue_color(dev, c, (run[k][1] * h));
+  }
+
+  run[k][0] = x;
+  run[k][1] = (b < t) ? 0 : 1;
+  run[k][2] = t;
+  run[k][3] = b;
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Sends a ring or an arc column by column. Only the spans of a
+ *          column go out, an arc only its own pixels, each run as a solid
+ *          window, so whatever is inside the ring or beside the arc is left
+ *          alone. Runs repeating in the next columns go out as one window.
+ */
+static HAL_StatusTypeDef display_draw_ring(Display_TypeDef* dev, Ring_TypeDef* s, uint16_t c) {
+
+  int32_t x0 = (s->Outer.X > dev->Clip.X) ? s->Outer.X : dev->Clip.X;
+  int32_t y0 = (s->Outer.Y > dev->Clip.Y) ? s->Outer.Y : dev->Clip.Y;
+  int32_t x1 = ((s->Outer.X + s->Outer.W) < (dev->Clip.X + dev->Clip.W)) ? (s->Outer.X + s->Outer.W) : (dev->Clip.X + dev->Clip.W);
+  int32_t y1 = ((s->Outer.Y + s->Outer.H) < (dev->Clip.Y + dev->Clip.H)) ? (s->Outer.Y + s->Outer.H) : (dev->Clip.Y + dev->Clip.H);
+
+  if ((x1 <= x0) || (y1 <= y0)) return HAL_OK;
+
+  // a span crosses each arc edge once, so it holds two runs at most
+  int32_t run[4][4] = {{0}};
+
+  for (int32_t x = x0; x < x1; x++) {
+    int16_t sp[4];
+    Shape_RingSpan(s, x, &sp[0], &sp[1], &sp[2], &sp[3]);
+
+    for (uint32_t k = 0; k < 4; k += 2) {
+      int32_t t = (sp[k] > y0) ? sp[k] : y0;
+      int32_t b = (sp[k + 1] < (y1 - 1)) ? sp[k + 1] : (y1 - 1);
+      uint32_t n = 0;
+
+      if ((s->Sweep >= 360) && (b >= t)) {
+        ring_run(dev, run, k, x, t, b, c);
+        n = 1;
+      }
+
+      for (int32_t y = t; (s->Sweep < 360) && (y <= b); y++) {
+        if (!Shape_ArcInside(s, x, y)) continue;
+
+        int32_t e = y;
+        while ((e < b) && Shape_ArcInside(s, x, (e + 1))) e++;
+        ring_run(dev, run, (k + n), x, y, e, c);
+        if (++n == 2) break;
+        y = e;
+      }
+
+      // slots without a run in this column go out now
+      for (; n < 2; n++) ring_run(dev, run, (k + n), x, 1, 0, c);
+    }
+  }
+
+  for (uint32_t k = 0; k < 4; k++) ring_run(dev, run, k, x1, 1, 0, c);
+
+  return HAL_OK;
 }
 
 
@@ -206,21 +689,38 @@ Display_TypeDef* ST7796_Init(void) {
 
   __attribute__((section(".dma_buffer_write"), aligned(4))) static uint16_t pixbuf[PIX_BUF_SZ];
   __attribute__((section(".dma_buffer_read"), aligned(4))) static uint16_t pixbuf_bg[PIX_BUF_SZ];
+  static __IO uint32_t pixbuf_lock[PIX_BUF_NUM];
+  static DisplayJob_TypeDef queue[DISPLAY_QUEUE_SZ];
   static Display_TypeDef display_0 = {
     .Model              = 7796,
     .Orientation        = ORIENTATION,
+    .Bgcolor            = COLOR_BLACK,
     .Bus                = (uint32_t*)&hspi1,
     .PixBuf             = pixbuf,
-    .PixBufSize         = PIX_BUF_SZ,
+    .PixBufSize         = PIX_BUF_SZ / PIX_BUF_NUM,
     .PixBufActiveSize   = 0,
+    .PixBufPool         = pixbuf,
+    .PixBufNum          = PIX_BUF_NUM,
+    .PixBufIndex        = 0,
+    .PixBufLock         = pixbuf_lock,
     .PixBufBg           = pixbuf_bg,
     .PixBufBgSize       = PIX_BUF_SZ,
     .PixBufBgActiveSize = 0,
+    .Window             = {.Dir = NOOP},
+    .Caset              = 0xffffffff,
+    .Raset              = 0xffffffff,
+    .Queue              = queue,
+    .QueueSize          = DISPLAY_QUEUE_SZ,
     .Width              = DISPLAY_WIDTH,
     .Height             = DISPLAY_HEIGHT,
+    .Clip               = {0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT},
+    .ScrollTop          = 0,
+    .ScrollSize         = DISPLAY_SCROLL_LINES,
+    .ScrollOffset       = 0,
   };
 
   Display_TypeDef* dev = &display_0;
+  st7796_dev = dev;
   SPI_HandleTypeDef* bus = (SPI_HandleTypeDef*)dev->Bus;
 
   if (dev->Lock == DISABLE) dev->Lock = ENABLE;
@@ -241,6 +741,8 @@ Display_TypeDef* ST7796_Init(void) {
 
 	write_cmd(dev, 0x01);             // Software reset
 	HAL_Delay(120);
+  dev->Caset = 0xffffffff;          // - window cache is stale now
+  dev->Raset = 0xffffffff;
 
 	write_cmd(dev, 0x11);             // Sleep exit                                            
 	HAL_Delay(120);
@@ -345,102 +847,475 @@ Display_TypeDef* ST7796_Init(void) {
 
 // --------------------------------------------------------------------------
 
-HAL_StatusTypeDef __attribute__((weak)) Display_Fill(Display_TypeDef* dev, uint16_t c, ImageLayer_t l) {
-  return Display_FillRectangle(dev, 0, 0, dev->Width, dev->Height, c, l);
+HAL_StatusTypeDef __attribute__((weak)) Display_Sync(Display_TypeDef* dev) {
+  while ((dev->QueueTail != dev->QueueHead) || st7796_dma_busy);
+  return HAL_OK;
+}
+
+
+
+// --------------------------------------------------------------------------
+
+HAL_StatusTypeDef __attribute__((weak)) Display_SetClip(Display_TypeDef* dev, uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+  if (((x + w) > dev->Width) || ((y + h) > dev->Height)) return HAL_ERROR;
+
+  dev->Clip.X = x;
+  dev->Clip.Y = y;
+  dev->Clip.W = w;
+  dev->Clip.H = h;
+  return HAL_OK;
+}
+
+
+
+// --------------------------------------------------------------------------
+
+HAL_StatusTypeDef __attribute__((weak)) Display_ResetClip(Display_TypeDef* dev) {
+  return Display_SetClip(dev, 0, 0, dev->Width, dev->Height);
+}
+
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Sends a scroll command once the queue has drained, so it can not
+ *          cut into a pixel transfer.
+ */
+static void display_scroll_cmd(Display_TypeDef* dev, uint8_t cmd, const uint16_t* param, uint32_t n) {
+  SPI_HandleTypeDef* bus = (SPI_HandleTypeDef*)dev->Bus;
+
+  Display_Sync(dev);
+  spi_frame(dev, SPI_DATASIZE_8BIT);
+  __HAL_SPI_ENABLE(bus);
+  spi_words(bus->Instance, cmd, param, n);
+  __HAL_SPI_CLEAR_OVRFLAG(bus);
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Makes lines top..top+size-1 along the scroll axis (see
+ *          DISPLAY_SCROLL_LINES) a scroll area, the lines around it stay put.
+ *          The area starts unscrolled.
+ */
+HAL_StatusTypeDef __attribute__((weak)) Display_ScrollDefine(Display_TypeDef* dev, uint16_t top, uint16_t size) {
+
+  if (!size || ((top + size) > DISPLAY_SCROLL_LINES)) return HAL_ERROR;
+
+  uint16_t param[3];
+
+  // MY runs the panel rows the other way round, TFA is then at the far end
+  if (dev->Orientation & 0x80) {
+    param[0] = DISPLAY_SCROLL_LINES - top - size;
+    param[2] = top;
+  } else {
+    param[0] = top;
+    param[2] = DISPLAY_SCROLL_LINES - top - size;
+  }
+  param[1] = size;
+  display_scroll_cmd(dev, 0x33, param, 3);
+
+  dev->ScrollTop    = top;
+  dev->ScrollSize   = size;
+  dev->ScrollOffset = 0xffff;
+
+  return Display_ScrollTo(dev, 0);
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Scrolls the area to show draw line top + offset at its first line.
+ *          Only the start address goes out, nothing is redrawn.
+ */
+HAL_StatusTypeDef __attribute__((weak)) Display_ScrollTo(Display_TypeDef* dev, uint16_t offset) {
+
+  if (!dev->ScrollSize) return HAL_ERROR;
+
+  offset %= dev->ScrollSize;
+  if (offset == dev->ScrollOffset) return HAL_OK;
+
+  uint16_t vsp;
+
+  if (dev->Orientation & 0x80) {
+    vsp = (DISPLAY_SCROLL_LINES - dev->ScrollTop - dev->ScrollSize) + ((dev->ScrollSize - offset) % dev->ScrollSize);
+  } else {
+    vsp = dev->ScrollTop + offset;
+  }
+  display_scroll_cmd(dev, 0x37, &vsp, 1);
+
+  dev->ScrollOffset = offset;
+  return HAL_OK;
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Scrolls the area by lines, positive moves the content towards the
+ *          area top. Draw the lines that come in at Display_ScrollMap() of
+ *          the screen lines exposed.
+ */
+HAL_StatusTypeDef __attribute__((weak)) Display_Scroll(Display_TypeDef* dev, int16_t lines) {
+
+  if (!dev->ScrollSize) return HAL_ERROR;
+
+  int32_t offset = ((int32_t)dev->ScrollOffset + lines) % dev->ScrollSize;
+  if (offset < 0) offset += dev->ScrollSize;
+
+  return Display_ScrollTo(dev, (uint16_t)offset);
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Returns the draw line shown at screen line along the scroll axis.
+ *          Lines outside the scroll area map to themselves.
+ */
+uint16_t __attribute__((weak)) Display_ScrollMap(Display_TypeDef* dev, uint16_t line) {
+
+  if ((line < dev->ScrollTop) || (line >= (dev->ScrollTop + dev->ScrollSize))) return line;
+
+  return dev->ScrollTop + ((line - dev->ScrollTop + dev->ScrollOffset) % dev->ScrollSize);
+}
+
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Composes a region one horizontal band at a time. paint() draws the
+ *          whole scene into a canvas over the band, which then goes out with
+ *          a single window while the next band is painted into the other
+ *          part of the write area.
+ */
+HAL_StatusTypeDef __attribute__((weak)) Display_RenderBands(Display_TypeDef* dev, uint16_t x, uint16_t y, uint16_t w, uint16_t h, HAL_StatusTypeDef (*paint)(Canvas_TypeDef*)) {
+
+  if (!paint || !w || !h) return HAL_ERROR;
+  if (((x + w) > dev->Width) || ((y + h) > dev->Height)) return HAL_ERROR;
+
+  uint32_t band = dev->PixBufSize / w;
+  if (!band) return HAL_ERROR;
+
+  HAL_StatusTypeDef status = HAL_OK;
+
+  for (uint32_t by = y; by < ((uint32_t)y + h); by += band) {
+    pixbuf_acquire(dev);
+
+    Canvas_TypeDef cv = {
+      .Buf  = dev->PixBuf,
+      .X    = x,
+      .Y    = by,
+      .W    = w,
+      .H    = (((uint32_t)y + h - by) > band) ? band : ((uint32_t)y + h - by),
+    };
+    if (paint(&cv) != HAL_OK) status = HAL_ERROR;
+
+    queue_rect(dev, cv.X, cv.Y, cv.W, cv.H);
+    dev->PixBufActiveSize = (uint32_t)cv.W * cv.H;
+    pixbuf_flush(dev);
+  }
+
+  return status;
+}
+
+
+
+// --------------------------------------------------------------------------
+
+HAL_StatusTypeDef __attribute__((weak)) Display_Fill(Display_TypeDef* dev, uint16_t c, ImageLayer_t l) {
+  // shapes are drawn over the known background
+  if (l == FRONT) dev->Bgcolor = c;
+  return Display_FillRectangle(dev, 0, 0, dev->Width, dev->Height, c, l);
+}
+
+
+
+// --------------------------------------------------------------------------
+
+HAL_StatusTypeDef __attribute__((weak)) Display_DrawRectangle(Display_TypeDef* dev, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t b, uint16_t c, ImageLayer_t l) {
+ 
+  HAL_StatusTypeDef status = HAL_OK;
+
+  #if ORIENTATION
+  #else
+  #endif
+
+  if (Display_DrawVLine(dev, x, y, (w + b), b, c, l) != HAL_OK) status = HAL_ERROR;
+  if (Display_DrawVLine(dev, (x + h), y, (w + b), b, c, l) != HAL_OK) status = HAL_ERROR;
+  if (Display_DrawHLine(dev, x, y, h, b, c, l) != HAL_OK) status = HAL_ERROR;
+  if (Display_DrawHLine(dev, x, (y + w), h, b, c, l) != HAL_OK) status = HAL_ERROR;
+
+  return status;
+}
+
+
+
+// --------------------------------------------------------------------------
+
+HAL_StatusTypeDef __attribute__((weak)) Display_FillRectangle(Display_TypeDef* dev, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t c, ImageLayer_t l) {
+
+  uint16_t rw, rh, rx, ry;
+
+  if (!display_clip(dev, &x, &y, &w, &h)) return HAL_OK;
+
+  #if DISPLAY_POSITION
+    rx = y;
+    ry = x;
+    rw = h + rx;
+    rh = w + ry;
+    if (rw > dev->Height) return HAL_ERROR;
+    if (rh > dev->Width) return HAL_ERROR;
+  #else
+    rw = w + x;
+    rh = h + y;
+    rx = x;
+    ry = y;
+    if (rw > dev->Width) return HAL_ERROR;
+    if (rh > dev->Height) return HAL_ERROR;
+  #endif
+
+  queue_window(dev, rx, ry, (rw - 1), (rh - 1));
+
+  uint32_t total = h * w;
+
+  switch (l) {
+    case FRONT:
+      // constant color needs no buffer at all
+      queue_color(dev, c, total);
+      break;
+
+    case BACK:
+      while (total) {
+        dev->PixBufBgActiveSize = (total > dev->PixBufBgSize) ? dev->PixBufBgSize : total;
+        write_backgoung_data_dma(dev);
+        total -= dev->PixBufBgActiveSize;
+      }
+      break;
+    
+    default:
+      Error_Handler();
+      break;
+  }
+
+  return HAL_OK;
+}
+
+
+
+// --------------------------------------------------------------------------
+
+HAL_StatusTypeDef __attribute__((weak)) Display_FillBackground(Display_TypeDef* dev, uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+
+  uint16_t rw = w + x;
+  uint16_t rh = h + y;
+  if (rw > dev->Width) return HAL_ERROR;
+  if (rh > dev->Height) return HAL_ERROR;
+  queue_window(dev, x, y, (rw - 1), (rh - 1));
+
+  write_data_dma(dev);
+
+  return HAL_OK;
+}
+
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Draws a whole bitmap at (x, y), see Display_BlitPart().
+ */
+HAL_StatusTypeDef __attribute__((weak)) Display_Blit(Display_TypeDef* dev, uint16_t x, uint16_t y, const Bitmap_TypeDef* bmp) {
+  if (!bmp) return HAL_ERROR;
+  return Display_BlitPart(dev, x, y, bmp, 0, 0, bmp->W, bmp->H);
 }
 
 
-
 // --------------------------------------------------------------------------
 
-HAL_StatusTypeDef __attribute__((weak)) Display_DrawRectangle(Display_TypeDef* dev, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t b, uint16_t c, ImageLayer_t l) {
- 
-  HAL_StatusTypeDef status = HAL_OK;
+/**
+ * @brief   Draws the w x h piece of bmp from (sx, sy) at (x, y), cut to the
+ *          clip region. When whole columns are left the pixels are one run
+ *          in the source and go out by DMA from where they are, without a
+ *          copy; a RAM bitmap must then stay untouched until Display_Sync().
+ *          A piece cut at the top or bottom is gathered column by column
+ *          into the write area.
+ */
+HAL_StatusTypeDef __attribute__((weak)) Display_BlitPart(Display_TypeDef* dev, uint16_t x, uint16_t y, const Bitmap_TypeDef* bmp, uint16_t sx, uint16_t sy, uint16_t w, uint16_t h) {
 
-  #if ORIENTATION
-  #else
-  #endif
+  if (!bmp || !bmp->Pixels) return HAL_ERROR;
+  if (((sx + w) > bmp->W) || ((sy + h) > bmp->H)) return HAL_ERROR;
 
-  if (Display_DrawVLine(dev, x, y, (w + b), b, c, l) != HAL_OK) status = HAL_ERROR;
-  if (Display_DrawVLine(dev, (x + h), y, (w + b), b, c, l) != HAL_OK) status = HAL_ERROR;
-  if (Display_DrawHLine(dev, x, y, h, b, c, l) != HAL_OK) status = HAL_ERROR;
-  if (Display_DrawHLine(dev, x, (y + w), h, b, c, l) != HAL_OK) status = HAL_ERROR;
+  uint16_t cx = x, cy = y;
+  if (!display_clip(dev, &cx, &cy, &w, &h)) return HAL_OK;
 
-  return status;
-}
+  sx += cx - x;
+  sy += cy - y;
 
+  const uint16_t* src = &bmp->Pixels[((uint32_t)sx * bmp->H) + sy];
 
+  queue_rect(dev, cx, cy, w, h);
 
-// --------------------------------------------------------------------------
+  if (h == bmp->H) {
+    // straight from the source, a job carries up to 65535 pixels
+    uint32_t total = (uint32_t)w * h;
 
-HAL_StatusTypeDef __attribute__((weak)) Display_FillRectangle(Display_TypeDef* dev, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t c, ImageLayer_t l) {
+    while (total) {
+      uint32_t n = (total > 0xffff) ? 0xffff : total;
 
-  uint16_t rw, rh, rx, ry;
+      queue_push(dev, (uint16_t*)src, n, NULL);
+      src += n;
+      total -= n;
+    }
+    return HAL_OK;
+  }
 
-  #if DISPLAY_POSITION
-    rx = y;
-    ry = x;
-    rw = h + rx;
-    rh = w + ry;
-    if (rw > dev->Height) return HAL_ERROR;
-    if (rh > dev->Width) return HAL_ERROR;
-  #else
-    rw = w + x;
-    rh = h + y;
-    rx = x;
-    ry = y;
-    if (rw > dev->Width) return HAL_ERROR;
-    if (rh > dev->Height) return HAL_ERROR;
-  #endif
+  if (h > dev->PixBufSize) return HAL_ERROR;
 
-  display_set_window(dev, rx, ry, (rw - 1), (rh - 1), WRITE);
+  pixbuf_acquire(dev);
+  dev->PixBufActiveSize = 0;
 
-  /* prepare color & optimize buffer filler */
-  uint32_t total = h * w;
-  uint32_t ccnt = (total > dev->PixBufSize) ? dev->PixBufSize : total; 
-  for (uint32_t i = 0; i < ccnt; i++) {
-    dev->PixBuf[i] = c;
+  for (uint32_t i = 0; i < w; i++, src += bmp->H) {
+    if ((dev->PixBufActiveSize + h) > dev->PixBufSize) pixbuf_flush(dev);
+
+    memcpy(&dev->PixBuf[dev->PixBufActiveSize], src, (h * sizeof(uint16_t)));
+    dev->PixBufActiveSize += h;
   }
 
+  pixbuf_flush(dev);
+
+  return HAL_OK;
+}
+
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Draws a compressed image at (x, y), cut to the clip region. The
+ *          pixels are decoded straight into one part of the write area while
+ *          the other is sent, no frame buffer is needed. Columns left of the
+ *          clip region are decoded and dropped, a piece cut at the top or
+ *          bottom has every column decoded whole and moved into place.
+ */
+HAL_StatusTypeDef __attribute__((weak)) Display_DrawImage(Display_TypeDef* dev, uint16_t x, uint16_t y, const Image_TypeDef* img) {
+
+  if (!img || !img->Data) return HAL_ERROR;
+
+  uint16_t cx = x, cy = y, w = img->W, h = img->H;
+  if (!display_clip(dev, &cx, &cy, &w, &h)) return HAL_OK;
+  if (img->H > dev->PixBufSize) return HAL_ERROR;
+
+  ImageDecoder_TypeDef dec;
+  uint32_t top = cy - y;
+  HAL_StatusTypeDef status = HAL_OK;
+
+  Image_Begin(&dec, img);
+  if (Image_Decode(&dec, NULL, ((uint32_t)(cx - x) * img->H)) != ((uint32_t)(cx - x) * img->H)) return HAL_ERROR;
+
+  queue_rect(dev, cx, cy, w, h);
+  pixbuf_acquire(dev);
   dev->PixBufActiveSize = 0;
 
-  while (total) {
-    dev->PixBufActiveSize = (total > dev->PixBufSize) ? dev->PixBufSize : total;
-    switch (l) {
-      case FRONT:
-        write_data_dma(dev);
-        break;
+  if (h == img->H) {
+    // whole columns, every part is filled up
+    uint32_t total = (uint32_t)w * h;
 
-      case BACK:
-        dev->PixBufBgActiveSize = dev->PixBufActiveSize;
-        write_backgoung_data_dma(dev);
-        break;
-      
-      default:
-        Error_Handler();
-        break;
+    while (total) {
+      uint32_t n = dev->PixBufSize - dev->PixBufActiveSize;
+      if (n > total) n = total;
+
+      if (Image_Decode(&dec, &dev->PixBuf[dev->PixBufActiveSize], n) != n) status = HAL_ERROR;
+      dev->PixBufActiveSize += n;
+      total -= n;
+      if (dev->PixBufActiveSize == dev->PixBufSize) pixbuf_flush(dev);
+    }
+  } else {
+    for (uint32_t i = 0; i < w; i++) {
+      if ((dev->PixBufActiveSize + img->H) > dev->PixBufSize) pixbuf_flush(dev);
+
+      uint16_t* px = &dev->PixBuf[dev->PixBufActiveSize];
+
+      if (Image_Decode(&dec, px, img->H) != img->H) status = HAL_ERROR;
+      if (top) memmove(px, &px[top], (h * sizeof(uint16_t)));
+      dev->PixBufActiveSize += h;
     }
-    total -= dev->PixBufActiveSize;
   }
 
-  return HAL_OK;
+  // the window is open for w x h pixels, a broken image still fills it
+  pixbuf_flush(dev);
+
+  return status;
 }
 
 
 
 // --------------------------------------------------------------------------
 
-HAL_StatusTypeDef __attribute__((weak)) Display_FillBackground(Display_TypeDef* dev, uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+/**
+ * @brief   Draws a JPEG picture at (x, y), cut to the clip region, after
+ *          Jpeg_Begin() has read its headers. Every MCU is decoded into the
+ *          write area and sent through a window of its own while the next
+ *          one is decoded. Parts of MCUs past the picture edge or outside
+ *          the clip region are dropped column by column.
+ */
+HAL_StatusTypeDef __attribute__((weak)) Display_DrawJpeg(Display_TypeDef* dev, uint16_t x, uint16_t y, Jpeg_TypeDef* jpg) {
 
-  uint16_t rw = w + x;
-  uint16_t rh = h + y;
-  if (rw > dev->Width) return HAL_ERROR;
-  if (rh > dev->Height) return HAL_ERROR;
-  display_set_window(dev, x, y, (rw - 1), (rh - 1), WRITE);
+  if (!jpg || !jpg->McusX) return HAL_ERROR;
 
-  write_data_dma(dev);
+  uint32_t mw = jpg->McuW, mh = jpg->McuH;
+  if ((mw * mh) > dev->PixBufSize) return HAL_ERROR;
 
-  return HAL_OK;
+  HAL_StatusTypeDef status = HAL_OK;
+
+  pixbuf_acquire(dev);
+  dev->PixBufActiveSize = 0;
+
+  for (uint32_t my = 0; (my < jpg->McusY) && (status == HAL_OK); my++) {
+    // the rest of the picture is below the clip region
+    if ((y + (my * mh)) >= ((uint32_t)dev->Clip.Y + dev->Clip.H)) break;
+
+    for (uint32_t mx = 0; mx < jpg->McusX; mx++) {
+      if ((dev->PixBufActiveSize + (mw * mh)) > dev->PixBufSize) {
+        pixbuf_next(dev);
+        pixbuf_acquire(dev);
+      }
+
+      uint16_t* px = &dev->PixBuf[dev->PixBufActiveSize];
+
+      if (Jpeg_Mcu(jpg, px) != HAL_OK) {
+        status = HAL_ERROR;
+        break;
+      }
+
+      uint32_t bx = x + (mx * mw), by = y + (my * mh);
+      if ((bx >= dev->Width) || (by >= dev->Height)) continue;
+
+      uint16_t cx = bx, cy = by;
+      uint16_t cw = ((mx + 1) * mw > jpg->W) ? (jpg->W - (mx * mw)) : mw;
+      uint16_t ch = ((my + 1) * mh > jpg->H) ? (jpg->H - (my * mh)) : mh;
+      if (!display_clip(dev, &cx, &cy, &cw, &ch)) continue;
+
+      // keep the visible piece, packed at the start of the MCU
+      if ((cw != mw) || (ch != mh)) {
+        for (uint32_t i = 0; i < cw; i++) {
+          memmove(&px[i * ch], &px[((cx - bx + i) * mh) + (cy - by)], (ch * sizeof(uint16_t)));
+        }
+      }
+
+      queue_rect(dev, cx, cy, cw, ch);
+      queue_push(dev, px, ((uint32_t)cw * ch), &dev->PixBufLock[dev->PixBufIndex]);
+      dev->PixBufActiveSize += (uint32_t)cw * ch;
+    }
+  }
+
+  if (dev->PixBufActiveSize) pixbuf_next(dev);
+
+  return status;
 }
 
 
@@ -453,6 +1328,10 @@ HAL_StatusTypeDef __attribute__((weak)) Display_ReadRectangle(Display_TypeDef* d
   uint16_t rh = h + y;
   if (rw > dev->Width) return HAL_ERROR;
   if (rh > dev->Height) return HAL_ERROR;
+
+  // the read path is synchronous, let the queue drain first
+  Display_Sync(dev);
+  spi_frame(dev, SPI_DATASIZE_8BIT);
   display_set_window(dev, x, y, (rw - 1), (rh - 1), READ);
 
   dev->PixBufBgActiveSize = dev->PixBufActiveSize;
@@ -488,89 +1367,200 @@ HAL_StatusTypeDef __attribute__((weak)) Display_DrawHLine(Display_TypeDef* dev,
 // --------------------------------------------------------------------------
 
 HAL_StatusTypeDef __attribute__((weak)) Display_DrawCircle(Display_TypeDef* dev, uint16_t x0, uint16_t y0, uint16_t r, uint16_t b, uint16_t c, ImageLayer_t l) {
+  Ring_TypeDef s;
 
-  int16_t x = 0;
-  int16_t y = r;
-  int16_t d = 1 - r;
+  Shape_Ring(&s, x0, y0, r, b);
+  if (l == FRONT) return display_draw_ring(dev, &s, c);
 
-  while (x <= y) {
-    if (Display_DrawHLine(dev, (x0 + x - b), (y0 + y), b, b, c, l) != HAL_OK) return HAL_ERROR;
-    if (Display_DrawHLine(dev, (x0 + x - b), (y0 - y), b, b, c, l) != HAL_OK) return HAL_ERROR;
-    if (Display_DrawHLine(dev, (x0 + y - b), (y0 + x), b, b, c, l) != HAL_OK) return HAL_ERROR;
-    if (Display_DrawHLine(dev, (x0 + y - b), (y0 - x), b, b, c, l) != HAL_OK) return HAL_ERROR;
+  // the back layer keeps its own pixels around the ring, span by span
+  int32_t x1 = s.Outer.X + s.Outer.W;
 
-    if (Display_DrawHLine(dev, (x0 - x - b), (y0 + y), b, b, c, l) != HAL_OK) return HAL_ERROR;
-    if (Display_DrawHLine(dev, (x0 - x - b), (y0 - y), b, b, c, l) != HAL_OK) return HAL_ERROR;
-    if (Display_DrawHLine(dev, (x0 - y - b), (y0 + x), b, b, c, l) != HAL_OK) return HAL_ERROR;
-    if (Display_DrawHLine(dev, (x0 - y - b), (y0 - x), b, b, c, l) != HAL_OK) return HAL_ERROR;
+  for (int32_t x = s.Outer.X; x < x1; x++) {
+    int16_t sp[4];
 
-    if (d < 0) {
-      d += 2 * x + 3;
-    } else {
-      d += 2 * (x - y) + 5;
-      y--;
+    Shape_RingSpan(&s, x, &sp[0], &sp[1], &sp[2], &sp[3]);
+    for (uint32_t k = 0; k < 4; k += 2) {
+      if ((x < 0) || (sp[k + 1] < 0) || (sp[k + 1] < sp[k])) continue;
+      if (sp[k] < 0) sp[k] = 0;   // cut at the top edge like display_clip()
+      if (Display_FillRectangle(dev, x, sp[k], 1, (sp[k + 1] - sp[k] + 1), c, l) != HAL_OK) return HAL_ERROR;
     }
-    x++;
   }
   return HAL_OK;
 }
 
 
+// --------------------------------------------------------------------------
+
+HAL_StatusTypeDef __attribute__((weak)) Display_DrawArc(Display_TypeDef* dev, uint16_t x0, uint16_t y0, uint16_t r, uint16_t b, int16_t start, int16_t end, uint16_t c) {
+  Ring_TypeDef s;
+
+  Shape_Arc(&s, x0, y0, r, b, start, end);
+  return display_draw_ring(dev, &s, c);
+}
+
+
 // --------------------------------------------------------------------------
 
 HAL_StatusTypeDef __attribute__((weak)) Display_FillCircle(Display_TypeDef* dev, uint16_t x0, uint16_t y0, uint16_t r, uint16_t c, ImageLayer_t l) {
-  int16_t x = 0;
-  int16_t y = r;
-  int16_t d = 1 - r;
+  Shape_TypeDef s;
 
-  while (x <= y) {
+  Shape_Circle(&s, x0, y0, r);
+  return display_fill_shape(dev, &s, c, l);
+}
 
-    if (Display_DrawHLine(dev, (x0 - x - 1), (y0 + y), (2 * x + 1), 1, c, l) != HAL_OK) return HAL_ERROR;
-    if (Display_DrawHLine(dev, (x0 - x - 1), (y0 - y), (2 * x + 1), 1, c, l) != HAL_OK) return HAL_ERROR;
-    if (Display_DrawHLine(dev, (x0 - y - 1), (y0 + x), (2 * y + 1), 1, c, l) != HAL_OK) return HAL_ERROR;
-    if (Display_DrawHLine(dev, (x0 - y - 1), (y0 - x), (2 * y + 1), 1, c, l) != HAL_OK) return HAL_ERROR;
 
-    if (d < 0) {
-      d += 2 * x + 3;
-    } else {
-      d += 2 * (x - y) + 5;
-      y--;
-    }
-    x++;
+// --------------------------------------------------------------------------
+
+HAL_StatusTypeDef __attribute__((weak)) Display_FillEllipse(Display_TypeDef* dev, uint16_t x0, uint16_t y0, uint16_t rx, uint16_t ry, uint16_t c, ImageLayer_t l) {
+  Shape_TypeDef s;
+
+  Shape_Ellipse(&s, x0, y0, rx, ry);
+  return display_fill_shape(dev, &s, c, l);
+}
+
+
+// --------------------------------------------------------------------------
+
+HAL_StatusTypeDef __attribute__((weak)) Display_FillRoundRect(Display_TypeDef* dev, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t r, uint16_t c, ImageLayer_t l) {
+  Shape_TypeDef s;
+
+  Shape_RoundRect(&s, x, y, w, h, r);
+  return display_fill_shape(dev, &s, c, l);
+}
+
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Appends a glyph to the write area. A glyph from the font atlas is
+ *          not copied at all, it goes to the bus straight from flash right
+ *          after what is buffered so far.
+ */
+__STATIC_INLINE void prepare_glyph(Display_TypeDef* dev, Font_TypeDef* f, uint16_t code) {
+  const uint16_t* px = Glyph_Atlas(f, code);
+
+  if (px) {
+    pixbuf_flush(dev);
+    queue_push(dev, (uint16_t*)px, ((uint32_t)f->Width * f->Height), NULL);
+    return;
   }
-  return HAL_OK;
+
+  GlyphCache_Expand(f, code, &dev->PixBuf[dev->PixBufActiveSize], f->Height, 0, f->Width, 0, f->Height);
+  dev->PixBufActiveSize += (uint32_t)f->Width * f->Height;
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Expands the columns c0..c1-1 and rows r0..r1-1 of a glyph, used
+ *          when the glyph is cut by the clip region.
+ */
+__STATIC_INLINE void prepare_glyph_part(Display_TypeDef* dev, Font_TypeDef* f, uint16_t code, uint16_t c0, uint16_t c1, uint16_t r0, uint16_t r1) {
+  GlyphCache_Expand(f, code, &dev->PixBuf[dev->PixBufActiveSize], (r1 - r0), c0, c1, r0, r1);
+  dev->PixBufActiveSize += (uint32_t)(c1 - c0) * (r1 - r0);
 }
 
 
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Takes one character off UTF-8 text, a sequence cut short by len
+ *          is taken byte by byte.
+ */
+__STATIC_INLINE uint32_t text_decode(const char* str, uint32_t len, uint16_t* code) {
+  uint32_t k = Glyph_Decode(str, len, code);
+
+  if (!k) {
+    *code = (uint8_t)*str;
+    k = 1;
+  }
+  return k;
+}
+
 
 // --------------------------------------------------------------------------
 
-__STATIC_INLINE void prepare_glyph(Display_TypeDef* dev, Font_TypeDef* f, char ch, uint32_t tp) {
+/**
+ * @brief   Sends the n characters in the first len bytes of str as one
+ *          window, cut to the clip region. Glyphs are laid into the write
+ *          area back to back and a part is handed to the bus as soon as the
+ *          next glyph does not fit.
+ */
+static void display_text_line(Display_TypeDef* dev, uint16_t x, uint16_t y, Font_TypeDef* f, const char* str, uint32_t len, uint32_t n) {
+
+  uint16_t lx = x, ly = y, lw = n * f->Width, lh = f->Height;
+  if (!n || !display_clip(dev, &lx, &ly, &lw, &lh)) return;
+
+  uint16_t r0 = ly - y;
+  uint16_t r1 = r0 + lh;
+
+  queue_rect(dev, lx, ly, lw, lh);
+  pixbuf_acquire(dev);
+  dev->PixBufActiveSize = 0;
+
+  for (uint32_t k = 0, i = 0; k < n; k++) {
+    uint16_t code;
+    i += text_decode(&str[i], (len - i), &code);
+
+    int32_t gx = x + (k * f->Width);
+    int32_t c0 = (lx > gx) ? (lx - gx) : 0;
+    int32_t c1 = ((lx + lw) < (gx + f->Width)) ? (lx + lw - gx) : f->Width;
+
+    if (c1 <= c0) continue;
 
-  // shift the glyph index
-  if ((ch < 32) || (ch > 126)) {
-    if (ch == 176) ch = 95;
-    else ch = 32;
+    if ((dev->PixBufActiveSize + ((uint32_t)(c1 - c0) * lh)) > dev->PixBufSize) pixbuf_flush(dev);
+
+    if (((c1 - c0) == f->Width) && (lh == f->Height)) {
+      prepare_glyph(dev, f, code);
+    } else {
+      prepare_glyph_part(dev, f, code, c0, c1, r0, r1);
+    }
   }
-  ch -= 32;
 
-  const uint8_t *glyph = f->Font + (ch * f->BytesPerGlif);
+  pixbuf_flush(dev);
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Streams UTF-8 text of any length, up to NUL or len bytes. A line
+ *          ends at '\n' or at the screen's right edge, where the text wraps
+ *          back to x. The clip region only cuts the lines, so a partial
+ *          redraw lays the text out as the full one does. Lines below the
+ *          clip region are not walked.
+ */
+static HAL_StatusTypeDef display_text(Display_TypeDef* dev, uint16_t x, uint16_t y, Font_TypeDef* f, const char* str, uint32_t len) {
+
+  if (!str || !f) return HAL_ERROR;
+  if (((uint32_t)f->Width * f->Height) > dev->PixBufSize) return HAL_ERROR;
+
+  int32_t bottom = dev->Clip.Y + dev->Clip.H;
+  uint32_t fit = (dev->Width > x) ? ((dev->Width - x) / f->Width) : 0;
 
-  uint32_t bi = dev->PixBufActiveSize;
+  if (!fit) return HAL_OK;
 
-  uint32_t pixel_count = 0;
+  uint32_t i = 0;
 
-  for (uint32_t byte = 0; byte < f->BytesPerGlif; byte++) {
-    uint8_t bits = glyph[byte];
+  for (int32_t ly = y; (i < len) && str[i] && (ly < bottom); ly += f->Height) {
+    uint32_t n = 0, k = 0;
+    uint16_t code;
 
-    for (uint8_t bit = 0; bit < 8; bit++) {
-      if (pixel_count >= tp) break;
-      dev->PixBuf[bi++] = (bits & 0x01) ? f->Color : f->Bgcolor;
-      bits >>= 1;
-      pixel_count++;
+    while ((n < fit) && ((i + k) < len) && str[i + k] && (str[i + k] != '\n')) {
+      k += text_decode(&str[i + k], (len - i - k), &code);
+      n++;
     }
+
+    display_text_line(dev, x, ly, f, &str[i], k, n);
+
+    // a newline right at the wrap point does not open an empty line
+    i += k;
+    if ((i < len) && (str[i] == '\n')) i++;
   }
-  dev->PixBufActiveSize = bi;
+
+  return HAL_OK;
 }
 
 
@@ -593,18 +1583,26 @@ HAL_StatusTypeDef __attribute__((weak)) Display_PrintSymbol(Display_TypeDef* dev
     rh = ry + f->Height;
     if (rw > dev->Width || rh > dev->Height) return (HAL_ERROR);
   #endif
-    
-  display_set_window(dev, rx, ry, rw - 1, rh - 1, WRITE);
-  
-  const uint32_t total_pixels = f->Width * f->Height;
 
-  dev->PixBufActiveSize = 0;
+  uint16_t gx = x, gy = y, gw = f->Width, gh = f->Height;
+  if (!display_clip(dev, &gx, &gy, &gw, &gh)) return HAL_OK;
 
-  prepare_glyph(dev, f, ch, total_pixels);
+  pixbuf_acquire(dev);
+  dev->PixBufActiveSize = 0;
 
-  if (dev->PixBufActiveSize) {
-      write_data_dma(dev);
+  if ((gw != f->Width) || (gh != f->Height)) {
+    // the glyph is cut by the clip region
+    queue_rect(dev, gx, gy, gw, gh);
+    prepare_glyph_part(dev, f, (uint8_t)ch, (gx - x), (gx - x + gw), (gy - y), (gy - y + gh));
+    pixbuf_flush(dev);
+    return HAL_OK;
   }
+    
+  queue_window(dev, rx, ry, rw - 1, rh - 1);
+  
+  prepare_glyph(dev, f, (uint8_t)ch);
+
+  pixbuf_flush(dev);
 
   return HAL_OK;
 }
@@ -614,77 +1612,240 @@ HAL_StatusTypeDef __attribute__((weak)) Display_PrintSymbol(Display_TypeDef* dev
 // --------------------------------------------------------------------------
 
 HAL_StatusTypeDef __attribute__((weak)) Display_PrintString(Display_TypeDef *dev, uint16_t x, uint16_t y, Font_TypeDef *f, const char *str) {
+  return display_text(dev, x, y, f, str, 0xffffffff);
+}
 
-  if (!str || !f) return HAL_ERROR;
 
-  uint16_t x_shift, y_shift, rw, rh, rx, ry;
 
-  #if DISPLAY_POSITION
-    rh = f->Width;
-    rw = f->Height;
-    rx = y;
-    ry = x;
-    x_shift = rx;
-    y_shift = ry;
-  #else
-    rh = f->Height;
-    rw = f->Width;
-    rx = x;
-    ry = y;
-    x_shift = rx;
-    y_shift = ry;
-  #endif
+// --------------------------------------------------------------------------
+
+HAL_StatusTypeDef __attribute__((weak)) Display_PrintText(Display_TypeDef *dev, uint16_t x, uint16_t y, Font_TypeDef *f, const char *str, uint32_t len) {
+  return display_text(dev, x, y, f, str, len);
+}
 
-  uint16_t char_count = 0;
 
-  while (str[char_count++] != '\n') {
-    if (char_count > 64) break;
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Hands the glyphs laid into the write area so far to the bus under
+ *          one window.
+ */
+static void text_sink_run(TextSink_TypeDef* s) {
+  Display_TypeDef* dev = s->Dev;
+
+  if (s->RunEnd > s->RunX) {
+    queue_rect(dev, s->RunX, (s->Y + s->R0), (s->RunEnd - s->RunX), (s->R1 - s->R0));
+    pixbuf_flush(dev);
   }
-  char_count--; // cut 0x0a
-  
-  uint32_t chunk = PIX_BUF_SZ / (rw * rh);
-  uint32_t total_pixels = rw * rh * chunk;
-  
-  for (uint8_t i = 1; i <= (char_count / chunk); i++) {
+  s->RunX = s->RunEnd = 0;
+}
 
-    
-    #if DISPLAY_POSITION
-      display_set_window(dev, x_shift, y_shift, (x_shift + rw - 1), ((chunk * rh) + y_shift - 1), WRITE);
-      y_shift += chunk * rh;
-      if (y_shift > dev->Width) return HAL_OK;
-    #else
-      display_set_window(dev, x_shift, y_shift, (x_shift + (chunk * rw) - 1), (ry + rh - 1), WRITE);
-      x_shift += chunk * rw;
-      if (x_shift > dev->Width) return HAL_OK;
-    #endif
-
-    dev->PixBufActiveSize = 0;
-    for (uint8_t j = 0; j < chunk; j++) {
-      prepare_glyph(dev, f, str[(j + (chunk * (i - 1)))], total_pixels);
-    }
 
-    write_data_dma(dev);
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Opens a line at Y and works out its rows inside the clip region.
+ */
+static void text_sink_line(TextSink_TypeDef* s, int32_t y) {
+  Display_TypeDef* dev = s->Dev;
+  int32_t top = dev->Clip.Y - y;
+  int32_t bottom = (dev->Clip.Y + dev->Clip.H) - y;
+
+  if (top < 0) top = 0;
+  if (bottom > s->Font->Height) bottom = s->Font->Height;
+
+  s->X = s->Left;
+  s->Y = y;
+  s->R0 = top;
+  s->R1 = (bottom > top) ? bottom : top;
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Lays one character into the write area, a run is sent when the
+ *          line ends or the part is full, so a short readout is a single
+ *          window. Lines wrap at the screen edge, the clip region only cuts
+ *          the glyphs.
+ */
+static void text_sink_glyph(TextSink_TypeDef* s, uint16_t code) {
+  Display_TypeDef* dev = s->Dev;
+  Font_TypeDef* f = s->Font;
+  int32_t right = dev->Width;
+  int32_t clip = dev->Clip.X + dev->Clip.W;
+
+  if (code == '\n') {
+    text_sink_run(s);
+    text_sink_line(s, (s->Y + f->Height));
+    return;
   }
 
-  // print the rest of the string
-  uint16_t str_rest = char_count % chunk;
-  if (str_rest) {
+  if ((s->Left + f->Width) > right) return;
 
-    #if DISPLAY_POSITION
-      display_set_window(dev, x_shift, y_shift, (x_shift + rw - 1), ((str_rest * rh) + y_shift - 1), WRITE);
-    #else
-      display_set_window(dev, x_shift, y_shift, (x_shift + (str_rest * rw) - 1), (ry + rh - 1), WRITE);
-    #endif
+  if ((s->X + f->Width) > right) {
+    text_sink_run(s);
+    text_sink_line(s, (s->Y + f->Height));
+  }
 
-    dev->PixBufActiveSize = 0;
-    total_pixels = rw * rh * str_rest;
+  int32_t c0 = (dev->Clip.X > s->X) ? (dev->Clip.X - s->X) : 0;
+  int32_t c1 = ((s->X + f->Width) > clip) ? (clip - s->X) : f->Width;
+  uint32_t rows = s->R1 - s->R0;
 
-    for (uint8_t j = 0; j < str_rest; j++) {
-      prepare_glyph(dev, f, str[char_count - str_rest + j], total_pixels);
-    }
-    write_data_dma(dev);
+  if ((c0 < c1) && rows) {
+    uint32_t size = (uint32_t)(c1 - c0) * rows;
+
+    if ((dev->PixBufActiveSize + size) > dev->PixBufSize) text_sink_run(s);
+    if (s->RunEnd == s->RunX) s->RunX = s->X + c0;
+
+    GlyphCache_Expand(f, code, &dev->PixBuf[dev->PixBufActiveSize], rows, c0, c1, s->R0, s->R1);
+    dev->PixBufActiveSize += size;
+    s->RunEnd = s->X + c1;
+  }
+
+  s->X += f->Width;
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Takes one byte from the formatter, a UTF-8 sequence is held back
+ *          until it is complete.
+ */
+static void text_sink_put(void* ctx, char ch) {
+  TextSink_TypeDef* s = (TextSink_TypeDef*)ctx;
+
+  s->Utf[s->UtfLen++] = ch;
+
+  while (s->UtfLen) {
+    uint16_t code;
+    uint32_t k = Glyph_Decode(s->Utf, s->UtfLen, &code);
+    if (!k) return;
+
+    s->UtfLen -= k;
+    for (uint32_t i = 0; i < s->UtfLen; i++) s->Utf[i] = s->Utf[i + k];
+    text_sink_glyph(s, code);
   }
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Formatted print, see format.c for the conversions. Characters go
+ *          from the formatter to the glyph expander one by one, no string
+ *          is built on the way. Wraps and breaks lines like PrintText.
+ */
+HAL_StatusTypeDef __attribute__((weak)) Display_Printf(Display_TypeDef *dev, uint16_t x, uint16_t y, Font_TypeDef *f, const char *fmt, ...) {
+
+  if (!fmt || !f) return HAL_ERROR;
+  if (((uint32_t)f->Width * f->Height) > dev->PixBufSize) return HAL_ERROR;
+
+  TextSink_TypeDef s = {.Dev = dev, .Font = f, .Left = x};
+  va_list ap;
+
+  text_sink_line(&s, y);
+  pixbuf_acquire(dev);
+  dev->PixBufActiveSize = 0;
+
+  va_start(ap, fmt);
+  Format_Stream(text_sink_put, &s, fmt, ap);
+  va_end(ap);
+
+  // a sequence cut short at the end
+  for (uint32_t i = 0; i < s.UtfLen; i++) text_sink_glyph(&s, (uint8_t)s.Utf[i]);
+
+  text_sink_run(&s);
 
   return HAL_OK;
 }
 
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Sends the inked box of a proportional glyph, cut to the clip
+ *          region, as its own window. Boxes share a part of the write area,
+ *          each one is handed to the bus as soon as it is expanded.
+ */
+static void display_prop_glyph(Display_TypeDef* dev, PropFont_TypeDef* f, uint16_t code, int32_t x, int32_t y) {
+
+  const FontGlyph_TypeDef* g = Glyph_Prop(f, code);
+
+  int32_t gx = x + g->XOffset;
+  int32_t gy = y + g->YOffset;
+  int32_t x0 = (gx > dev->Clip.X) ? gx : dev->Clip.X;
+  int32_t y0 = (gy > dev->Clip.Y) ? gy : dev->Clip.Y;
+  int32_t x1 = ((gx + g->Width) < (dev->Clip.X + dev->Clip.W)) ? (gx + g->Width) : (dev->Clip.X + dev->Clip.W);
+  int32_t y1 = ((gy + g->Height) < (dev->Clip.Y + dev->Clip.H)) ? (gy + g->Height) : (dev->Clip.Y + dev->Clip.H);
+
+  if ((x1 <= x0) || (y1 <= y0)) return;
+
+  uint32_t rows = y1 - y0;
+  uint32_t size = (x1 - x0) * rows;
+
+  if (size > dev->PixBufSize) return;
+
+  if ((dev->PixBufActiveSize + size) > dev->PixBufSize) {
+    pixbuf_next(dev);
+    pixbuf_acquire(dev);
+  }
+
+  uint16_t* px = &dev->PixBuf[dev->PixBufActiveSize];
+
+  Glyph_ExpandProp(f, code, px, rows, (x0 - gx), (x1 - gx), (y0 - gy), (y1 - gy));
+  dev->PixBufActiveSize += size;
+
+  queue_rect(dev, x0, y0, (x1 - x0), rows);
+  queue_push(dev, px, size, &dev->PixBufLock[dev->PixBufIndex]);
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Prints a UTF-8 string in a proportional font. Only the inked glyph
+ *          boxes are sent, the blank around them is left as it is. A line
+ *          ends at '\n' or at the screen's right edge, where the text wraps
+ *          back to x. The clip region only cuts the glyph boxes.
+ */
+HAL_StatusTypeDef __attribute__((weak)) Display_PrintProp(Display_TypeDef *dev, uint16_t x, uint16_t y, PropFont_TypeDef *f, const char *str) {
+
+  if (!str || !f) return HAL_ERROR;
+
+  int32_t right = dev->Width;
+  int32_t bottom = dev->Clip.Y + dev->Clip.H;
+  int32_t px = x, py = y;
+
+  pixbuf_acquire(dev);
+  dev->PixBufActiveSize = 0;
+
+  while (*str && (py < bottom)) {
+    uint16_t code;
+    str += text_decode(str, 3, &code);
+
+    if (code == '\n') {
+      px = x;
+      py += f->Height;
+      continue;
+    }
+
+    const FontGlyph_TypeDef* g = Glyph_Prop(f, code);
+
+    if (((px + g->Advance) > right) && (px > x)) {
+      px = x;
+      py += f->Height;
+      if (py >= bottom) break;
+    }
+
+    display_prop_glyph(dev, f, code, px, py);
+    px += g->Advance;
+  }
+
+  if (dev->PixBufActiveSize) pixbuf_next(dev);
+
+  return HAL_OK;
+}
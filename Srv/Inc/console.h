@@ -0,0 +1,93 @@
+/**
+  ******************************************************************************
+  * @file           : console.h
+  * @brief          : Header for console.c file.
+  *                   This file contains the common defines of the text
+  *                   console code.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2017-2026 Askug Ltd.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __CONSOLE_H
+#define __CONSOLE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#include "main.h"
+
+
+#define CONSOLE_COLS      40U   // cells per row
+#define CONSOLE_ROWS      20U   // rows, up to 32
+#define CONSOLE_TAB       8U    // tab stop every n cells
+#define CONSOLE_ATTR      0x07U // light grey on black
+
+
+/**
+ * @brief   Console cell type definition struct.
+ *          Attr holds the foreground palette color in bits 0-3 and the
+ *          background in bits 4-7.
+ */
+typedef struct {
+  uint8_t               Char;
+  uint8_t               Attr;
+} ConsoleCell_TypeDef;
+
+
+/**
+ * @brief   Console type definition struct.
+ *          A grid of character cells at (X, Y) kept as a ring of rows, screen
+ *          row r is Cell[(Top + r) % CONSOLE_ROWS]. Dirty and DirtyRows mark
+ *          the cells the panel does not show yet, by the row they are drawn
+ *          at. With Scroll the console scrolls the panel instead of
+ *          redrawing, it then owns the whole panel width of its rows.
+ */
+typedef struct {
+  Display_TypeDef*      Dev;
+  uint16_t              X;
+  uint16_t              Y;
+  Font_TypeDef*         Font;
+  const uint16_t*       Palette;
+  ConsoleCell_TypeDef   Cell[CONSOLE_ROWS][CONSOLE_COLS];
+  uint8_t               Dirty[CONSOLE_ROWS][(CONSOLE_COLS + 7) / 8];
+  uint32_t              DirtyRows;
+  uint8_t               Top;
+  uint8_t               Col;
+  uint8_t               Row;
+  uint8_t               Attr;
+  bool                  Scroll;
+} Console_TypeDef;
+
+
+
+HAL_StatusTypeDef Console_Init(Console_TypeDef*, Display_TypeDef*, uint16_t, uint16_t, Font_TypeDef*, bool);
+void Console_Clear(Console_TypeDef*);
+void Console_SetAttr(Console_TypeDef*, uint8_t);
+void Console_MoveTo(Console_TypeDef*, uint8_t, uint8_t);
+void Console_Putc(Console_TypeDef*, char);
+void Console_Write(Console_TypeDef*, const char*, uint32_t);
+HAL_StatusTypeDef Console_Flush(Console_TypeDef*);
+void Console_Stdout(Console_TypeDef*);
+
+
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __CONSOLE_H */
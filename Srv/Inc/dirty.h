@@ -0,0 +1,62 @@
+/**
+  ******************************************************************************
+  * @file           : dirty.h
+  * @brief          : Header for dirty.c file.
+  *                   This file contains the common defines of the display
+  *                   invalidation (dirty rectangles) code.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2017-2026 Askug Ltd.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __DIRTY_H
+#define __DIRTY_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#include "main.h"
+
+
+#define DIRTY_RECT_MAX    8U    // merged regions kept per update
+
+
+/**
+ * @brief   Invalidation context type definition struct.
+ *          Paint composes the scene into a canvas and is rendered band by
+ *          band. Without it Redraw draws straight to the panel, the display
+ *          clip region is set to the merged rectangle while it runs.
+ */
+typedef struct {
+  DisplayRect_TypeDef   Rect[DIRTY_RECT_MAX];
+  uint8_t               Count;
+  HAL_StatusTypeDef     (*Paint)(Canvas_TypeDef*);
+  HAL_StatusTypeDef     (*Redraw)(Display_TypeDef*, DisplayRect_TypeDef*);
+} Dirty_TypeDef;
+
+
+
+void Dirty_Invalidate(Dirty_TypeDef*, uint16_t, uint16_t, uint16_t, uint16_t);
+HAL_StatusTypeDef Dirty_Flush(Dirty_TypeDef*, Display_TypeDef*);
+
+
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __DIRTY_H */
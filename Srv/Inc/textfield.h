@@ -0,0 +1,70 @@
+/**
+  ******************************************************************************
+  * @file           : textfield.h
+  * @brief          : Header for textfield.c file.
+  *                   This file contains the common defines of the text field
+  *                   widget code.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2017-2026 Askug Ltd.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __TEXTFIELD_H
+#define __TEXTFIELD_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#include "main.h"
+
+
+#define TEXTFIELD_MAX     32U   // cells per field
+
+
+/**
+ * @brief   Text field type definition struct.
+ *          A single line of Cells glyph cells at (X, Y). Text (UTF-8), the
+ *          code point and the colors of every cell are what the panel shows
+ *          now, Length cells of it hold text and the rest is the display
+ *          background.
+ */
+typedef struct {
+  uint16_t              X;
+  uint16_t              Y;
+  uint8_t               Cells;
+  Font_TypeDef*         Font;
+  char                  Text[(TEXTFIELD_MAX * 3) + 1];
+  uint16_t              Code[TEXTFIELD_MAX];
+  uint16_t              Color[TEXTFIELD_MAX];
+  uint16_t              Bgcolor[TEXTFIELD_MAX];
+  uint8_t               Length;
+  bool                  Valid;
+} TextField_TypeDef;
+
+
+
+void TextField_Init(TextField_TypeDef*, uint16_t, uint16_t, uint8_t, Font_TypeDef*);
+void TextField_Invalidate(TextField_TypeDef*);
+HAL_StatusTypeDef TextField_Set(TextField_TypeDef*, Display_TypeDef*, const char*);
+
+
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __TEXTFIELD_H */
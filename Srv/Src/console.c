@@ -0,0 +1,339 @@
+/**
+  ******************************************************************************
+  * @file           : console.c
+  * @brief          : This file contain the text console code. The console
+  *                   keeps a grid of character cells instead of pixels and
+  *                   sends only the cells that changed, one window per row.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2017-2026 Askug Ltd.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#include "console.h"
+
+
+
+/* the 16 CGA colors, native RGB565 */
+static const uint16_t console_palette[16] = {
+  0x0000, 0x0015, 0x0540, 0x0555, 0xa800, 0xa815, 0xaaa0, 0xad55,
+  0x52aa, 0x52bf, 0x57ea, 0x57ff, 0xfaaa, 0xfabf, 0xffea, 0xffff,
+};
+
+static Console_TypeDef* console_stdout = NULL;
+
+/* the row Console_Flush() is painting, see console_paint() */
+static const Console_TypeDef* paint_con = NULL;
+static uint8_t paint_row = 0;
+static uint8_t paint_col = 0;
+
+
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Returns the place of screen row r in the cell ring.
+ */
+__STATIC_INLINE uint8_t console_row(const Console_TypeDef* con, uint32_t r) {
+  return (con->Top + r) % CONSOLE_ROWS;
+}
+
+
+// --------------------------------------------------------------------------
+
+__STATIC_INLINE bool console_same(const ConsoleCell_TypeDef* a, const ConsoleCell_TypeDef* b) {
+  return (a->Char == b->Char) && (a->Attr == b->Attr);
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Marks cell c of draw row d. The panel scrolls the rows itself with
+ *          Scroll, a row of the ring is then always drawn at the same place,
+ *          without it draw rows are screen rows.
+ */
+__STATIC_INLINE void console_mark(Console_TypeDef* con, uint32_t d, uint32_t c) {
+  con->Dirty[d][c >> 3] |= (uint8_t)(1U << (c & 7));
+  con->DirtyRows |= (1UL << d);
+}
+
+
+// --------------------------------------------------------------------------
+
+static void console_put(Console_TypeDef* con, uint32_t r, uint32_t c, uint8_t ch, uint8_t attr) {
+  uint8_t s = console_row(con, r);
+  ConsoleCell_TypeDef cell = {ch, attr};
+
+  if (console_same(&con->Cell[s][c], &cell)) return;
+
+  con->Cell[s][c] = cell;
+  console_mark(con, (con->Scroll ? s : r), c);
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Moves the text one row up and blanks the bottom row. Nothing is
+ *          copied, the ring only turns by one row. Without hardware scrolling
+ *          a cell is marked when it differs from the one the panel shows at
+ *          the same place, so repeated text does not go out again.
+ */
+static void console_scroll(Console_TypeDef* con) {
+  ConsoleCell_TypeDef blank = {' ', con->Attr};
+  uint8_t s0 = con->Top;
+
+  if (con->Scroll) {
+    // the panel moves the rows, only the one coming in at the bottom changes
+    for (uint32_t c = 0; c < CONSOLE_COLS; c++) {
+      if (!console_same(&con->Cell[s0][c], &blank)) console_mark(con, s0, c);
+    }
+  } else {
+    for (uint32_t r = 0; r < CONSOLE_ROWS; r++) {
+      const ConsoleCell_TypeDef* now = con->Cell[console_row(con, r)];
+      const ConsoleCell_TypeDef* next = ((r + 1) < CONSOLE_ROWS) ? con->Cell[console_row(con, (r + 1))] : NULL;
+
+      for (uint32_t c = 0; c < CONSOLE_COLS; c++) {
+        if (!console_same(&now[c], (next ? &next[c] : &blank))) console_mark(con, r, c);
+      }
+    }
+  }
+
+  for (uint32_t c = 0; c < CONSOLE_COLS; c++) con->Cell[s0][c] = blank;
+  con->Top = (s0 + 1) % CONSOLE_ROWS;
+}
+
+
+// --------------------------------------------------------------------------
+
+static void console_newline(Console_TypeDef* con) {
+  con->Col = 0;
+  if (con->Row < (CONSOLE_ROWS - 1)) {
+    con->Row++;
+  } else {
+    console_scroll(con);
+  }
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Paints cells paint_col.. of paint_row over the band, each in the
+ *          colors of its attribute.
+ */
+static HAL_StatusTypeDef console_paint(Canvas_TypeDef* cv) {
+  const Console_TypeDef* con = paint_con;
+  Font_TypeDef f = *con->Font;
+  int16_t y = con->Y + ((cv->Y - con->Y) / f.Height) * f.Height;
+
+  for (uint32_t c = paint_col; c < CONSOLE_COLS; c++) {
+    int16_t x = con->X + (c * f.Width);
+    if (x >= (cv->X + cv->W)) break;
+
+    const ConsoleCell_TypeDef* cell = &con->Cell[paint_row][c];
+    char s[2] = {(char)cell->Char, '\0'};
+
+    f.Color   = con->Palette[cell->Attr & 0x0f];
+    f.Bgcolor = con->Palette[cell->Attr >> 4];
+    Canvas_PrintString(cv, x, y, &f, s);
+  }
+
+  return HAL_OK;
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Sets up a blank console at (x, y) in cells of font f. Hardware
+ *          scrolling runs along the panel rows, so scroll is only taken up
+ *          in the vertical layout, and when the rows fit the scroll range.
+ */
+HAL_StatusTypeDef Console_Init(Console_TypeDef* con, Display_TypeDef* dev, uint16_t x, uint16_t y, Font_TypeDef* f, bool scroll) {
+
+  if (!con || !dev || !f) return HAL_ERROR;
+  if (((x + (CONSOLE_COLS * f->Width)) > dev->Width) || ((y + (CONSOLE_ROWS * f->Height)) > dev->Height)) return HAL_ERROR;
+
+  con->Dev     = dev;
+  con->X       = x;
+  con->Y       = y;
+  con->Font    = f;
+  con->Palette = console_palette;
+  con->Top     = 0;
+  con->Col     = 0;
+  con->Row     = 0;
+  con->Attr    = CONSOLE_ATTR;
+  con->Scroll  = false;
+
+  #if (DISPLAY_POSITION)
+    if (scroll && (Display_ScrollDefine(dev, y, (CONSOLE_ROWS * f->Height)) == HAL_OK)) con->Scroll = true;
+  #else
+    (void)scroll;
+  #endif
+
+  // the panel content is unknown, every cell goes out on the first flush
+  for (uint32_t r = 0; r < CONSOLE_ROWS; r++) {
+    for (uint32_t c = 0; c < CONSOLE_COLS; c++) {
+      con->Cell[r][c].Char = ' ';
+      con->Cell[r][c].Attr = con->Attr;
+      console_mark(con, r, c);
+    }
+  }
+
+  return HAL_OK;
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Blanks the console in the current attribute and homes the cursor.
+ */
+void Console_Clear(Console_TypeDef* con) {
+  for (uint32_t r = 0; r < CONSOLE_ROWS; r++) {
+    for (uint32_t c = 0; c < CONSOLE_COLS; c++) console_put(con, r, c, ' ', con->Attr);
+  }
+  con->Col = 0;
+  con->Row = 0;
+}
+
+
+// --------------------------------------------------------------------------
+
+void Console_SetAttr(Console_TypeDef* con, uint8_t attr) {
+  con->Attr = attr;
+}
+
+
+// --------------------------------------------------------------------------
+
+void Console_MoveTo(Console_TypeDef* con, uint8_t col, uint8_t row) {
+  con->Col = (col < CONSOLE_COLS) ? col : (CONSOLE_COLS - 1);
+  con->Row = (row < CONSOLE_ROWS) ? row : (CONSOLE_ROWS - 1);
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Puts one byte of a stream. '\n' starts a new line, '\r' goes back
+ *          to its start, '\b' one cell back, '\t' to the next tab stop and
+ *          '\f' clears the console. A full row wraps on the next character,
+ *          so a line of exactly CONSOLE_COLS cells and '\n' take one row.
+ *          Bytes from 0x80 are Latin-1.
+ */
+void Console_Putc(Console_TypeDef* con, char ch) {
+  uint8_t b = (uint8_t)ch;
+
+  switch (b) {
+    case '\n':
+      console_newline(con);
+    break;
+
+    case '\r':
+      con->Col = 0;
+    break;
+
+    case '\b':
+      if (con->Col) con->Col--;
+    break;
+
+    case '\t':
+      do {
+        Console_Putc(con, ' ');
+      } while (con->Col % CONSOLE_TAB);
+    break;
+
+    case '\f':
+      Console_Clear(con);
+    break;
+
+    default:
+      if (b < 0x20) break;
+      if (con->Col >= CONSOLE_COLS) console_newline(con);
+      console_put(con, con->Row, con->Col, b, con->Attr);
+      con->Col++;
+    break;
+  }
+}
+
+
+// --------------------------------------------------------------------------
+
+void Console_Write(Console_TypeDef* con, const char* buf, uint32_t len) {
+  while (len--) Console_Putc(con, *buf++);
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Brings the panel up to date: the scroll position first, then every
+ *          row with marked cells as one window from its first marked cell to
+ *          the last one.
+ */
+HAL_StatusTypeDef Console_Flush(Console_TypeDef* con) {
+
+  Font_TypeDef* f = con->Font;
+  HAL_StatusTypeDef status = HAL_OK;
+
+  if (con->Scroll && (Display_ScrollTo(con->Dev, (con->Top * f->Height)) != HAL_OK)) status = HAL_ERROR;
+
+  for (uint32_t d = 0; con->DirtyRows && (d < CONSOLE_ROWS); d++) {
+    if (!(con->DirtyRows & (1UL << d))) continue;
+
+    uint32_t c0 = CONSOLE_COLS, c1 = 0;
+    for (uint32_t c = 0; c < CONSOLE_COLS; c++) {
+      if (!(con->Dirty[d][c >> 3] & (1U << (c & 7)))) continue;
+      if (c < c0) c0 = c;
+      c1 = c + 1;
+    }
+
+    paint_con = con;
+    paint_row = con->Scroll ? d : console_row(con, d);
+    paint_col = c0;
+    if (Display_RenderBands(con->Dev, (con->X + (c0 * f->Width)), (con->Y + (d * f->Height)), ((c1 - c0) * f->Width), f->Height, console_paint) != HAL_OK) status = HAL_ERROR;
+
+    for (uint32_t k = 0; k < sizeof(con->Dirty[d]); k++) con->Dirty[d][k] = 0;
+    con->DirtyRows &= ~(1UL << d);
+  }
+
+  return status;
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Sends stdout (printf(), _write()) to con, NULL drops it. The
+ *          console is flushed at every '\n', so do not print from interrupts.
+ */
+void Console_Stdout(Console_TypeDef* con) {
+  console_stdout = con;
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   The byte sink of the weak _write() and of the Picolibc stdio
+ *          stream in syscalls.c. Weak, so an application retargeting stdout
+ *          to a UART keeps its own.
+ */
+int __attribute__((weak)) __io_putchar(int ch) {
+  if (console_stdout) {
+    Console_Putc(console_stdout, (char)ch);
+    if (ch == '\n') Console_Flush(console_stdout);
+  }
+  return ch;
+}
@@ -0,0 +1,136 @@
+/**
+  ******************************************************************************
+  * @file           : dirty.c
+  * @brief          : This file contain display invalidation (dirty rectangles)
+  *                   code.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2017-2026 Askug Ltd.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#include "dirty.h"
+
+
+
+
+// --------------------------------------------------------------------------
+
+__STATIC_INLINE uint32_t rect_area(const DisplayRect_TypeDef* r) {
+  return (uint32_t)r->W * r->H;
+}
+
+
+// --------------------------------------------------------------------------
+
+__STATIC_INLINE DisplayRect_TypeDef rect_union(const DisplayRect_TypeDef* a, const DisplayRect_TypeDef* b) {
+  uint32_t x0 = (a->X < b->X) ? a->X : b->X;
+  uint32_t y0 = (a->Y < b->Y) ? a->Y : b->Y;
+  uint32_t x1 = ((a->X + a->W) > (b->X + b->W)) ? (a->X + a->W) : (b->X + b->W);
+  uint32_t y1 = ((a->Y + a->H) > (b->Y + b->H)) ? (a->Y + a->H) : (b->Y + b->H);
+
+  DisplayRect_TypeDef u = {x0, y0, (x1 - x0), (y1 - y0)};
+  return u;
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Two rectangles are worth merging when they overlap or touch and
+ *          their bounding box costs no more pixels than sending both.
+ */
+static bool rect_mergeable(const DisplayRect_TypeDef* a, const DisplayRect_TypeDef* b) {
+
+  if ((a->X > (b->X + b->W)) || (b->X > (a->X + a->W))) return false;
+  if ((a->Y > (b->Y + b->H)) || (b->Y > (a->Y + a->H))) return false;
+
+  DisplayRect_TypeDef u = rect_union(a, b);
+  return (rect_area(&u) <= (rect_area(a) + rect_area(b)));
+}
+
+
+// --------------------------------------------------------------------------
+
+void Dirty_Invalidate(Dirty_TypeDef* ctx, uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+
+  if (!w || !h) return;
+
+  DisplayRect_TypeDef r = {x, y, w, h};
+
+  // fold the new region into every neighbour it merges with
+  uint8_t i = 0;
+  while (i < ctx->Count) {
+    if (rect_mergeable(&ctx->Rect[i], &r)) {
+      r = rect_union(&ctx->Rect[i], &r);
+      ctx->Rect[i] = ctx->Rect[--ctx->Count];
+      i = 0;
+      continue;
+    }
+    i++;
+  }
+
+  if (ctx->Count < DIRTY_RECT_MAX) {
+    ctx->Rect[ctx->Count++] = r;
+    return;
+  }
+
+  // no room left, grow the region that grows the least
+  uint8_t best = 0;
+  uint32_t best_cost = UINT32_MAX;
+  for (i = 0; i < ctx->Count; i++) {
+    DisplayRect_TypeDef u = rect_union(&ctx->Rect[i], &r);
+    uint32_t cost = rect_area(&u) - rect_area(&ctx->Rect[i]);
+    if (cost < best_cost) {
+      best_cost = cost;
+      best = i;
+    }
+  }
+  ctx->Rect[best] = rect_union(&ctx->Rect[best], &r);
+}
+
+
+// --------------------------------------------------------------------------
+
+HAL_StatusTypeDef Dirty_Flush(Dirty_TypeDef* ctx, Display_TypeDef* dev) {
+
+  HAL_StatusTypeDef status = HAL_OK;
+
+  if (!ctx->Paint && !ctx->Redraw) {
+    ctx->Count = 0;
+    return HAL_ERROR;
+  }
+
+  for (uint8_t i = 0; i < ctx->Count; i++) {
+    DisplayRect_TypeDef* r = &ctx->Rect[i];
+
+    // keep the region on the screen
+    if ((r->X >= dev->Width) || (r->Y >= dev->Height)) continue;
+    if ((r->X + r->W) > dev->Width) r->W = dev->Width - r->X;
+    if ((r->Y + r->H) > dev->Height) r->H = dev->Height - r->Y;
+
+    if (ctx->Paint) {
+      // composed off-screen, no flicker between the scene's layers
+      if (Display_RenderBands(dev, r->X, r->Y, r->W, r->H, ctx->Paint) != HAL_OK) status = HAL_ERROR;
+      continue;
+    }
+
+    if (Display_SetClip(dev, r->X, r->Y, r->W, r->H) != HAL_OK) {
+      status = HAL_ERROR;
+      continue;
+    }
+    if (ctx->Redraw(dev, r) != HAL_OK) status = HAL_ERROR;
+  }
+
+  Display_ResetClip(dev);
+  ctx->Count = 0;
+
+  return status;
+}
@@ -21,10 +21,54 @@
 
 #define SIMPLE_PAUSE 1000U;
 
+#define READOUT_X         10U
+#define READOUT_Y         80U
+#define READOUT_CHARS     12U
+#define TITLE_X           10U
+#define TITLE_Y           30U
+
 extern TouchState_t touch_activated_flag;
 
 static __IO uint32_t step = 0;
 
+static HAL_StatusTypeDef paint(Canvas_TypeDef*);
+
+static Font_TypeDef readout_font = {
+  .Bgcolor      = COLOR_BLUE,
+  .Color        = COLOR_LIME,
+  .Font         = (uint8_t*)&font_dot_10x14,
+  .Height       = 16,
+  .Width        = 12,
+  .BytesPerGlif = 24,
+  .Atlas        = &atlas_readout,
+};
+
+static Font_TypeDef title_font = {
+  .Bgcolor      = COLOR_BLACK,
+  .Color        = COLOR_WHITE,
+  .Font         = (uint8_t*)&aa_20x28_2,
+  .Height       = 32,
+  .Width        = 24,
+  .BytesPerGlif = 192,
+  .Bpp          = 2,
+};
+
+static Dirty_TypeDef dirty = {
+  .Count        = 0,
+  .Paint        = paint,
+};
+
+/* --- scene state painted by paint() --- */
+static bool scene_drawn = false;
+static uint16_t cross_x = 0;
+static uint16_t cross_y = 0;
+static TextField_TypeDef readout = {
+  .X            = READOUT_X,
+  .Y            = READOUT_Y,
+  .Cells        = READOUT_CHARS,
+  .Font         = &readout_font,
+};
+
 
 
 
@@ -41,38 +85,42 @@ static void on_down(Display_TypeDef* screen, TouchScreen_TypeDef* touch) {
 
 
 
+// --------------------------------------------------------------------------
+
+static HAL_StatusTypeDef paint(Canvas_TypeDef* cv) {
+
+  // background, title, readout and crosshair on top
+  Canvas_Fill(cv, COLOR_BLACK);
+  Canvas_PrintString(cv, TITLE_X, TITLE_Y, &title_font, "Touch");
+  Canvas_PrintString(cv, READOUT_X, READOUT_Y, &readout_font, readout.Text);
+  Canvas_DrawVLine(cv, cross_x, 0, DISPLAY_HEIGHT, 2, COLOR_WHITE);
+  Canvas_DrawHLine(cv, 0, cross_y, DISPLAY_WIDTH, 2, COLOR_WHITE);
+
+  return HAL_OK;
+}
+
+
+
 // --------------------------------------------------------------------------
 
 static void on_up(Display_TypeDef* screen, TouchScreen_TypeDef* touch) {
-  // Font_TypeDef font = {
-  //   .Bgcolor      = COLOR_BLUE,
-  //   .Color        = COLOR_LIME,
-  //   .Font         = (uint8_t*)&font_dot_20x28,
-  //   .Height       = 32,
-  //   .Width        = 24,
-  //   .BytesPerGlif = 96,
-  // };
-  Font_TypeDef font = {
-    .Bgcolor      = COLOR_BLUE,
-    .Color        = COLOR_LIME,
-    .Font         = (uint8_t*)&font_dot_10x14,
-    .Height       = 16,
-    .Width        = 12,
-    .BytesPerGlif = 24,
-  };
-
-  // Display_PrintSymbol(screen, 100, 150, &font, 'R');
-
-  Display_DrawVLine(screen, touch->Context->LastX, 0, DISPLAY_HEIGHT, 2, COLOR_BLACK, FRONT);
-  Display_DrawHLine(screen, 0, touch->Context->LastY, DISPLAY_WIDTH, 2, COLOR_BLACK, FRONT);
-
-  char position[20];
-  sprintf(position, "x:%d y:%d\n", touch->Context->X, touch->Context->Y); 
-  Display_FillRectangle(screen, 40, 80, (font.Width * 10), font.Height, COLOR_BLACK, FRONT);
-  Display_PrintString(screen, 10, 80, &font, position);
-
-  Display_DrawVLine(screen, touch->Context->X, 0, DISPLAY_HEIGHT, 2, COLOR_WHITE, FRONT);
-  Display_DrawHLine(screen, 0, touch->Context->Y, DISPLAY_WIDTH, 2, COLOR_WHITE, FRONT);
+
+  char text[READOUT_CHARS + 1];
+
+  cross_x = touch->Context->X;
+  cross_y = touch->Context->Y;
+  Format_String(text, sizeof(text), "x:%d y:%d", cross_x, cross_y);
+
+  // only the digits that changed, the crosshair is painted over them after
+  TextField_Set(&readout, screen, text);
+
+  // the old crosshair and the new one
+  Dirty_Invalidate(&dirty, touch->Context->LastX, 0, 2, DISPLAY_HEIGHT);
+  Dirty_Invalidate(&dirty, 0, touch->Context->LastY, DISPLAY_WIDTH, 2);
+  Dirty_Invalidate(&dirty, cross_x, 0, 2, DISPLAY_HEIGHT);
+  Dirty_Invalidate(&dirty, 0, cross_y, DISPLAY_WIDTH, 2);
+
+  Dirty_Flush(&dirty, screen);
 
   touch->Context->LastX = touch->Context->X;
   touch->Context->LastY = touch->Context->Y;
@@ -103,6 +151,14 @@ static void on_hold(Display_TypeDef* screen, TouchScreen_TypeDef* touch) {
 void Display_Run(Display_TypeDef* screen, TouchScreen_TypeDef* touch) {
 
   if (screen->Lock == ENABLE) return;
+
+  // the whole scene once, later only what changes
+  if (!scene_drawn) {
+    Dirty_Invalidate(&dirty, 0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT);
+    Dirty_Flush(&dirty, screen);
+    scene_drawn = true;
+  }
+
   if (touch_activated_flag != TOUCH_ACTIVE) return;
 
   TouchScreen_Process(touch);
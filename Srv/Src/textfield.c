@@ -0,0 +1,114 @@
+/**
+  ******************************************************************************
+  * @file           : textfield.c
+  * @brief          : This file contain the text field widget code. A field
+  *                   remembers what it shows and sends only the cells that
+  *                   changed.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2017-2026 Askug Ltd.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#include "textfield.h"
+#include <string.h>
+
+
+
+
+// --------------------------------------------------------------------------
+
+void TextField_Init(TextField_TypeDef* tf, uint16_t x, uint16_t y, uint8_t cells, Font_TypeDef* f) {
+  tf->X      = x;
+  tf->Y      = y;
+  tf->Cells  = (cells > TEXTFIELD_MAX) ? TEXTFIELD_MAX : cells;
+  tf->Font   = f;
+  tf->Text[0] = '\0';
+  tf->Length = 0;
+  tf->Valid  = false;
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Forgets what the panel shows, e.g. after a screen clear. The next
+ *          TextField_Set() sends the whole field.
+ */
+void TextField_Invalidate(TextField_TypeDef* tf) {
+  tf->Valid = false;
+}
+
+
+// --------------------------------------------------------------------------
+
+__STATIC_INLINE bool textfield_same(TextField_TypeDef* tf, uint32_t i, uint16_t code) {
+  return tf->Valid && (i < tf->Length) && (tf->Code[i] == code) &&
+    (tf->Color[i] == tf->Font->Color) && (tf->Bgcolor[i] == tf->Font->Bgcolor);
+}
+
+
+// --------------------------------------------------------------------------
+
+/**
+ * @brief   Shows UTF-8 str, up to NUL or '\n', in the field's font colors.
+ *          Every run of changed cells is one window, cells left over from a
+ *          longer text are cleared to the display background in one more.
+ */
+HAL_StatusTypeDef TextField_Set(TextField_TypeDef* tf, Display_TypeDef* dev, const char* str) {
+
+  if (!str || !tf->Font) return HAL_ERROR;
+
+  Font_TypeDef* f = tf->Font;
+  HAL_StatusTypeDef status = HAL_OK;
+  uint16_t code[TEXTFIELD_MAX];
+  uint8_t at[TEXTFIELD_MAX + 1];
+  uint32_t len = 0, end = 0;
+
+  // cell i is code[i], bytes at[i]..at[i + 1]-1 of str
+  while ((len < tf->Cells) && str[end] && (str[end] != '\n')) {
+    at[len] = end;
+    end += Glyph_Decode(&str[end], 3, &code[len]);
+    len++;
+  }
+  at[len] = end;
+
+  for (uint32_t i = 0; i < len;) {
+    if (textfield_same(tf, i, code[i])) {
+      i++;
+      continue;
+    }
+
+    uint32_t n = 1;
+    while (((i + n) < len) && !textfield_same(tf, (i + n), code[i + n])) n++;
+
+    if (Display_PrintText(dev, (tf->X + (i * f->Width)), tf->Y, f, &str[at[i]], (at[i + n] - at[i])) != HAL_OK) status = HAL_ERROR;
+
+    for (uint32_t k = i; k < (i + n); k++) {
+      tf->Code[k]    = code[k];
+      tf->Color[k]   = f->Color;
+      tf->Bgcolor[k] = f->Bgcolor;
+    }
+    i += n;
+  }
+
+  // the tail of a longer text, or the whole empty field the first time
+  uint32_t tail = tf->Valid ? tf->Length : tf->Cells;
+  if (tail > len) {
+    if (Display_FillRectangle(dev, (tf->X + (len * f->Width)), tf->Y, ((tail - len) * f->Width), f->Height, dev->Bgcolor, FRONT) != HAL_OK) status = HAL_ERROR;
+  }
+
+  memcpy(tf->Text, str, end);
+  tf->Text[end] = '\0';
+  tf->Length = len;
+  tf->Valid = true;
+
+  return status;
+}
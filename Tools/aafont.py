@@ -0,0 +1,112 @@
+#!/usr/bin/env python3
+"""
+Filename: aafont.py
+Description: Builds an anti-aliased 2-bpp or 4-bpp font from a dot font.
+
+  The dot font is sampled SS x SS times per pixel, a sample is ink when
+  at least 2/5 of the dot font within one dot around it is, which rounds
+  off the corners and the dot staircase. The samples of a pixel are then
+  averaged into 4 or 16 coverage levels. Pixels are
+  packed like the dot fonts, column by column, BPP bits per pixel, LSB
+  first. Glyph_Expand() blends them through a color pair table.
+
+Usage:
+  python3 Tools/aafont.py FONT BPP
+
+  FONT   5x7, 10x14, 15x21 or 20x28
+  BPP    2 or 4, writes Periph/Src/aa_FONT_BPP.c with aa_FONT_BPP in it
+
+Example:
+  python3 Tools/aafont.py 20x28 2
+
+Copyright (c) 2017-2026 Askug Ltd.
+"""
+
+import os
+import sys
+
+from atlas import FONTS, ROOT, load_font
+
+SS = 4
+
+
+def smooth(bits, width, height):
+    """Returns the coverage 0..1 of every glyph pixel, column by column."""
+    rad = max(width // 6, 1)
+    ink = [[(bits[(c * height + r) >> 3] >> ((c * height + r) & 7)) & 1 for r in range(height)] for c in range(width)]
+
+    def dot(c, r):
+        return ink[c][r] if (0 <= c < width) and (0 <= r < height) else 0
+
+    # pixel centers inside the disc around each sub-sample point of a pixel
+    discs = []
+    for sc in range(SS):
+        for sr in range(SS):
+            x, y = (sc + 0.5) / SS - 0.5, (sr + 0.5) / SS - 0.5
+            disc = [(dc, dr) for dc in range(-rad - 1, rad + 2) for dr in range(-rad - 1, rad + 2)
+                    if (dc - x) ** 2 + (dr - y) ** 2 <= rad * rad]
+            discs.append(disc)
+
+    out = []
+    for c in range(width):
+        for r in range(height):
+            near = [dot(c + dc, r + dr) for dc in range(-rad - 1, rad + 2) for dr in range(-rad - 1, rad + 2)]
+            if min(near) == max(near):
+                out.append(float(near[0]))
+                continue
+            hits = 0
+            for disc in discs:
+                # a bit under half keeps the corner-to-corner strokes thick
+                hits += 5 * sum(dot(c + dc, r + dr) for dc, dr in disc) >= 2 * len(disc)
+            out.append(hits / float(SS * SS))
+    return out
+
+
+def main(argv):
+    if len(argv) != 3 or argv[1] not in FONTS or argv[2] not in ("2", "4"):
+        sys.exit(__doc__)
+
+    font, bpp = argv[1], int(argv[2])
+    glyphs, width, height = load_font(font)
+    levels = (1 << bpp) - 1
+    size = width * height * bpp // 8
+    name = "%s_%d" % (font, bpp)
+
+    data = []
+    for bits in glyphs:
+        packed = [0] * size
+        for k, v in enumerate(smooth(bits, width, height)):
+            a = int(v * levels + 0.5)
+            b = k * bpp
+            packed[b >> 3] |= a << (b & 7)
+        data.append(packed)
+
+    out = []
+    out.append("/*")
+    out.append(" * Filename: aa_%s.c" % name)
+    out.append(" * Description: font_dot_%s anti-aliased, %d-bpp, %dx%d cells, %d bytes per glyph." % (font, bpp, width, height, size))
+    out.append(" *              Generated by Tools/aafont.py, do not edit.")
+    out.append(" */")
+    out.append("")
+    out.append('#include "aafont.h"')
+    out.append("")
+    out.append("")
+    out.append("const uint8_t aa_%s[96][%d] = {" % (name, size))
+    for n, packed in enumerate(data):
+        code = n + 32 if n < 95 else 176
+        out.append("  { // %r (%d)" % (chr(code), code))
+        for k in range(0, size, 16):
+            out.append("    " + ", ".join("0x%02x" % v for v in packed[k:k + 16]) + ("," if k + 16 < size else ""))
+        out.append("  }" + ("," if n < 95 else ""))
+    out.append("};")
+    out.append("")
+
+    path = os.path.join(ROOT, "Periph", "Src", "aa_%s.c" % name)
+    with open(path, "w") as f:
+        f.write("\n".join(out))
+
+    print("%s: %d bytes, BytesPerGlif %d" % (os.path.relpath(path, ROOT), 96 * size, size))
+
+
+if __name__ == "__main__":
+    main(sys.argv)
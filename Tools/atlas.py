@@ -0,0 +1,132 @@
+#!/usr/bin/env python3
+"""
+Filename: atlas.py
+Description: Generates a flash RGB565 glyph atlas from one of the dot fonts.
+
+  The atlas holds the chosen characters pre-expanded for one color pair, in
+  the panel stream order (Width columns of Height pixels). Display_PrintString
+  sends them straight from flash when the Font_TypeDef colors match.
+
+Usage:
+  python3 Tools/atlas.py NAME FONT FG BG CHARS
+
+  NAME   atlas name, writes Periph/Src/atlas_NAME.c with atlas_NAME in it
+  FONT   5x7, 10x14, 15x21 or 20x28
+  FG BG  RGB565 colors, e.g. 0xffe0 0x001f
+  CHARS  characters to pre-expand, e.g. " 0123456789:xy", "\\xb0" is degree
+
+Example:
+  python3 Tools/atlas.py readout 10x14 0xffe0 0x001f " 0123456789:xy-"
+
+Copyright (c) 2017-2026 Askug Ltd.
+"""
+
+import os
+import re
+import sys
+
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+
+# name: (source, glyph width, glyph height)
+FONTS = {
+    "5x7": ("dot_5x7.c", 6, 8),
+    "10x14": ("dot_10x14.c", 12, 16),
+    "15x21": ("dot_15x21.c", 18, 24),
+    "20x28": ("dot_20x28.c", 24, 32),
+}
+
+
+def load_font(name):
+    """Returns the 96 glyph bitmaps of a dot font as lists of bytes."""
+    src, width, height = FONTS[name]
+    with open(os.path.join(ROOT, "Periph", "Src", src)) as f:
+        text = f.read()
+
+    text = re.sub(r"/\*.*?\*/", "", text, flags=re.S)
+    text = re.sub(r"//[^\n]*", "", text)
+    text = text[text.index("=") + 1:]
+    data = [int(v, 16) for v in re.findall(r"0x[0-9a-fA-F]{2}", text)]
+
+    size = width * height // 8
+    if len(data) != 96 * size:
+        sys.exit("%s: %d bytes, expected %d" % (src, len(data), 96 * size))
+
+    return [data[i * size:(i + 1) * size] for i in range(96)], width, height
+
+
+def glyph_index(ch):
+    """Same mapping as Glyph_Bits(), 176 is the degree sign at the end."""
+    code = ord(ch)
+    if code < 32 or code > 126:
+        code = 127 if code == 176 else 32
+    return code - 32
+
+
+def main(argv):
+    if len(argv) != 6:
+        sys.exit(__doc__)
+
+    name, font, fg, bg, chars = argv[1], argv[2], int(argv[3], 0), int(argv[4], 0), argv[5]
+    chars = chars.encode().decode("unicode_escape")
+    if font not in FONTS:
+        sys.exit("unknown font %s" % font)
+
+    glyphs, width, height = load_font(font)
+
+    index = [0xff] * 96
+    order = []
+    for ch in chars:
+        i = glyph_index(ch)
+        if index[i] == 0xff:
+            index[i] = len(order)
+            order.append(i)
+
+    out = []
+    out.append("/*")
+    out.append(" * Filename: atlas_%s.c" % name)
+    out.append(" * Description: font_dot_%s in 0x%04x on 0x%04x, %d glyphs." % (font, fg, bg, len(order)))
+    out.append(" *              Generated by Tools/atlas.py, do not edit.")
+    out.append(" */")
+    out.append("")
+    out.append('#include "atlas.h"')
+    out.append("")
+    out.append("")
+    out.append("static const uint16_t atlas_%s_pixels[%d] = {" % (name, len(order) * width * height))
+    for n, i in enumerate(order):
+        bits = glyphs[i]
+        px = []
+        for b in range(width * height):
+            px.append(fg if (bits[b >> 3] >> (b & 7)) & 1 else bg)
+        code = i + 32 if i < 95 else 176
+        out.append("  // %r (%d)" % (chr(code), code))
+        for k in range(0, len(px), height):
+            line = ", ".join("0x%04x" % p for p in px[k:k + height])
+            last = (n == len(order) - 1) and (k + height >= len(px))
+            out.append("  " + line + ("" if last else ","))
+    out.append("};")
+    out.append("")
+    out.append("static const uint8_t atlas_%s_index[96] = {" % name)
+    for k in range(0, 96, 16):
+        out.append("  " + ", ".join("0x%02x" % v for v in index[k:k + 16]) + ("," if k < 80 else ""))
+    out.append("};")
+    out.append("")
+    out.append("const FontAtlas_TypeDef atlas_%s = {" % name)
+    out.append("  .Font    = (const uint8_t*)font_dot_%s," % font)
+    out.append("  .Color   = 0x%04x," % fg)
+    out.append("  .Bgcolor = 0x%04x," % bg)
+    out.append("  .Index   = atlas_%s_index," % name)
+    out.append("  .Pixels  = atlas_%s_pixels," % name)
+    out.append("};")
+    out.append("")
+
+    path = os.path.join(ROOT, "Periph", "Src", "atlas_%s.c" % name)
+    with open(path, "w") as f:
+        f.write("\n".join(out))
+
+    print("%s: %d glyphs, %d bytes of flash" % (os.path.relpath(path, ROOT), len(order), len(order) * width * height * 2))
+    print("declare it in Periph/Inc/atlas.h: extern const FontAtlas_TypeDef atlas_%s;" % name)
+
+
+if __name__ == "__main__":
+    main(sys.argv)
@@ -0,0 +1,240 @@
+#!/usr/bin/env python3
+"""
+Filename: extfont.py
+Description: Builds the extended 5x7 font, font_dot_5x7 plus the glyphs
+             drawn below, with its character map.
+
+  A glyph is drawn as 8 rows of 5 dots, '#' is ink. The top row is bit 7
+  of a column byte like in dot_5x7.c, capitals sit on rows 0..6, lowercase
+  letters on rows 2..6 and row 7 is the descender. A glyph given as a
+  single character reuses that glyph of font_dot_5x7, e.g. Cyrillic A.
+
+  Glyphs 0..95 are font_dot_5x7 as it is, the new ones follow in the order
+  of the tables below. Code points in runs of RANGE_MIN or more go to the
+  range table, the rest to a perfect hash, a seed is searched so that no
+  two of them share a slot.
+
+Usage:
+  python3 Tools/extfont.py
+
+  writes Periph/Src/ext_5x7.c with font_ext_5x7 and font_ext_5x7_map
+
+Copyright (c) 2017-2026 Askug Ltd.
+"""
+
+import os
+import sys
+
+from atlas import ROOT, load_font
+
+RANGE_MIN = 4
+
+
+UPPER = [
+    # 0x410 A .. 0x42f YA
+    "A",
+    "#####|#....|#....|####.|#...#|#...#|####.|.....",
+    "B",
+    "#####|#....|#....|#....|#....|#....|#....|.....",
+    ".###.|.#.#.|.#.#.|.#.#.|.#.#.|.#.#.|#####|#...#",
+    "E",
+    "#.#.#|#.#.#|.###.|..#..|.###.|#.#.#|#.#.#|.....",
+    ".###.|#...#|....#|..##.|....#|#...#|.###.|.....",
+    "#...#|#...#|#..##|#.#.#|##..#|#...#|#...#|.....",
+    "..#..|#...#|#..##|#.#.#|##..#|#...#|#...#|.....",
+    "K",
+    "..###|.#..#|.#..#|.#..#|.#..#|.#..#|#...#|.....",
+    "M",
+    "H",
+    "O",
+    "#####|#...#|#...#|#...#|#...#|#...#|#...#|.....",
+    "P",
+    "C",
+    "T",
+    "#...#|#...#|#...#|.####|....#|#...#|.###.|.....",
+    "..#..|.###.|#.#.#|#.#.#|.###.|..#..|..#..|.....",
+    "X",
+    "#..#.|#..#.|#..#.|#..#.|#..#.|#..#.|#####|....#",
+    "#...#|#...#|#...#|.####|....#|....#|....#|.....",
+    "#.#.#|#.#.#|#.#.#|#.#.#|#.#.#|#.#.#|#####|.....",
+    "#.#.#|#.#.#|#.#.#|#.#.#|#.#.#|#.#.#|#####|....#",
+    "##...|.#...|.#...|.###.|.#..#|.#..#|.###.|.....",
+    "#...#|#...#|#...#|##..#|#.#.#|#.#.#|##..#|.....",
+    "#....|#....|#....|####.|#...#|#...#|####.|.....",
+    ".###.|#...#|....#|..###|....#|#...#|.###.|.....",
+    "#..#.|#.#.#|#.#.#|###.#|#.#.#|#.#.#|#..#.|.....",
+    ".####|#...#|#...#|.####|..#.#|.#..#|#...#|.....",
+]
+
+LOWER = [
+    # 0x430 a .. 0x44f ya
+    "a",
+    ".####|#....|####.|#...#|#...#|#...#|.###.|.....",
+    ".....|.....|####.|#...#|####.|#...#|####.|.....",
+    ".....|.....|#####|#....|#....|#....|#....|.....",
+    ".....|.....|.###.|.#.#.|.#.#.|#####|#...#|.....",
+    "e",
+    ".....|.....|#.#.#|.###.|..#..|.###.|#.#.#|.....",
+    ".....|.....|.###.|....#|..##.|....#|.###.|.....",
+    ".....|.....|#...#|#..##|#.#.#|##..#|#...#|.....",
+    ".....|..#..|#...#|#..##|#.#.#|##..#|#...#|.....",
+    ".....|.....|#..#.|#.#..|##...|#.#..|#..#.|.....",
+    ".....|.....|..###|.#..#|.#..#|.#..#|#...#|.....",
+    ".....|.....|#...#|##.##|#.#.#|#...#|#...#|.....",
+    ".....|.....|#...#|#...#|#####|#...#|#...#|.....",
+    "o",
+    ".....|.....|#####|#...#|#...#|#...#|#...#|.....",
+    "p",
+    "c",
+    ".....|.....|#####|..#..|..#..|..#..|..#..|.....",
+    "y",
+    ".....|..#..|.###.|#.#.#|#.#.#|.###.|..#..|.....",
+    "x",
+    ".....|.....|#..#.|#..#.|#..#.|#..#.|#####|....#",
+    ".....|.....|#...#|#...#|.####|....#|....#|.....",
+    ".....|.....|#.#.#|#.#.#|#.#.#|#.#.#|#####|.....",
+    ".....|.....|#.#.#|#.#.#|#.#.#|#.#.#|#####|....#",
+    ".....|.....|##...|.#...|.###.|.#..#|.###.|.....",
+    ".....|.....|#...#|#...#|##..#|#.#.#|##..#|.....",
+    ".....|.....|#....|#....|####.|#...#|####.|.....",
+    ".....|.....|.###.|#...#|..###|#...#|.###.|.....",
+    ".....|.....|#..#.|#.#.#|###.#|#.#.#|#..#.|.....",
+    ".....|.....|.####|#...#|.####|.#..#|#...#|.....",
+]
+
+# code point: glyph
+EXTRA = [
+    (0x2190, ".....|..#..|.#...|#####|.#...|..#..|.....|....."),   # left arrow
+    (0x2191, "..#..|.###.|#.#.#|..#..|..#..|..#..|..#..|....."),   # up arrow
+    (0x2192, ".....|..#..|...#.|#####|...#.|..#..|.....|....."),   # right arrow
+    (0x2193, "..#..|..#..|..#..|..#..|#.#.#|.###.|..#..|....."),   # down arrow
+    (0x00b1, "..#..|..#..|#####|..#..|..#..|.....|#####|....."),   # plus-minus
+    (0x00b5, ".....|.....|#...#|#...#|#...#|##.##|#.#.#|#...."),   # micro
+    (0x00b7, ".....|.....|.....|..#..|.....|.....|.....|....."),   # middle dot
+    (0x00d7, ".....|#...#|.#.#.|..#..|.#.#.|#...#|.....|....."),   # multiply
+    (0x0401, ".#.#.|#####|#....|####.|#....|#....|#####|....."),   # IO
+    (0x0451, ".#.#.|.....|.###.|#...#|#####|#....|.###.|....."),   # io
+]
+
+
+def draw(art):
+    """Turns 8 rows of 5 dots into 6 column bytes, the last one blank."""
+    rows = art.split("|")
+    if len(rows) != 8 or any(len(r) != 5 for r in rows):
+        sys.exit("bad glyph %s" % art)
+    cols = []
+    for c in range(5):
+        v = 0
+        for r in range(8):
+            if rows[r][c] == "#":
+                v |= 0x80 >> r
+        cols.append(v)
+    return cols + [0]
+
+
+def perfect_hash(codes):
+    """Returns (size, seed) of the smallest table without collisions."""
+    size = 1
+    while size < len(codes):
+        size *= 2
+    while size <= 256:
+        for seed in range(1, 0x10000):
+            slots = set(((c * seed) >> 16) & (size - 1) for c in codes)
+            if len(slots) == len(codes):
+                return size, seed
+        size *= 2
+    sys.exit("no perfect hash")
+
+
+def main(argv):
+    if len(argv) != 1:
+        sys.exit(__doc__)
+
+    base, _, _ = load_font("5x7")
+    glyphs = [list(g) for g in base]
+    codes = {c: c - 32 for c in range(32, 127)}
+    codes[0xb0] = 95
+
+    def add(code, art):
+        codes[code] = len(glyphs)
+        glyphs.append(list(base[ord(art) - 32]) if len(art) == 1 else draw(art))
+
+    for k, art in enumerate(UPPER + LOWER):
+        add(0x410 + k, art)
+    for code, art in EXTRA:
+        add(code, art)
+
+    # runs of code points on consecutive glyphs
+    ranges = []
+    hashed = []
+    order = sorted(codes)
+    i = 0
+    while i < len(order):
+        j = i
+        while (j + 1) < len(order) and order[j + 1] == order[j] + 1 and codes[order[j + 1]] == codes[order[j]] + 1:
+            j += 1
+        if (j - i + 1) >= RANGE_MIN:
+            ranges.append((order[i], j - i + 1, codes[order[i]]))
+        else:
+            hashed += order[i:j + 1]
+        i = j + 1
+
+    size, seed = perfect_hash(hashed)
+    slot_code = [0] * size
+    slot_glyph = [0] * size
+    for c in hashed:
+        s = ((c * seed) >> 16) & (size - 1)
+        slot_code[s] = c
+        slot_glyph[s] = codes[c]
+
+    out = []
+    out.append("/*")
+    out.append(" * Filename: ext_5x7.c")
+    out.append(" * Description: font_dot_5x7 with Cyrillic, arrows and a few signs, %d glyphs." % len(glyphs))
+    out.append(" *              Generated by Tools/extfont.py, do not edit.")
+    out.append(" */")
+    out.append("")
+    out.append('#include "extfont.h"')
+    out.append("")
+    out.append("")
+    out.append("const uint8_t font_ext_5x7[%d][6] = {" % len(glyphs))
+    names = {v: k for k, v in codes.items()}
+    for n, g in enumerate(glyphs):
+        code = names[n]
+        line = "  {" + ", ".join("0x%02x" % v for v in g) + "}" + ("," if n < len(glyphs) - 1 else " ")
+        out.append("%s // U+%04X" % (line, code))
+    out.append("};")
+    out.append("")
+    out.append("static const FontRange_TypeDef font_ext_5x7_ranges[%d] = {" % len(ranges))
+    for n, (first, count, glyph) in enumerate(ranges):
+        out.append("  {0x%04x, %3d, %3d}%s" % (first, count, glyph, "," if n < len(ranges) - 1 else ""))
+    out.append("};")
+    out.append("")
+    out.append("static const uint16_t font_ext_5x7_hash_code[%d] = {" % size)
+    out.append("  " + ", ".join("0x%04x" % v for v in slot_code))
+    out.append("};")
+    out.append("")
+    out.append("static const uint16_t font_ext_5x7_hash_glyph[%d] = {" % size)
+    out.append("  " + ", ".join("%d" % v for v in slot_glyph))
+    out.append("};")
+    out.append("")
+    out.append("const FontMap_TypeDef font_ext_5x7_map = {")
+    out.append("  .Ranges    = font_ext_5x7_ranges,")
+    out.append("  .RangeNum  = %d," % len(ranges))
+    out.append("  .HashSize  = %d," % size)
+    out.append("  .Seed      = 0x%04x," % seed)
+    out.append("  .HashCode  = font_ext_5x7_hash_code,")
+    out.append("  .HashGlyph = font_ext_5x7_hash_glyph,")
+    out.append("  .Missing   = 0,")
+    out.append("};")
+    out.append("")
+
+    path = os.path.join(ROOT, "Periph", "Src", "ext_5x7.c")
+    with open(path, "w") as f:
+        f.write("\n".join(out))
+
+    print("%s: %d glyphs, %d ranges, %d hashed in %d slots" % (os.path.relpath(path, ROOT), len(glyphs), len(ranges), len(hashed), size))
+
+
+if __name__ == "__main__":
+    main(sys.argv)
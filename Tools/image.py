@@ -0,0 +1,209 @@
+#!/usr/bin/env python3
+"""
+Filename: image.py
+Description: Packs a picture into the compressed image format of
+  Periph/Src/image.c, a QOI variant for native RGB565 pixels.
+
+  Pixels are taken in the panel stream order, the H pixels of a column
+  after another, and turned into index, difference, run or literal ops.
+  The encoder checks its output by decoding it again.
+
+  The picture is read from a binary PPM (P6) file, most image tools can
+  write one, e.g. `convert splash.png splash.ppm`.
+
+Usage:
+  python3 Tools/image.py PICTURE.ppm NAME
+
+  NAME   C name of the image, writes Periph/Src/img_NAME.c with
+         `const Image_TypeDef img_NAME` in it, to be drawn with
+         Display_DrawImage()
+
+Example:
+  python3 Tools/image.py splash.ppm splash
+
+Copyright (c) 2017-2026 Askug Ltd.
+"""
+
+import os
+import sys
+
+from atlas import ROOT
+
+
+def read_ppm(path):
+    """Returns width, height and the RGB888 rows of a binary PPM."""
+    with open(path, "rb") as f:
+        data = f.read()
+
+    fields = []
+    pos = 0
+    while len(fields) < 4:
+        while data[pos:pos + 1].isspace():
+            pos += 1
+        if data[pos:pos + 1] == b"#":
+            while data[pos:pos + 1] not in (b"\n", b""):
+                pos += 1
+            continue
+        start = pos
+        while not data[pos:pos + 1].isspace():
+            pos += 1
+        fields.append(data[start:pos])
+    pos += 1
+
+    if fields[0] != b"P6" or int(fields[3]) != 255:
+        sys.exit("%s: only 8-bit binary PPM (P6) is supported" % path)
+
+    width, height = int(fields[1]), int(fields[2])
+    rgb = data[pos:pos + width * height * 3]
+    if len(rgb) != width * height * 3:
+        sys.exit("%s: truncated" % path)
+    return width, height, rgb
+
+
+def to_rgb565(width, height, rgb):
+    """Returns the pixels as native RGB565 in the stream order."""
+    out = []
+    for x in range(width):
+        for y in range(height):
+            i = (y * width + x) * 3
+            r = (rgb[i] * 31 + 127) // 255
+            g = (rgb[i + 1] * 63 + 127) // 255
+            b = (rgb[i + 2] * 31 + 127) // 255
+            out.append((r << 11) | (g << 5) | b)
+    return out
+
+
+def split(p):
+    return p >> 11, (p >> 5) & 0x3f, p & 0x1f
+
+
+def hash565(p):
+    r, g, b = split(p)
+    return (r * 3 + g * 5 + b * 7) & 0x3f
+
+
+def wrap(d, bits):
+    """Turns a channel difference into its signed value within bits."""
+    half = 1 << (bits - 1)
+    return ((d + half) & ((1 << bits) - 1)) - half
+
+
+def encode(px):
+    """Packs pixels into ops."""
+    out = []
+    index = [0] * 64
+    prev = 0
+    run = 0
+
+    for i, p in enumerate(px):
+        if p == prev:
+            run += 1
+            if run == 62 or i == len(px) - 1:
+                out.append(0xc0 | (run - 1))
+                run = 0
+            continue
+
+        if run:
+            out.append(0xc0 | (run - 1))
+            run = 0
+
+        h = hash565(p)
+        if index[h] == p:
+            out.append(h)
+        else:
+            r, g, b = split(p)
+            pr, pg, pb = split(prev)
+            dr, dg, db = wrap(r - pr, 5), wrap(g - pg, 6), wrap(b - pb, 5)
+            if -2 <= dr <= 1 and -2 <= dg <= 1 and -2 <= db <= 1:
+                out.append(0x40 | ((dr + 2) << 4) | ((dg + 2) << 2) | (db + 2))
+            elif -8 <= dr - dg <= 7 and -8 <= db - dg <= 7:
+                out.append(0x80 | (dg + 32))
+                out.append(((dr - dg + 8) << 4) | (db - dg + 8))
+            else:
+                out += [0xfe, p >> 8, p & 0xff]
+            index[h] = p
+        prev = p
+
+    return out
+
+
+def decode(data, count):
+    """Unpacks ops back into pixels, used to check the encoder."""
+    out = []
+    index = [0] * 64
+    p = 0
+    i = 0
+
+    def add(p, dr, dg, db):
+        r, g, b = split(p)
+        return (((r + dr) & 0x1f) << 11) | (((g + dg) & 0x3f) << 5) | ((b + db) & 0x1f)
+
+    while len(out) < count:
+        op = data[i]
+        i += 1
+        if op < 0x40:
+            p = index[op]
+        elif op < 0x80:
+            p = add(p, ((op >> 4) & 3) - 2, ((op >> 2) & 3) - 2, (op & 3) - 2)
+        elif op < 0xc0:
+            dg = (op & 0x3f) - 32
+            rb = data[i]
+            i += 1
+            p = add(p, (rb >> 4) - 8 + dg, dg, (rb & 0x0f) - 8 + dg)
+        elif op < 0xfe:
+            out += [p] * ((op & 0x3f) + 1)
+            continue
+        else:
+            p = (data[i] << 8) | data[i + 1]
+            i += 2
+        index[hash565(p)] = p
+        out.append(p)
+
+    return out
+
+
+def main(argv):
+    if len(argv) != 3 or not argv[2].isidentifier():
+        sys.exit(__doc__)
+
+    width, height, rgb = read_ppm(argv[1])
+    name = argv[2]
+
+    px = to_rgb565(width, height, rgb)
+    data = encode(px)
+    if decode(data, len(px)) != px:
+        sys.exit("encoder check failed")
+
+    out = []
+    out.append("/*")
+    out.append(" * Filename: img_%s.c" % name)
+    out.append(" * Description: %s, %dx%d pixels in %d bytes." % (os.path.basename(argv[1]), width, height, len(data)))
+    out.append(" *              Generated by Tools/image.py, do not edit.")
+    out.append(" */")
+    out.append("")
+    out.append('#include "main.h"')
+    out.append("")
+    out.append("")
+    out.append("static const uint8_t img_%s_data[%d] = {" % (name, len(data)))
+    for k in range(0, len(data), 16):
+        out.append("  " + ", ".join("0x%02x" % v for v in data[k:k + 16]) + ("," if k + 16 < len(data) else ""))
+    out.append("};")
+    out.append("")
+    out.append("const Image_TypeDef img_%s = {" % name)
+    out.append("  .W    = %d," % width)
+    out.append("  .H    = %d," % height)
+    out.append("  .Size = %d," % len(data))
+    out.append("  .Data = img_%s_data," % name)
+    out.append("};")
+    out.append("")
+
+    path = os.path.join(ROOT, "Periph", "Src", "img_%s.c" % name)
+    with open(path, "w") as f:
+        f.write("\n".join(out))
+
+    print("%s: %d bytes, %d bytes as RGB565" % (os.path.relpath(path, ROOT), len(data), 2 * len(px)))
+    print("declare it with: extern const Image_TypeDef img_%s;" % name)
+
+
+if __name__ == "__main__":
+    main(sys.argv)
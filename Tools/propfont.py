@@ -0,0 +1,106 @@
+#!/usr/bin/env python3
+"""
+Filename: propfont.py
+Description: Converts one of the dot fonts into a proportional font.
+
+  Every glyph is cut down to its inked box, the box is packed column by
+  column, Height bits per column, LSB first, like the dot fonts. The pen
+  advances by the box width plus one dot of spacing, a blank glyph by half
+  a cell. Display_PrintProp sends only the inked boxes.
+
+Usage:
+  python3 Tools/propfont.py FONT
+
+  FONT   5x7, 10x14, 15x21 or 20x28, writes Periph/Src/prop_FONT.c with
+         prop_FONT_glyphs and prop_FONT_bitmap in it
+
+Example:
+  python3 Tools/propfont.py 10x14
+
+Copyright (c) 2017-2026 Askug Ltd.
+"""
+
+import os
+import sys
+
+from atlas import FONTS, ROOT, load_font
+
+
+def ink_box(bits, width, height):
+    """Returns (x, y, w, h) of the set bits, w = h = 0 for a blank glyph."""
+    cols = []
+    rows = []
+    for c in range(width):
+        for r in range(height):
+            b = c * height + r
+            if (bits[b >> 3] >> (b & 7)) & 1:
+                cols.append(c)
+                rows.append(r)
+    if not cols:
+        return 0, 0, 0, 0
+    return min(cols), min(rows), max(cols) - min(cols) + 1, max(rows) - min(rows) + 1
+
+
+def pack_box(bits, height, x, y, w, h):
+    """Packs the w x h box at (x, y) of a glyph into bytes."""
+    out = [0] * ((w * h + 7) // 8)
+    for c in range(w):
+        for r in range(h):
+            b = (x + c) * height + (y + r)
+            if (bits[b >> 3] >> (b & 7)) & 1:
+                k = c * h + r
+                out[k >> 3] |= 1 << (k & 7)
+    return out
+
+
+def main(argv):
+    if len(argv) != 2 or argv[1] not in FONTS:
+        sys.exit(__doc__)
+
+    font = argv[1]
+    glyphs, width, height = load_font(font)
+    dot = width // 6
+
+    bitmap = []
+    table = []
+    for i, bits in enumerate(glyphs):
+        x, y, w, h = ink_box(bits, width, height)
+        advance = (w + dot) if w else (width // 2)
+        table.append((len(bitmap), w, h, 0, y, advance, i))
+        bitmap += pack_box(bits, height, x, y, w, h)
+
+    if len(bitmap) > 0xffff:
+        sys.exit("bitmap too large for 16-bit offsets")
+
+    out = []
+    out.append("/*")
+    out.append(" * Filename: prop_%s.c" % font)
+    out.append(" * Description: font_dot_%s cut down to the inked glyph boxes, %d bytes." % (font, len(bitmap)))
+    out.append(" *              Generated by Tools/propfont.py, do not edit.")
+    out.append(" */")
+    out.append("")
+    out.append('#include "propfont.h"')
+    out.append("")
+    out.append("")
+    out.append("const uint8_t prop_%s_bitmap[%d] = {" % (font, len(bitmap)))
+    for k in range(0, len(bitmap), 16):
+        out.append("  " + ", ".join("0x%02x" % v for v in bitmap[k:k + 16]) + ("," if k + 16 < len(bitmap) else ""))
+    out.append("};")
+    out.append("")
+    out.append("const FontGlyph_TypeDef prop_%s_glyphs[96] = {" % font)
+    for n, (offset, w, h, xo, yo, adv, i) in enumerate(table):
+        code = i + 32 if i < 95 else 176
+        line = "  {%5d, %2d, %2d, %d, %2d, %2d}%s" % (offset, w, h, xo, yo, adv, "," if n < 95 else " ")
+        out.append("%s // %r (%d)" % (line, chr(code), code))
+    out.append("};")
+    out.append("")
+
+    path = os.path.join(ROOT, "Periph", "Src", "prop_%s.c" % font)
+    with open(path, "w") as f:
+        f.write("\n".join(out))
+
+    print("%s: %d bytes of bitmap, %d bytes as a dot font" % (os.path.relpath(path, ROOT), len(bitmap), 96 * width * height // 8))
+
+
+if __name__ == "__main__":
+    main(sys.argv)
@@ -0,0 +1,127 @@
+#!/usr/bin/env python3
+"""
+Filename: rlefont.py
+Description: Encodes one of the dot fonts run-length, optionally scaled up.
+
+  Glyph pixels are taken in the panel stream order, Height pixels of a
+  column after another, and cut into runs of one color. A run is a byte,
+  bit 7 is set for the ink color, bits 0..6 hold the length 1..127. Runs
+  go on from one column into the next. Glyph i takes the bytes from
+  Offset[i] to Offset[i + 1] - 1.
+
+  The font is used as a Font_TypeDef with Font pointing at the runs and Rle
+  at the offsets, Glyph_Expand() decodes it run by run.
+
+Usage:
+  python3 Tools/rlefont.py FONT [SCALE]
+
+  FONT   5x7, 10x14, 15x21 or 20x28
+  SCALE  integer dot size, 1 by default, e.g. 2 turns 20x28 into 40x56;
+         writes Periph/Src/rle_WxH.c with rle_WxH_runs and rle_WxH_offset
+         in it, WxH being the scaled dot font size
+
+Example:
+  python3 Tools/rlefont.py 20x28
+  python3 Tools/rlefont.py 15x21 2
+
+Copyright (c) 2017-2026 Askug Ltd.
+"""
+
+import os
+import sys
+
+from atlas import FONTS, ROOT, load_font
+
+
+def pixels(bits, width, height, scale):
+    """Returns the glyph scaled up, in the stream order, 1 for ink."""
+    out = []
+    for c in range(width * scale):
+        for r in range(height * scale):
+            b = (c // scale) * height + (r // scale)
+            out.append((bits[b >> 3] >> (b & 7)) & 1)
+    return out
+
+
+def encode(px):
+    """Cuts pixels into run bytes."""
+    out = []
+    i = 0
+    while i < len(px):
+        n = 1
+        while (i + n) < len(px) and px[i + n] == px[i] and n < 127:
+            n += 1
+        out.append((0x80 if px[i] else 0) | n)
+        i += n
+    return out
+
+
+def decode(runs):
+    """Expands run bytes back into pixels, used to check the encoder."""
+    out = []
+    for v in runs:
+        out += [v >> 7] * (v & 0x7f)
+    return out
+
+
+def main(argv):
+    if len(argv) not in (2, 3) or argv[1] not in FONTS:
+        sys.exit(__doc__)
+
+    font = argv[1]
+    scale = int(argv[2]) if len(argv) == 3 else 1
+    glyphs, width, height = load_font(font)
+
+    dots = [int(v) * scale for v in font.split("x")]
+    name = "%dx%d" % (dots[0], dots[1])
+
+    runs = []
+    offset = []
+    for bits in glyphs:
+        px = pixels(bits, width, height, scale)
+        enc = encode(px)
+        if decode(enc) != px:
+            sys.exit("encoder check failed")
+        offset.append(len(runs))
+        runs += enc
+    offset.append(len(runs))
+
+    if len(runs) > 0xffff:
+        sys.exit("runs too large for 16-bit offsets")
+
+    out = []
+    out.append("/*")
+    out.append(" * Filename: rle_%s.c" % name)
+    out.append(" * Description: font_dot_%s x%d run-length encoded, %dx%d cells, %d bytes." % (font, scale, width * scale, height * scale, len(runs) + 2 * len(offset)))
+    out.append(" *              Generated by Tools/rlefont.py, do not edit.")
+    out.append(" */")
+    out.append("")
+    out.append('#include "rlefont.h"')
+    out.append("")
+    out.append("")
+    out.append("const uint8_t rle_%s_runs[%d] = {" % (name, len(runs)))
+    for n in range(96):
+        code = n + 32 if n < 95 else 176
+        out.append("  // %r (%d)" % (chr(code), code))
+        part = runs[offset[n]:offset[n + 1]]
+        for k in range(0, len(part), 16):
+            last = (n == 95) and (k + 16 >= len(part))
+            out.append("  " + ", ".join("0x%02x" % v for v in part[k:k + 16]) + ("" if last else ","))
+    out.append("};")
+    out.append("")
+    out.append("const uint16_t rle_%s_offset[97] = {" % name)
+    for k in range(0, 97, 12):
+        out.append("  " + ", ".join("%5d" % v for v in offset[k:k + 12]) + ("," if k + 12 < 97 else ""))
+    out.append("};")
+    out.append("")
+
+    path = os.path.join(ROOT, "Periph", "Src", "rle_%s.c" % name)
+    with open(path, "w") as f:
+        f.write("\n".join(out))
+
+    plain = 96 * width * height * scale * scale // 8
+    print("%s: %d bytes, %d bytes as a dot font" % (os.path.relpath(path, ROOT), len(runs) + 2 * len(offset), plain))
+
+
+if __name__ == "__main__":
+    main(sys.argv)